@@ -59,3 +59,6 @@
 #include <hpx/parallel/algorithms/shift_left.hpp>
 #include <hpx/parallel/algorithms/shift_right.hpp>
 #include <hpx/parallel/algorithms/starts_with.hpp>
+
+// Experimental
+#include <hpx/parallel/algorithms/pipeline.hpp>
@@ -0,0 +1,173 @@
+//  Copyright (c) 2014-2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/is_value_proxy.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    // find the first smallest element in [it, it + count)
+    template <typename ExPolicy>
+    struct sequential_min_element_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_min_element_t<ExPolicy>>
+    {
+    private:
+        template <typename FwdIter, typename F, typename Proj>
+        friend inline constexpr FwdIter tag_fallback_invoke(
+            sequential_min_element_t<ExPolicy>, FwdIter it, std::size_t count,
+            F const& f, Proj const& proj)
+        {
+            if (count == 0 || count == 1)
+                return it;
+
+            using element_type = hpx::traits::proxy_value_t<
+                typename std::iterator_traits<FwdIter>::value_type>;
+
+            auto smallest = it;
+
+            element_type value = HPX_INVOKE(proj, *smallest);
+            for (--count, ++it; count != 0; (void) --count, ++it)
+            {
+                element_type curr_value = HPX_INVOKE(proj, *it);
+                if (HPX_INVOKE(f, curr_value, value))
+                {
+                    smallest = it;
+                    value = HPX_MOVE(curr_value);
+                }
+            }
+
+            return smallest;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_min_element_t<ExPolicy>
+        sequential_min_element = sequential_min_element_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+    inline constexpr FwdIter sequential_min_element(
+        FwdIter it, std::size_t count, F const& f, Proj const& proj)
+    {
+        return sequential_min_element_t<ExPolicy>{}(it, count, f, proj);
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // find the last largest element in [it, it + count)
+    template <typename ExPolicy>
+    struct sequential_max_element_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_max_element_t<ExPolicy>>
+    {
+    private:
+        template <typename FwdIter, typename F, typename Proj>
+        friend inline constexpr FwdIter tag_fallback_invoke(
+            sequential_max_element_t<ExPolicy>, FwdIter it, std::size_t count,
+            F const& f, Proj const& proj)
+        {
+            if (count == 0 || count == 1)
+                return it;
+
+            using element_type = hpx::traits::proxy_value_t<
+                typename std::iterator_traits<FwdIter>::value_type>;
+
+            auto largest = it;
+
+            element_type value = HPX_INVOKE(proj, *largest);
+            for (--count, ++it; count != 0; (void) --count, ++it)
+            {
+                element_type curr_value = HPX_INVOKE(proj, *it);
+                if (!HPX_INVOKE(f, curr_value, value))
+                {
+                    largest = it;
+                    value = HPX_MOVE(curr_value);
+                }
+            }
+
+            return largest;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_max_element_t<ExPolicy>
+        sequential_max_element = sequential_max_element_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+    inline constexpr FwdIter sequential_max_element(
+        FwdIter it, std::size_t count, F const& f, Proj const& proj)
+    {
+        return sequential_max_element_t<ExPolicy>{}(it, count, f, proj);
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    // find the first smallest and the last largest element in [it, it + count)
+    template <typename ExPolicy>
+    struct sequential_minmax_element_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_minmax_element_t<ExPolicy>>
+    {
+    private:
+        template <typename FwdIter, typename F, typename Proj>
+        friend inline constexpr util::min_max_result<FwdIter>
+        tag_fallback_invoke(sequential_minmax_element_t<ExPolicy>, FwdIter it,
+            std::size_t count, F const& f, Proj const& proj)
+        {
+            util::min_max_result<FwdIter> result = {it, it};
+
+            if (count == 0 || count == 1)
+                return result;
+
+            using element_type = hpx::traits::proxy_value_t<
+                typename std::iterator_traits<FwdIter>::value_type>;
+
+            element_type min_value = HPX_INVOKE(proj, *it);
+            element_type max_value = min_value;
+            for (--count, ++it; count != 0; (void) --count, ++it)
+            {
+                element_type curr_value = HPX_INVOKE(proj, *it);
+                if (HPX_INVOKE(f, curr_value, min_value))
+                {
+                    result.min = it;
+                    min_value = curr_value;
+                }
+
+                if (!HPX_INVOKE(f, curr_value, max_value))
+                {
+                    result.max = it;
+                    max_value = HPX_MOVE(curr_value);
+                }
+            }
+
+            return result;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_minmax_element_t<ExPolicy>
+        sequential_minmax_element = sequential_minmax_element_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+    inline constexpr util::min_max_result<FwdIter> sequential_minmax_element(
+        FwdIter it, std::size_t count, F const& f, Proj const& proj)
+    {
+        return sequential_minmax_element_t<ExPolicy>{}(it, count, f, proj);
+    }
+#endif
+}}}}    // namespace hpx::parallel::v1::detail
@@ -0,0 +1,407 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/iterator_support/counting_shape.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    /// \cond NOINTERNAL
+
+    // Arithmetic keys are sorted by an unsigned integer representation whose
+    // order matches the order of the key values.
+    template <typename T, typename Enable = void>
+    struct radix_sort_key : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct radix_sort_key<T,
+        std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>>
+      : std::true_type
+    {
+        using bits_type = std::make_unsigned_t<T>;
+
+        // flipping the sign bit moves negative values before positive ones
+        static constexpr bits_type sign_bit = std::is_signed_v<T> ?
+            bits_type(bits_type(1) << (sizeof(T) * CHAR_BIT - 1)) :
+            bits_type(0);
+
+        static constexpr bits_type encode(T value) noexcept
+        {
+            return static_cast<bits_type>(
+                static_cast<bits_type>(value) ^ sign_bit);
+        }
+
+        static constexpr T decode(bits_type bits) noexcept
+        {
+            return static_cast<T>(static_cast<bits_type>(bits ^ sign_bit));
+        }
+    };
+
+    template <typename T>
+    struct radix_sort_key<T,
+        std::enable_if_t<std::is_floating_point_v<T> &&
+            std::numeric_limits<T>::is_iec559 &&
+            (sizeof(T) == sizeof(std::uint32_t) ||
+                sizeof(T) == sizeof(std::uint64_t))>> : std::true_type
+    {
+        using bits_type = std::conditional_t<sizeof(T) == sizeof(std::uint32_t),
+            std::uint32_t, std::uint64_t>;
+
+        static constexpr bits_type sign_bit = bits_type(1)
+            << (sizeof(T) * CHAR_BIT - 1);
+
+        // Negative values have their sign bit set, all of their bits are
+        // flipped to reverse their order. Positive values get the sign bit
+        // set to move them after the negative values.
+        static bits_type encode(T value) noexcept
+        {
+            bits_type bits;
+            std::memcpy(&bits, &value, sizeof(T));
+            return (bits & sign_bit) ? ~bits : (bits | sign_bit);
+        }
+
+        static T decode(bits_type bits) noexcept
+        {
+            bits = (bits & sign_bit) ? (bits & ~sign_bit) : ~bits;
+            T value;
+            std::memcpy(&value, &bits, sizeof(T));
+            return value;
+        }
+    };
+
+    // The comparison function objects known to sort in ascending (1) or
+    // descending (-1) order of the key values.
+    template <typename Comp, typename T>
+    struct radix_sort_order : std::integral_constant<int, 0>
+    {
+    };
+
+    template <typename T>
+    struct radix_sort_order<detail::less, T> : std::integral_constant<int, 1>
+    {
+    };
+
+    template <typename T>
+    struct radix_sort_order<std::less<T>, T> : std::integral_constant<int, 1>
+    {
+    };
+
+    template <typename T>
+    struct radix_sort_order<std::less<>, T> : std::integral_constant<int, 1>
+    {
+    };
+
+    template <typename T>
+    struct radix_sort_order<detail::greater, T>
+      : std::integral_constant<int, -1>
+    {
+    };
+
+    template <typename T>
+    struct radix_sort_order<std::greater<T>, T>
+      : std::integral_constant<int, -1>
+    {
+    };
+
+    template <typename T>
+    struct radix_sort_order<std::greater<>, T>
+      : std::integral_constant<int, -1>
+    {
+    };
+
+    template <typename Iter, typename Comp>
+    inline constexpr int radix_sort_order_v =
+        radix_sort_order<std::decay_t<Comp>,
+            typename std::iterator_traits<Iter>::value_type>::value;
+
+    // The radix sort is used if the keys are arithmetic values compared
+    // using one of the known comparison function objects.
+    template <typename Iter, typename Comp, typename Proj>
+    inline constexpr bool use_radix_sort_v =
+        hpx::traits::is_random_access_iterator_v<Iter> &&
+        radix_sort_key<
+            typename std::iterator_traits<Iter>::value_type>::value &&
+        radix_sort_order_v<Iter, Comp> != 0 &&
+        std::is_same_v<std::decay_t<Proj>, util::projection_identity>;
+
+    // The values sorted alongside the keys are moved only once, after all
+    // keys have been sorted.
+    template <typename KeyIter, typename ValueIter, typename Comp>
+    inline constexpr bool use_radix_sort_by_key_v =
+        use_radix_sort_v<KeyIter, Comp, util::projection_identity> &&
+        hpx::traits::is_random_access_iterator_v<ValueIter> &&
+        std::is_nothrow_move_constructible_v<
+            typename std::iterator_traits<ValueIter>::value_type> &&
+        std::is_nothrow_move_assignable_v<
+            typename std::iterator_traits<ValueIter>::value_type>;
+
+    // Smaller sequences are sorted using the comparison based sort
+    static constexpr std::size_t radix_sort_min_size = 65536ul;
+
+    // Each task processes at least this many keys
+    static constexpr std::size_t radix_sort_min_chunk_size = 16384ul;
+
+    // Marks a radix sort of keys without values
+    struct radix_sort_no_values
+    {
+    };
+
+    // Least significant digit radix sort using 8 bit digits. The keys are
+    // split into chunks, one per core. Each pass computes a histogram of the
+    // digits for each chunk, turns these into offsets by an exclusive scan
+    // over (digit, chunk), and scatters the keys of each chunk to their
+    // offsets. Passes for which all keys have the same digit are skipped.
+    template <bool Descending, typename ExPolicy, typename KeyIter,
+        typename ValueIter>
+    void radix_sort(
+        ExPolicy& policy, KeyIter keys, ValueIter values, std::size_t count)
+    {
+        using key_type = typename std::iterator_traits<KeyIter>::value_type;
+        using key_traits = radix_sort_key<key_type>;
+        using bits_type = typename key_traits::bits_type;
+
+        constexpr bool has_values =
+            !std::is_same_v<ValueIter, radix_sort_no_values>;
+
+        constexpr std::size_t radix_bits = 8;
+        constexpr std::size_t radix_size = std::size_t(1) << radix_bits;
+        constexpr std::size_t radix_mask = radix_size - 1;
+        constexpr std::size_t passes = sizeof(bits_type);
+
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+        std::size_t const num_chunks = (std::max)(std::size_t(1),
+            (std::min)(cores, count / radix_sort_min_chunk_size));
+        std::size_t const chunk_size = (count + num_chunks - 1) / num_chunks;
+
+        auto for_each_chunk = [&](auto&& f) {
+            execution::bulk_sync_execute(
+                policy.executor(),
+                [&](std::size_t chunk) {
+                    std::size_t const begin =
+                        (std::min)(chunk * chunk_size, count);
+                    std::size_t const end =
+                        (std::min)(begin + chunk_size, count);
+                    f(chunk, begin, end);
+                },
+                hpx::util::detail::make_counting_shape(num_chunks));
+        };
+
+        std::unique_ptr<bits_type[]> bits(new bits_type[count]);
+        std::unique_ptr<bits_type[]> bits_buffer(new bits_type[count]);
+
+        // the permutation applied to the keys so far
+        std::unique_ptr<std::size_t[]> perm;
+        std::unique_ptr<std::size_t[]> perm_buffer;
+        if constexpr (has_values)
+        {
+            perm.reset(new std::size_t[count]);
+            perm_buffer.reset(new std::size_t[count]);
+        }
+
+        // histograms[chunk][pass][digit]
+        std::vector<std::size_t> histograms(num_chunks * passes * radix_size);
+        auto histogram = [&](std::size_t chunk, std::size_t pass) {
+            return &histograms[(chunk * passes + pass) * radix_size];
+        };
+
+        // encode the keys and compute the histograms for all passes
+        for_each_chunk(
+            [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                KeyIter it = keys;
+                std::advance(it, begin);
+                for (std::size_t i = begin; i != end; ++i, ++it)
+                {
+                    bits_type b = key_traits::encode(*it);
+                    if constexpr (Descending)
+                    {
+                        b = static_cast<bits_type>(~b);
+                    }
+                    bits[i] = b;
+                    if constexpr (has_values)
+                    {
+                        perm[i] = i;
+                    }
+                    for (std::size_t pass = 0; pass != passes; ++pass)
+                    {
+                        ++histogram(chunk, pass)[(b >> (pass * radix_bits)) &
+                            radix_mask];
+                    }
+                }
+            });
+
+        bits_type* src = bits.get();
+        bits_type* dst = bits_buffer.get();
+        std::size_t* perm_src = perm.get();
+        std::size_t* perm_dst = perm_buffer.get();
+
+        std::vector<std::size_t> offsets(num_chunks * radix_size);
+        bool data_permuted = false;
+        for (std::size_t pass = 0; pass != passes; ++pass)
+        {
+            std::size_t const shift = pass * radix_bits;
+
+            // nothing to do if all keys have the same digit
+            bool trivial_pass = false;
+            for (std::size_t digit = 0; digit != radix_size; ++digit)
+            {
+                std::size_t total = 0;
+                for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+                {
+                    total += histogram(chunk, pass)[digit];
+                }
+                if (total != 0)
+                {
+                    trivial_pass = total == count;
+                    break;
+                }
+            }
+            if (trivial_pass)
+            {
+                continue;
+            }
+
+            // the histograms of the chunks have changed if the keys were
+            // moved by a previous pass
+            if (data_permuted)
+            {
+                for_each_chunk([&](std::size_t chunk, std::size_t begin,
+                                   std::size_t end) {
+                    std::size_t* hist = histogram(chunk, pass);
+                    std::fill(hist, hist + radix_size, 0);
+                    for (std::size_t i = begin; i != end; ++i)
+                    {
+                        ++hist[(src[i] >> shift) & radix_mask];
+                    }
+                });
+            }
+
+            std::size_t sum = 0;
+            for (std::size_t digit = 0; digit != radix_size; ++digit)
+            {
+                for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+                {
+                    offsets[chunk * radix_size + digit] = sum;
+                    sum += histogram(chunk, pass)[digit];
+                }
+            }
+
+            for_each_chunk(
+                [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                    std::size_t* offset = &offsets[chunk * radix_size];
+                    for (std::size_t i = begin; i != end; ++i)
+                    {
+                        bits_type const b = src[i];
+                        std::size_t const pos =
+                            offset[(b >> shift) & radix_mask]++;
+                        dst[pos] = b;
+                        if constexpr (has_values)
+                        {
+                            perm_dst[pos] = perm_src[i];
+                        }
+                    }
+                });
+
+            std::swap(src, dst);
+            std::swap(perm_src, perm_dst);
+            data_permuted = true;
+        }
+
+        if (!data_permuted)
+        {
+            return;
+        }
+
+        if constexpr (has_values)
+        {
+            // move the values into their final order, this requires a
+            // temporary buffer
+            using value_type =
+                typename std::iterator_traits<ValueIter>::value_type;
+            using difference_type =
+                typename std::iterator_traits<ValueIter>::difference_type;
+
+            std::allocator<value_type> alloc;
+            value_type* buffer = alloc.allocate(count);
+
+            for_each_chunk(
+                [&](std::size_t, std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i != end; ++i)
+                    {
+                        ::new (static_cast<void*>(buffer + i))
+                            value_type(HPX_MOVE(values[static_cast<
+                                difference_type>(perm_src[i])]));
+                    }
+                });
+
+            for_each_chunk(
+                [&](std::size_t, std::size_t begin, std::size_t end) {
+                    ValueIter it = values;
+                    std::advance(it, begin);
+                    for (std::size_t i = begin; i != end; ++i, ++it)
+                    {
+                        *it = HPX_MOVE(buffer[i]);
+                        buffer[i].~value_type();
+                    }
+                });
+
+            alloc.deallocate(buffer, count);
+        }
+
+        for_each_chunk([&](std::size_t, std::size_t begin, std::size_t end) {
+            KeyIter it = keys;
+            std::advance(it, begin);
+            for (std::size_t i = begin; i != end; ++i, ++it)
+            {
+                bits_type b = src[i];
+                if constexpr (Descending)
+                {
+                    b = static_cast<bits_type>(~b);
+                }
+                *it = key_traits::decode(b);
+            }
+        });
+    }
+
+    // Sort the given keys (and values) asynchronously and return the given
+    // result once done.
+    template <bool Descending, typename ExPolicy, typename KeyIter,
+        typename ValueIter, typename Result>
+    hpx::future<Result> parallel_radix_sort_async(ExPolicy&& policy,
+        KeyIter keys, ValueIter values, std::size_t count, Result result)
+    {
+        return execution::async_execute(policy.executor(),
+            [policy, keys, values, count, result]() mutable -> Result {
+                radix_sort<Descending>(policy, keys, values, count);
+                return result;
+            });
+    }
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
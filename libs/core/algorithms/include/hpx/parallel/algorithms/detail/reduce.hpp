@@ -0,0 +1,88 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    // provide implementation of std::transform_reduce (with a unary
+    // conversion) supporting iterators/sentinels, this is used for
+    // hpx::reduce as well
+    template <typename ExPolicy>
+    struct sequential_reduce_t final
+      : hpx::functional::detail::tag_fallback<sequential_reduce_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter, typename Sent, typename T, typename Reduce,
+            typename Conv>
+        friend inline constexpr T tag_fallback_invoke(
+            sequential_reduce_t<ExPolicy>, Iter first, Sent last, T init,
+            Reduce&& r, Conv&& conv)
+        {
+            for (/**/; first != last; ++first)
+            {
+                init = HPX_INVOKE(r, HPX_MOVE(init), HPX_INVOKE(conv, *first));
+            }
+            return init;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_reduce_t<ExPolicy> sequential_reduce =
+        sequential_reduce_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter, typename Sent, typename T,
+        typename Reduce, typename Conv>
+    inline constexpr T sequential_reduce(
+        Iter first, Sent last, T init, Reduce&& r, Conv&& conv)
+    {
+        return sequential_reduce_t<ExPolicy>{}(first, last, HPX_MOVE(init),
+            HPX_FORWARD(Reduce, r), HPX_FORWARD(Conv, conv));
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct sequential_reduce_n_t final
+      : hpx::functional::detail::tag_fallback<sequential_reduce_n_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter, typename T, typename Reduce, typename Conv>
+        friend inline constexpr T tag_fallback_invoke(
+            sequential_reduce_n_t<ExPolicy>, Iter first, std::size_t count,
+            T init, Reduce&& r, Conv&& conv)
+        {
+            for (/**/; count != 0; (void) --count, ++first)
+            {
+                init = HPX_INVOKE(r, HPX_MOVE(init), HPX_INVOKE(conv, *first));
+            }
+            return init;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_reduce_n_t<ExPolicy> sequential_reduce_n =
+        sequential_reduce_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce,
+        typename Conv>
+    inline constexpr T sequential_reduce_n(
+        Iter first, std::size_t count, T init, Reduce&& r, Conv&& conv)
+    {
+        return sequential_reduce_n_t<ExPolicy>{}(first, count, HPX_MOVE(init),
+            HPX_FORWARD(Reduce, r), HPX_FORWARD(Conv, conv));
+    }
+#endif
+}}}}    // namespace hpx::parallel::v1::detail
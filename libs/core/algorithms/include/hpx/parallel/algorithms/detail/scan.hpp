@@ -0,0 +1,52 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    // Combine the (already scanned) elements of a partition with the scan
+    // result of all partitions to its left: *it = op(prefix, *it)
+    template <typename ExPolicy>
+    struct sequential_apply_prefix_n_t final
+      : hpx::functional::detail::tag_fallback<
+            sequential_apply_prefix_n_t<ExPolicy>>
+    {
+    private:
+        template <typename Iter, typename T, typename Op>
+        friend inline constexpr Iter tag_fallback_invoke(
+            sequential_apply_prefix_n_t<ExPolicy>, Iter it, std::size_t count,
+            T const& prefix, Op&& op)
+        {
+            for (/**/; count != 0; (void) --count, ++it)
+            {
+                *it = HPX_INVOKE(op, prefix, *it);
+            }
+            return it;
+        }
+    };
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    template <typename ExPolicy>
+    inline constexpr sequential_apply_prefix_n_t<ExPolicy>
+        sequential_apply_prefix_n = sequential_apply_prefix_n_t<ExPolicy>{};
+#else
+    template <typename ExPolicy, typename Iter, typename T, typename Op>
+    inline constexpr Iter sequential_apply_prefix_n(
+        Iter it, std::size_t count, T const& prefix, Op&& op)
+    {
+        return sequential_apply_prefix_n_t<ExPolicy>{}(
+            it, count, prefix, HPX_FORWARD(Op, op));
+    }
+#endif
+}}}}    // namespace hpx::parallel::v1::detail
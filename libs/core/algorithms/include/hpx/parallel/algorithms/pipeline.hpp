@@ -0,0 +1,615 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/pipeline.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/detail/invoke.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/iterator_support/traits/is_range.hpp>
+#include <hpx/pack_traversal/unwrap.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/foreach_partitioner.hpp>
+#include <hpx/parallel/util/loop.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The element-wise stages of a pipeline are fused into a single function
+    // object. It is invoked for each element of the input sequence and pushes
+    // the values produced by the last stage (if any) into a sink. Every stage
+    // exposes the type of the values it produces for a given input type.
+    struct pipeline_source
+    {
+        template <typename T>
+        using result_type = T;
+
+        template <typename Sink, typename T>
+        HPX_FORCEINLINE constexpr void operator()(Sink& sink, T&& t) const
+        {
+            sink(HPX_FORWARD(T, t));
+        }
+    };
+
+    template <typename Stages, typename F>
+    struct pipeline_transform_stage
+    {
+        Stages stages;
+        F f;
+
+        template <typename T>
+        using result_type = hpx::util::invoke_result_t<F&,
+            typename Stages::template result_type<T>>;
+
+        template <typename Sink, typename T>
+        HPX_FORCEINLINE void operator()(Sink& sink, T&& t)
+        {
+            auto transform_sink = [&](auto&& value) {
+                sink(HPX_INVOKE(f, HPX_FORWARD(decltype(value), value)));
+            };
+            stages(transform_sink, HPX_FORWARD(T, t));
+        }
+    };
+
+    template <typename Stages, typename Pred>
+    struct pipeline_filter_stage
+    {
+        Stages stages;
+        Pred pred;
+
+        template <typename T>
+        using result_type = typename Stages::template result_type<T>;
+
+        template <typename Sink, typename T>
+        HPX_FORCEINLINE void operator()(Sink& sink, T&& t)
+        {
+            auto filter_sink = [&](auto&& value) {
+                if (HPX_INVOKE(pred, value))
+                {
+                    sink(HPX_FORWARD(decltype(value), value));
+                }
+            };
+            stages(filter_sink, HPX_FORWARD(T, t));
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Run the fused stages over [first, last) and hand every value they
+    // produce to the given sink.
+    template <typename ExPolicy, typename Iter, typename Stages, typename Sink>
+    void pipeline_loop_n(
+        Iter first, std::size_t count, Stages stages, Sink& sink)
+    {
+        util::loop_n<std::decay_t<ExPolicy>>(
+            first, count, [&](Iter it) { stages(sink, *it); });
+    }
+
+    template <typename Iter, typename Sent, typename Stages, typename Sink>
+    void pipeline_loop(Iter first, Sent last, Stages stages, Sink& sink)
+    {
+        for (/**/; first != last; ++first)
+        {
+            stages(sink, *first);
+        }
+    }
+
+    // Sequenced policies and input iterators run all stages in a single loop
+    // on the calling thread.
+    template <typename ExPolicy, typename Iter>
+    inline constexpr bool run_pipeline_sequentially_v =
+        hpx::is_sequenced_execution_policy_v<ExPolicy> ||
+        !hpx::traits::is_forward_iterator_v<Iter>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Combine the values produced by the stages with the given reduction
+    // operation. Each partition accumulates into its own partial result, the
+    // partial results are combined with the initial value afterwards.
+    template <typename ExPolicy, typename Iter, typename Sent, typename Stages,
+        typename T, typename Reduce>
+    util::detail::algorithm_result_t<ExPolicy, T> pipeline_reduce(
+        ExPolicy&& policy, Iter first, Sent last, Stages const& stages, T init,
+        Reduce&& r)
+    {
+        if constexpr (run_pipeline_sequentially_v<ExPolicy, Iter>)
+        {
+            HPX_UNUSED(policy);
+
+            auto sink = [&](auto&& value) {
+                init = HPX_INVOKE(
+                    r, HPX_MOVE(init), HPX_FORWARD(decltype(value), value));
+            };
+            pipeline_loop(first, last, stages, sink);
+
+            return util::detail::algorithm_result<ExPolicy, T>::get(
+                HPX_MOVE(init));
+        }
+        else
+        {
+            std::size_t const count = detail::distance(first, last);
+            if (count == 0)
+            {
+                return util::detail::algorithm_result<ExPolicy, T>::get(
+                    HPX_MOVE(init));
+            }
+
+            // partitions for which all values were filtered out don't
+            // contribute to the result
+            auto f1 = [stages, r](Iter part_begin,
+                          std::size_t part_size) -> hpx::optional<T> {
+                hpx::optional<T> partial;
+                auto sink = [&](auto&& value) {
+                    if (partial)
+                    {
+                        *partial = HPX_INVOKE(r, HPX_MOVE(*partial),
+                            HPX_FORWARD(decltype(value), value));
+                    }
+                    else
+                    {
+                        partial.emplace(HPX_FORWARD(decltype(value), value));
+                    }
+                };
+                pipeline_loop_n<ExPolicy>(part_begin, part_size, stages, sink);
+                return partial;
+            };
+
+            auto f2 = [init = HPX_MOVE(init), r = HPX_FORWARD(Reduce, r)](
+                          auto&& results) mutable -> T {
+                for (auto& partial : results)
+                {
+                    if (partial)
+                    {
+                        init = HPX_INVOKE(
+                            r, HPX_MOVE(init), HPX_MOVE(*partial));
+                    }
+                }
+                return HPX_MOVE(init);
+            };
+
+            return util::partitioner<ExPolicy, T, hpx::optional<T>>::call(
+                HPX_FORWARD(ExPolicy, policy), first, count, HPX_MOVE(f1),
+                hpx::unwrapping(HPX_MOVE(f2)));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Count the values produced by the stages.
+    template <typename ExPolicy, typename Iter, typename Sent, typename Stages>
+    util::detail::algorithm_result_t<ExPolicy, std::size_t> pipeline_count(
+        ExPolicy&& policy, Iter first, Sent last, Stages const& stages)
+    {
+        auto count_values = [](std::size_t count, auto&&) {
+            return count + 1;
+        };
+
+        if constexpr (run_pipeline_sequentially_v<ExPolicy, Iter>)
+        {
+            return pipeline_reduce(HPX_FORWARD(ExPolicy, policy), first, last,
+                stages, std::size_t(0), count_values);
+        }
+        else
+        {
+            std::size_t const count = detail::distance(first, last);
+            if (count == 0)
+            {
+                return util::detail::algorithm_result<ExPolicy,
+                    std::size_t>::get(std::size_t(0));
+            }
+
+            auto f1 = [stages](Iter part_begin,
+                          std::size_t part_size) -> std::size_t {
+                std::size_t partial = 0;
+                auto sink = [&](auto&&) { ++partial; };
+                pipeline_loop_n<ExPolicy>(part_begin, part_size, stages, sink);
+                return partial;
+            };
+
+            auto f2 = [](auto&& results) -> std::size_t {
+                std::size_t count = 0;
+                for (std::size_t partial : results)
+                {
+                    count += partial;
+                }
+                return count;
+            };
+
+            return util::partitioner<ExPolicy, std::size_t>::call(
+                HPX_FORWARD(ExPolicy, policy), first, count, HPX_MOVE(f1),
+                hpx::unwrapping(HPX_MOVE(f2)));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Invoke the given function for each value produced by the stages.
+    template <typename ExPolicy, typename Iter, typename Sent, typename Stages,
+        typename F>
+    util::detail::algorithm_result_t<ExPolicy> pipeline_for_each(
+        ExPolicy&& policy, Iter first, Sent last, Stages const& stages, F&& f)
+    {
+        if constexpr (run_pipeline_sequentially_v<ExPolicy, Iter>)
+        {
+            HPX_UNUSED(policy);
+
+            auto sink = [&](auto&& value) {
+                HPX_INVOKE(f, HPX_FORWARD(decltype(value), value));
+            };
+            pipeline_loop(first, last, stages, sink);
+
+            return util::detail::algorithm_result<ExPolicy>::get();
+        }
+        else
+        {
+            std::size_t const count = detail::distance(first, last);
+            if (count == 0)
+            {
+                return util::detail::algorithm_result<ExPolicy>::get();
+            }
+
+            auto f1 = [stages, f = HPX_FORWARD(F, f)](Iter part_begin,
+                          std::size_t part_size, std::size_t) mutable {
+                auto sink = [&](auto&& value) {
+                    HPX_INVOKE(f, HPX_FORWARD(decltype(value), value));
+                };
+                pipeline_loop_n<ExPolicy>(part_begin, part_size, stages, sink);
+            };
+
+            using partitioner_type = util::foreach_partitioner<ExPolicy>;
+            if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+            {
+                return util::detail::algorithm_result<ExPolicy>::get(
+                    partitioner_type::call(HPX_FORWARD(ExPolicy, policy),
+                        first, count, HPX_MOVE(f1),
+                        util::projection_identity()));
+            }
+            else
+            {
+                partitioner_type::call(HPX_FORWARD(ExPolicy, policy), first,
+                    count, HPX_MOVE(f1), util::projection_identity());
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Collect the values produced by the stages, preserving their order.
+    // This is the only terminal operation which materializes the values.
+    template <typename T, typename ExPolicy, typename Iter, typename Sent,
+        typename Stages>
+    util::detail::algorithm_result_t<ExPolicy, std::vector<T>>
+    pipeline_to_vector(
+        ExPolicy&& policy, Iter first, Sent last, Stages const& stages)
+    {
+        if constexpr (run_pipeline_sequentially_v<ExPolicy, Iter>)
+        {
+            HPX_UNUSED(policy);
+
+            std::vector<T> values;
+            auto sink = [&](auto&& value) {
+                values.emplace_back(HPX_FORWARD(decltype(value), value));
+            };
+            pipeline_loop(first, last, stages, sink);
+
+            return util::detail::algorithm_result<ExPolicy,
+                std::vector<T>>::get(HPX_MOVE(values));
+        }
+        else
+        {
+            std::size_t const count = detail::distance(first, last);
+            if (count == 0)
+            {
+                return util::detail::algorithm_result<ExPolicy,
+                    std::vector<T>>::get(std::vector<T>());
+            }
+
+            auto f1 = [stages](Iter part_begin,
+                          std::size_t part_size) -> std::vector<T> {
+                std::vector<T> partial;
+                partial.reserve(part_size);
+                auto sink = [&](auto&& value) {
+                    partial.emplace_back(HPX_FORWARD(decltype(value), value));
+                };
+                pipeline_loop_n<ExPolicy>(part_begin, part_size, stages, sink);
+                return partial;
+            };
+
+            // the partial results are ordered by partition
+            auto f2 = [](auto&& results) -> std::vector<T> {
+                std::size_t size = 0;
+                for (auto const& partial : results)
+                {
+                    size += partial.size();
+                }
+
+                std::vector<T> values;
+                values.reserve(size);
+                for (auto& partial : results)
+                {
+                    std::move(partial.begin(), partial.end(),
+                        std::back_inserter(values));
+                }
+                return values;
+            };
+
+            return util::partitioner<ExPolicy, std::vector<T>>::call(
+                HPX_FORWARD(ExPolicy, policy), first, count, HPX_MOVE(f1),
+                hpx::unwrapping(HPX_MOVE(f2)));
+        }
+    }
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
+
+namespace hpx::experimental::pipeline {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A lazily composed sequence of element-wise operations over a range.
+    ///
+    /// Element-wise stages (\a transform, \a filter) appended to a pipeline
+    /// are fused with the stages before them and do not touch the input
+    /// range. Applying a terminal operation (\a reduce, \a count,
+    /// \a for_each, \a to_vector) runs all stages in a single partitioned
+    /// pass over the input, without materializing intermediate sequences.
+    /// The terminal operation is the only point of synchronization.
+    ///
+    /// The result of a terminal operation is a \a hpx::future if the
+    /// execution policy of the pipeline is a task policy. Otherwise the
+    /// result is returned directly. Terminal operations do not return
+    /// senders.
+    template <typename ExPolicy, typename Iter, typename Sent, typename Stages>
+    class view
+    {
+    public:
+        using reference = typename std::iterator_traits<Iter>::reference;
+
+        /// The type of the values produced by the last stage.
+        using value_type =
+            std::decay_t<typename Stages::template result_type<reference>>;
+
+        template <typename ExPolicy_, typename Stages_>
+        constexpr view(
+            ExPolicy_&& policy, Iter first, Sent last, Stages_&& stages)
+          : policy_(HPX_FORWARD(ExPolicy_, policy))
+          , first_(HPX_MOVE(first))
+          , last_(HPX_MOVE(last))
+          , stages_(HPX_FORWARD(Stages_, stages))
+        {
+        }
+
+        constexpr ExPolicy const& policy() const noexcept
+        {
+            return policy_;
+        }
+
+        constexpr Iter begin() const
+        {
+            return first_;
+        }
+
+        constexpr Sent end() const
+        {
+            return last_;
+        }
+
+        constexpr Stages const& stages() const noexcept
+        {
+            return stages_;
+        }
+
+    private:
+        ExPolicy policy_;
+        Iter first_;
+        Sent last_;
+        Stages stages_;
+    };
+
+    /// Create a pipeline over the given range, using the given execution
+    /// policy for all terminal operations applied to it.
+    ///
+    /// \note The range has to stay alive until the result of the terminal
+    ///       operation is available.
+    // clang-format off
+    template <typename ExPolicy, typename Rng,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_range_v<Rng>
+        )>
+    // clang-format on
+    auto from(ExPolicy&& policy, Rng&& rng)
+    {
+        using iterator_type = hpx::traits::range_iterator_t<Rng>;
+        using sentinel_type = hpx::traits::range_sentinel_t<Rng>;
+
+        return view<std::decay_t<ExPolicy>, iterator_type, sentinel_type,
+            hpx::parallel::v1::detail::pipeline_source>(
+            HPX_FORWARD(ExPolicy, policy), hpx::util::begin(rng),
+            hpx::util::end(rng), hpx::parallel::v1::detail::pipeline_source{});
+    }
+
+    /// Create a pipeline over the given range, all terminal operations
+    /// applied to it are executed sequentially.
+    // clang-format off
+    template <typename Rng,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_range_v<Rng>
+        )>
+    // clang-format on
+    auto from(Rng&& rng)
+    {
+        return pipeline::from(hpx::execution::seq, HPX_FORWARD(Rng, rng));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        /// \cond NOINTERNAL
+        template <typename F>
+        struct pipeline_transform
+        {
+            F f;
+        };
+
+        template <typename Pred>
+        struct pipeline_filter
+        {
+            Pred pred;
+        };
+
+        template <typename T, typename Reduce>
+        struct pipeline_reduce
+        {
+            T init;
+            Reduce r;
+        };
+
+        struct pipeline_count
+        {
+        };
+
+        template <typename F>
+        struct pipeline_for_each
+        {
+            F f;
+        };
+
+        struct pipeline_to_vector
+        {
+        };
+        /// \endcond
+    }    // namespace detail
+
+    /// Element-wise stage replacing each value with the result of invoking
+    /// \a f on it.
+    template <typename F>
+    constexpr detail::pipeline_transform<std::decay_t<F>> transform(F&& f)
+    {
+        return {HPX_FORWARD(F, f)};
+    }
+
+    /// Element-wise stage dropping all values for which \a pred returns
+    /// false.
+    template <typename Pred>
+    constexpr detail::pipeline_filter<std::decay_t<Pred>> filter(Pred&& pred)
+    {
+        return {HPX_FORWARD(Pred, pred)};
+    }
+
+    /// Terminal operation returning GENERALIZED_SUM(r, init, values...) of
+    /// the values produced by the pipeline.
+    template <typename T, typename Reduce>
+    constexpr detail::pipeline_reduce<T, std::decay_t<Reduce>> reduce(
+        T init, Reduce&& r)
+    {
+        return {HPX_MOVE(init), HPX_FORWARD(Reduce, r)};
+    }
+
+    /// Terminal operation returning the sum of the values produced by the
+    /// pipeline and \a init.
+    template <typename T>
+    constexpr detail::pipeline_reduce<T, std::plus<>> reduce(T init)
+    {
+        return {HPX_MOVE(init), std::plus<>{}};
+    }
+
+    /// Terminal operation returning the number of values produced by the
+    /// pipeline.
+    constexpr detail::pipeline_count count() noexcept
+    {
+        return {};
+    }
+
+    /// Terminal operation invoking \a f for each value produced by the
+    /// pipeline, in unspecified order for parallel execution policies.
+    template <typename F>
+    constexpr detail::pipeline_for_each<std::decay_t<F>> for_each(F&& f)
+    {
+        return {HPX_FORWARD(F, f)};
+    }
+
+    /// Terminal operation collecting the values produced by the pipeline
+    /// into a std::vector, preserving their order. The result can be used as
+    /// the input of algorithms that cannot be fused, e.g. \a hpx::sort.
+    constexpr detail::pipeline_to_vector to_vector() noexcept
+    {
+        return {};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename Sent, typename Stages,
+        typename F>
+    auto operator|(view<ExPolicy, Iter, Sent, Stages> p,
+        detail::pipeline_transform<F> t)
+    {
+        using stages_type =
+            hpx::parallel::v1::detail::pipeline_transform_stage<Stages, F>;
+
+        return view<ExPolicy, Iter, Sent, stages_type>(p.policy(),
+            p.begin(), p.end(), stages_type{p.stages(), HPX_MOVE(t.f)});
+    }
+
+    template <typename ExPolicy, typename Iter, typename Sent, typename Stages,
+        typename Pred>
+    auto operator|(view<ExPolicy, Iter, Sent, Stages> p,
+        detail::pipeline_filter<Pred> f)
+    {
+        using stages_type =
+            hpx::parallel::v1::detail::pipeline_filter_stage<Stages, Pred>;
+
+        return view<ExPolicy, Iter, Sent, stages_type>(p.policy(),
+            p.begin(), p.end(), stages_type{p.stages(), HPX_MOVE(f.pred)});
+    }
+
+    template <typename ExPolicy, typename Iter, typename Sent, typename Stages,
+        typename T, typename Reduce>
+    auto operator|(view<ExPolicy, Iter, Sent, Stages> const& p,
+        detail::pipeline_reduce<T, Reduce> r)
+    {
+        return hpx::parallel::v1::detail::pipeline_reduce(p.policy(),
+            p.begin(), p.end(), p.stages(), HPX_MOVE(r.init), HPX_MOVE(r.r));
+    }
+
+    template <typename ExPolicy, typename Iter, typename Sent, typename Stages>
+    auto operator|(view<ExPolicy, Iter, Sent, Stages> const& p,
+        detail::pipeline_count)
+    {
+        return hpx::parallel::v1::detail::pipeline_count(
+            p.policy(), p.begin(), p.end(), p.stages());
+    }
+
+    template <typename ExPolicy, typename Iter, typename Sent, typename Stages,
+        typename F>
+    auto operator|(view<ExPolicy, Iter, Sent, Stages> const& p,
+        detail::pipeline_for_each<F> f)
+    {
+        return hpx::parallel::v1::detail::pipeline_for_each(
+            p.policy(), p.begin(), p.end(), p.stages(), HPX_MOVE(f.f));
+    }
+
+    template <typename ExPolicy, typename Iter, typename Sent, typename Stages>
+    auto operator|(view<ExPolicy, Iter, Sent, Stages> const& p,
+        detail::pipeline_to_vector)
+    {
+        using value_type =
+            typename view<ExPolicy, Iter, Sent, Stages>::value_type;
+
+        return hpx::parallel::v1::detail::pipeline_to_vector<value_type>(
+            p.policy(), p.begin(), p.end(), p.stages());
+    }
+}    // namespace hpx::experimental::pipeline
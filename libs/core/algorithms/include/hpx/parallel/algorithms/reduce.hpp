@@ -224,9 +224,11 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/accumulate.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/reduce.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
 
 #include <algorithm>
 #include <cstddef>
@@ -254,8 +256,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static T sequential(
                 ExPolicy, InIterB first, InIterE last, T_&& init, Reduce&& r)
             {
-                return detail::accumulate(
-                    first, last, HPX_FORWARD(T_, init), HPX_FORWARD(Reduce, r));
+                return sequential_reduce<ExPolicy>(first, last,
+                    T(HPX_FORWARD(T_, init)), HPX_FORWARD(Reduce, r),
+                    util::projection_identity{});
             }
 
             template <typename ExPolicy, typename FwdIterB, typename FwdIterE,
@@ -272,8 +275,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 auto f1 = [r](FwdIterB part_begin, std::size_t part_size) -> T {
                     T val = *part_begin;
-                    return util::accumulate_n(
-                        ++part_begin, --part_size, HPX_MOVE(val), r);
+                    return sequential_reduce_n<std::decay_t<ExPolicy>>(
+                        ++part_begin, --part_size, HPX_MOVE(val), r,
+                        util::projection_identity{});
                 };
 
                 return util::partitioner<ExPolicy, T>::call(
@@ -244,6 +244,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/is_sorted.hpp>
 #include <hpx/parallel/algorithms/detail/pivot.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -446,6 +447,20 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 try
                 {
+                    // arithmetic keys are sorted using a radix sort
+                    if constexpr (use_radix_sort_v<RandomIt, Comp, Proj>)
+                    {
+                        std::size_t const count = last - first;
+                        if (count >= radix_sort_min_size)
+                        {
+                            return algorithm_result::get(
+                                parallel_radix_sort_async<
+                                    (radix_sort_order_v<RandomIt, Comp> < 0)>(
+                                    HPX_FORWARD(ExPolicy, policy), first,
+                                    radix_sort_no_values(), count, last));
+                        }
+                    }
+
                     // call the sort routine and return the right type,
                     // depending on execution policy
                     return algorithm_result::get(parallel_sort_async(
@@ -10,10 +10,12 @@
 #include <hpx/config.hpp>
 #include <hpx/datastructures/tuple.hpp>
 
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/algorithms/sort.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -134,6 +136,23 @@ namespace hpx { namespace parallel { inline namespace v1 {
         ValueIter value_last = value_first;
         std::advance(value_last, std::distance(key_first, key_last));
 
+        // arithmetic keys are sorted using a radix sort, the values are
+        // moved only once
+        if constexpr (!hpx::is_sequenced_execution_policy_v<ExPolicy> &&
+            detail::use_radix_sort_by_key_v<KeyIter, ValueIter, Compare>)
+        {
+            std::size_t const count = std::distance(key_first, key_last);
+            if (count >= detail::radix_sort_min_size)
+            {
+                using result_type = sort_by_key_result<KeyIter, ValueIter>;
+                return util::detail::algorithm_result<ExPolicy,
+                    result_type>::get(detail::parallel_radix_sort_async<(
+                        detail::radix_sort_order_v<KeyIter, Compare> < 0)>(
+                    HPX_FORWARD(ExPolicy, policy), key_first, value_first,
+                    count, result_type(key_last, value_last)));
+            }
+        }
+
         using iterator_type = hpx::util::zip_iterator<KeyIter, ValueIter>;
 
         return detail::get_iter_pair<iterator_type>(
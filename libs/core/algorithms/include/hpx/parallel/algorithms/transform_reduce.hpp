@@ -267,6 +267,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/accumulate.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/reduce.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
@@ -335,17 +336,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
             HPX_HOST_DEVICE HPX_FORCEINLINE T operator()(
                 Iter part_begin, std::size_t part_size)
             {
-                using reference =
-                    typename std::iterator_traits<Iter>::reference;
-
                 T val = HPX_INVOKE(convert_, *part_begin);
-                return util::accumulate_n(++part_begin, --part_size,
-                    HPX_MOVE(val),
-                    [HPX_CXX20_CAPTURE_THIS(=)](
-                        T const& res, reference next) mutable -> T {
-                        return HPX_INVOKE(
-                            reduce_, res, HPX_INVOKE(convert_, next));
-                    });
+                return sequential_reduce_n<execution_policy_type>(++part_begin,
+                    --part_size, HPX_MOVE(val), reduce_, convert_);
             }
         };
 
@@ -363,13 +356,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static T sequential(ExPolicy, Iter first, Sent last, T_&& init,
                 Reduce&& r, Convert&& conv)
             {
-                using value_type =
-                    typename std::iterator_traits<Iter>::value_type;
-
-                return detail::accumulate(first, last, HPX_FORWARD(T_, init),
-                    [&r, &conv](T const& res, value_type const& next) -> T {
-                        return HPX_INVOKE(r, res, HPX_INVOKE(conv, next));
-                    });
+                return sequential_reduce<ExPolicy>(first, last,
+                    T(HPX_FORWARD(T_, init)), HPX_FORWARD(Reduce, r),
+                    HPX_FORWARD(Convert, conv));
             }
 
             template <typename ExPolicy, typename Iter, typename Sent,
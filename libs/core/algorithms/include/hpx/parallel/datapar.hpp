@@ -20,9 +20,13 @@
 #include <hpx/parallel/datapar/generate.hpp>
 #include <hpx/parallel/datapar/iterator_helpers.hpp>
 #include <hpx/parallel/datapar/loop.hpp>
+#include <hpx/parallel/datapar/minmax.hpp>
 #include <hpx/parallel/datapar/mismatch.hpp>
+#include <hpx/parallel/datapar/reduce.hpp>
+#include <hpx/parallel/datapar/scan.hpp>
 #include <hpx/parallel/datapar/transfer.hpp>
 #include <hpx/parallel/datapar/transform_loop.hpp>
+#include <hpx/parallel/datapar/transparent_operation.hpp>
 #include <hpx/parallel/datapar/zip_iterator.hpp>
 
 #endif
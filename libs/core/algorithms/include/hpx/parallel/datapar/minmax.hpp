@@ -0,0 +1,293 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_all_any_none.hpp>
+#include <hpx/execution/traits/vector_pack_conditionals.hpp>
+#include <hpx/execution/traits/vector_pack_find.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/minmax.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/datapar/transparent_operation.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The search for the smallest and largest elements can be vectorized if
+    // the comparison can be applied to packs of elements (yielding a mask)
+    // and to an element and a pack.
+    template <typename Iter, typename F, typename Proj, typename Enable = void>
+    struct is_datapar_minmax : std::false_type
+    {
+    };
+
+    template <typename Iter, typename F>
+    struct is_datapar_minmax<Iter, F, util::projection_identity,
+        std::enable_if_t<
+            util::detail::iterator_datapar_compatible<Iter>::value>>
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = typename traits::vector_pack_type<value_type>::type;
+
+        template <typename Comp>
+        static auto test(int)
+            -> decltype(traits::choose(
+                            HPX_INVOKE(std::declval<Comp&>(), std::declval<V>(),
+                                std::declval<V>()),
+                            std::declval<V>(), std::declval<V>()),
+                traits::find_first_of(!HPX_INVOKE(std::declval<Comp&>(),
+                    std::declval<value_type>(), std::declval<V>())),
+                traits::any_of(!HPX_INVOKE(std::declval<Comp&>(),
+                    std::declval<V>(), std::declval<value_type>())),
+                std::true_type());
+
+        template <typename Comp>
+        static std::false_type test(...);
+
+        static constexpr bool value = decltype(test<
+            util::detail::transparent_operation_t<std::decay_t<F>,
+                value_type>>(0))::value;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct datapar_minmax
+    {
+        // Calculate the smallest and the largest value in [it, it + count),
+        // count must not be zero.
+        template <typename Iter, typename F, typename Value>
+        static void values(Iter it, std::size_t count, F const& f,
+            Value& min_value, Value& max_value)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            using V = typename traits::vector_pack_type<value_type>::type;
+            using load = traits::vector_pack_load<V, value_type>;
+
+            static constexpr std::size_t size =
+                traits::vector_pack_size<V>::value;
+
+            auto reduce_scalar = [&](value_type const& curr) {
+                if (HPX_INVOKE(f, curr, min_value))
+                    min_value = curr;
+                if (HPX_INVOKE(f, max_value, curr))
+                    max_value = curr;
+            };
+
+            min_value = *it;
+            max_value = min_value;
+            for (--count, ++it;
+                 !util::detail::is_data_aligned(it) && count != 0;
+                 (void) --count, ++it)
+            {
+                reduce_scalar(*it);
+            }
+
+            if (count >= size)
+            {
+                V min_pack = load::aligned(it);
+                V max_pack = min_pack;
+                std::advance(it, size);
+                count -= size;
+
+                for (/**/; count >= size; count -= size)
+                {
+                    V curr = load::aligned(it);
+                    min_pack = traits::choose(
+                        HPX_INVOKE(f, curr, min_pack), curr, min_pack);
+                    max_pack = traits::choose(
+                        HPX_INVOKE(f, max_pack, curr), curr, max_pack);
+                    std::advance(it, size);
+                }
+
+                for (std::size_t i = 0; i != size; ++i)
+                {
+                    reduce_scalar(value_type(min_pack[i]));
+                    reduce_scalar(value_type(max_pack[i]));
+                }
+            }
+
+            for (/**/; count != 0; (void) --count, ++it)
+            {
+                reduce_scalar(*it);
+            }
+        }
+
+        // Find the first element in [it, it + count) for which the predicate
+        // holds. The predicate is applied to packs of elements.
+        template <typename Iter, typename Pred>
+        static Iter find_first(Iter it, std::size_t count, Pred&& pred)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            using V = typename traits::vector_pack_type<value_type>::type;
+            using load = traits::vector_pack_load<V, value_type>;
+
+            static constexpr std::size_t size =
+                traits::vector_pack_size<V>::value;
+
+            for (/**/; count >= size; count -= size)
+            {
+                int offset = traits::find_first_of(pred(load::unaligned(it)));
+                if (offset != -1)
+                {
+                    return std::next(it, offset);
+                }
+                std::advance(it, size);
+            }
+
+            for (/**/; count != 0; (void) --count, ++it)
+            {
+                if (pred(*it))
+                    break;
+            }
+            return it;
+        }
+
+        // Find the last element in [it, it + count) for which the predicate
+        // holds. The predicate is applied to packs of elements.
+        template <typename Iter, typename Pred>
+        static Iter find_last(Iter it, std::size_t count, Pred&& pred)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            using V = typename traits::vector_pack_type<value_type>::type;
+            using load = traits::vector_pack_load<V, value_type>;
+
+            static constexpr std::size_t size =
+                traits::vector_pack_size<V>::value;
+
+            Iter last = std::next(it, count);
+            for (/**/; count >= size; count -= size)
+            {
+                std::advance(last, -std::ptrdiff_t(size));
+                if (traits::any_of(pred(load::unaligned(last))))
+                {
+                    for (std::size_t i = size; i != 0; --i)
+                    {
+                        Iter curr = std::next(last, i - 1);
+                        if (pred(*curr))
+                            return curr;
+                    }
+                }
+            }
+
+            while (count-- != 0)
+            {
+                if (pred(*--last))
+                    break;
+            }
+            return last;
+        }
+
+        template <typename Iter, typename F>
+        static Iter min_element(Iter it, std::size_t count, F const& f)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+
+            value_type min_value, max_value;
+            values(it, count, f, min_value, max_value);
+
+            // the first element not larger than the smallest value
+            return find_first(it, count, [&](auto const& curr) {
+                return !HPX_INVOKE(f, min_value, curr);
+            });
+        }
+
+        template <typename Iter, typename F>
+        static Iter max_element(Iter it, std::size_t count, F const& f)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+
+            value_type min_value, max_value;
+            values(it, count, f, min_value, max_value);
+
+            // the last element not smaller than the largest value
+            return find_last(it, count, [&](auto const& curr) {
+                return !HPX_INVOKE(f, curr, max_value);
+            });
+        }
+
+        template <typename Iter, typename F>
+        static util::min_max_result<Iter> minmax_element(
+            Iter it, std::size_t count, F const& f)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+
+            value_type min_value, max_value;
+            values(it, count, f, min_value, max_value);
+
+            return {find_first(it, count,
+                        [&](auto const& curr) {
+                            return !HPX_INVOKE(f, min_value, curr);
+                        }),
+                find_last(it, count, [&](auto const& curr) {
+                    return !HPX_INVOKE(f, curr, max_value);
+                })};
+        }
+    };
+
+    template <typename ExPolicy, typename Iter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_minmax<Iter, F, Proj>::value)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter tag_invoke(
+        sequential_min_element_t<ExPolicy>, Iter it, std::size_t count,
+        F const& f, Proj const&)
+    {
+        if (count == 0 || count == 1)
+            return it;
+
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        return datapar_minmax<ExPolicy>::min_element(it, count,
+            util::detail::transparent_operation<F, value_type>::call(f));
+    }
+
+    template <typename ExPolicy, typename Iter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_minmax<Iter, F, Proj>::value)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter tag_invoke(
+        sequential_max_element_t<ExPolicy>, Iter it, std::size_t count,
+        F const& f, Proj const&)
+    {
+        if (count == 0 || count == 1)
+            return it;
+
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        return datapar_minmax<ExPolicy>::max_element(it, count,
+            util::detail::transparent_operation<F, value_type>::call(f));
+    }
+
+    template <typename ExPolicy, typename Iter, typename F, typename Proj,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_minmax<Iter, F, Proj>::value)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE util::min_max_result<Iter> tag_invoke(
+        sequential_minmax_element_t<ExPolicy>, Iter it, std::size_t count,
+        F const& f, Proj const&)
+    {
+        if (count == 0 || count == 1)
+            return {it, it};
+
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        return datapar_minmax<ExPolicy>::minmax_element(it, count,
+            util::detail::transparent_operation<F, value_type>::call(f));
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+#endif
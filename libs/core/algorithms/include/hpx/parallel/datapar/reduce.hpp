@@ -0,0 +1,152 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/reduce.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/datapar/loop.hpp>
+#include <hpx/parallel/datapar/transparent_operation.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The reduction can be vectorized if the conversion turns a pack of
+    // elements into a pack of the reduction type and if the reduction
+    // operation combines two of those packs into another one.
+    template <typename Iter, typename T, typename Reduce, typename Conv,
+        typename Enable = void>
+    struct is_datapar_reduce : std::false_type
+    {
+    };
+
+    template <typename Iter, typename T, typename Reduce, typename Conv>
+    struct is_datapar_reduce<Iter, T, Reduce, Conv,
+        std::enable_if_t<
+            util::detail::iterator_datapar_compatible<Iter>::value &&
+            std::is_arithmetic_v<T>>>
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = typename traits::vector_pack_type<value_type>::type;
+        using VT = typename traits::vector_pack_type<T>::type;
+
+        template <typename R, typename C>
+        static auto test(int)
+            -> std::conjunction<
+                std::is_same<std::decay_t<decltype(HPX_INVOKE(
+                                 std::declval<C&>(), std::declval<V>()))>,
+                    VT>,
+                std::is_same<std::decay_t<decltype(HPX_INVOKE(
+                                 std::declval<R&>(), std::declval<VT>(),
+                                 std::declval<VT>()))>,
+                    VT>>;
+
+        template <typename R, typename C>
+        static std::false_type test(...);
+
+        static constexpr bool value = decltype(test<
+            util::detail::transparent_operation_t<std::decay_t<Reduce>, T>,
+            std::decay_t<Conv>>(0))::value;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy>
+    struct datapar_reduce
+    {
+        template <typename Iter, typename T, typename Reduce, typename Conv>
+        static T call(
+            Iter first, std::size_t count, T init, Reduce&& r, Conv&& conv)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+            using V = typename traits::vector_pack_type<value_type>::type;
+            using load = traits::vector_pack_load<V, value_type>;
+
+            static constexpr std::size_t size =
+                traits::vector_pack_size<V>::value;
+
+            auto&& op = util::detail::transparent_operation<
+                std::decay_t<Reduce>, T>::call(r);
+
+            // handle the elements in front of the first aligned pack
+            for (/**/; !util::detail::is_data_aligned(first) && count != 0;
+                 (void) --count, ++first)
+            {
+                init = HPX_INVOKE(op, HPX_MOVE(init), HPX_INVOKE(conv, *first));
+            }
+
+            if (count >= size)
+            {
+                // reduce all full packs into a single one, then combine its
+                // elements
+                auto part_sum = HPX_INVOKE(conv, load::aligned(first));
+                std::advance(first, size);
+                count -= size;
+
+                for (/**/; count >= size; count -= size)
+                {
+                    part_sum = HPX_INVOKE(
+                        op, part_sum, HPX_INVOKE(conv, load::aligned(first)));
+                    std::advance(first, size);
+                }
+
+                init = util::detail::extract_value<ExPolicy>(
+                    util::detail::accumulate_values<ExPolicy>(
+                        [&op](T const& sum, T const& val) -> T {
+                            return HPX_INVOKE(op, sum, val);
+                        },
+                        part_sum, HPX_MOVE(init)));
+            }
+
+            // handle the remainder
+            for (/**/; count != 0; (void) --count, ++first)
+            {
+                init = HPX_INVOKE(op, HPX_MOVE(init), HPX_INVOKE(conv, *first));
+            }
+            return init;
+        }
+    };
+
+    template <typename ExPolicy, typename Iter, typename Sent, typename T,
+        typename Reduce, typename Conv,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_reduce<Iter, T, Reduce, Conv>::value)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE T tag_invoke(sequential_reduce_t<ExPolicy>,
+        Iter first, Sent last, T init, Reduce&& r, Conv&& conv)
+    {
+        return datapar_reduce<ExPolicy>::call(first,
+            detail::distance(first, last), HPX_MOVE(init),
+            HPX_FORWARD(Reduce, r), HPX_FORWARD(Conv, conv));
+    }
+
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce,
+        typename Conv,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_reduce<Iter, T, Reduce, Conv>::value)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE T tag_invoke(
+        sequential_reduce_n_t<ExPolicy>, Iter first, std::size_t count, T init,
+        Reduce&& r, Conv&& conv)
+    {
+        return datapar_reduce<ExPolicy>::call(first, count, HPX_MOVE(init),
+            HPX_FORWARD(Reduce, r), HPX_FORWARD(Conv, conv));
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+#endif
@@ -0,0 +1,81 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/parallel/algorithms/detail/scan.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/datapar/loop.hpp>
+#include <hpx/parallel/datapar/transparent_operation.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Applying the prefix of a partition can be vectorized if the scan
+    // operation combines the prefix with a pack of elements into another pack
+    // of elements (this includes the scalar packs used for the elements in
+    // front of the first aligned pack).
+    template <typename Iter, typename T, typename Op, typename Enable = void>
+    struct is_datapar_apply_prefix : std::false_type
+    {
+    };
+
+    template <typename Iter, typename T, typename Op>
+    struct is_datapar_apply_prefix<Iter, T, Op,
+        std::enable_if_t<
+            util::detail::iterator_datapar_compatible<Iter>::value>>
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using V = typename traits::vector_pack_type<value_type>::type;
+        using V1 = typename traits::vector_pack_type<value_type, 1>::type;
+
+        template <typename F, typename Pack>
+        using is_pack_result = std::is_same<
+            std::decay_t<decltype(HPX_INVOKE(std::declval<F&>(),
+                std::declval<T const&>(), std::declval<Pack>()))>,
+            Pack>;
+
+        template <typename F>
+        static auto test(int)
+            -> std::conjunction<is_pack_result<F, V>, is_pack_result<F, V1>>;
+
+        template <typename F>
+        static std::false_type test(...);
+
+        static constexpr bool value = decltype(test<
+            util::detail::transparent_operation_t<std::decay_t<Op>,
+                value_type>>(0))::value;
+    };
+
+    template <typename ExPolicy, typename Iter, typename T, typename Op,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value&&
+                is_datapar_apply_prefix<Iter, T, Op>::value)>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Iter tag_invoke(
+        sequential_apply_prefix_n_t<ExPolicy>, Iter it, std::size_t count,
+        T const& prefix, Op&& op)
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        auto&& f = util::detail::transparent_operation<std::decay_t<Op>,
+            value_type>::call(op);
+
+        return util::loop_n_ind<std::decay_t<ExPolicy>>(
+            it, count, [&](auto& v) { v = HPX_INVOKE(f, prefix, v); });
+    }
+}}}}    // namespace hpx::parallel::v1::detail
+#endif
@@ -0,0 +1,61 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <functional>
+
+namespace hpx { namespace parallel { namespace util { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The standard function objects for a concrete type (e.g. std::plus<T>,
+    // the default operation of the reductions and scans) can't be invoked
+    // with vector packs. Replace those with their transparent counterparts,
+    // which perform the same operation on both, scalars and packs, if they
+    // operate on the element type of the sequence.
+    template <typename F, typename T>
+    struct transparent_operation
+    {
+        using type = F;
+
+        static constexpr F const& call(F const& f) noexcept
+        {
+            return f;
+        }
+    };
+
+#define HPX_DATAPAR_TRANSPARENT_OPERATION(op)                                  \
+    template <typename T>                                                      \
+    struct transparent_operation<std::op<T>, T>                                \
+    {                                                                          \
+        using type = std::op<>;                                                \
+                                                                               \
+        static constexpr type call(std::op<T> const&) noexcept                 \
+        {                                                                      \
+            return type{};                                                     \
+        }                                                                      \
+    };                                                                         \
+    /**/
+
+    HPX_DATAPAR_TRANSPARENT_OPERATION(plus)
+    HPX_DATAPAR_TRANSPARENT_OPERATION(minus)
+    HPX_DATAPAR_TRANSPARENT_OPERATION(multiplies)
+    HPX_DATAPAR_TRANSPARENT_OPERATION(bit_and)
+    HPX_DATAPAR_TRANSPARENT_OPERATION(bit_or)
+    HPX_DATAPAR_TRANSPARENT_OPERATION(bit_xor)
+    HPX_DATAPAR_TRANSPARENT_OPERATION(less)
+    HPX_DATAPAR_TRANSPARENT_OPERATION(greater)
+
+#undef HPX_DATAPAR_TRANSPARENT_OPERATION
+
+    template <typename F, typename T>
+    using transparent_operation_t = typename transparent_operation<F, T>::type;
+}}}}    // namespace hpx::parallel::util::detail
+
+#endif
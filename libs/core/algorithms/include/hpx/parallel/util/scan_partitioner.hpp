@@ -17,8 +17,10 @@
 #include <hpx/async_local/dataflow.hpp>
 #endif
 
+#include <hpx/datastructures/tuple.hpp>
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/this_thread.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -27,8 +29,10 @@
 #include <hpx/parallel/util/detail/select_partitioner.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <exception>
+#include <iterator>
 #include <list>
 #include <memory>
 #include <type_traits>
@@ -46,6 +50,40 @@ namespace hpx { namespace parallel { namespace util {
 
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        // The state a partition of a chained scan publishes for the
+        // partitions to its right. The aggregate (the result of the first
+        // step) is published as soon as it is known, the inclusive prefix as
+        // soon as the partitions to the left have published theirs.
+        template <typename Result>
+        struct scan_partition_state
+        {
+            enum : int
+            {
+                invalid = 0,
+                aggregate_available = 1,
+                prefix_available = 2,
+                failed = 3
+            };
+
+            std::atomic<int> status{invalid};
+            Result aggregate;
+            Result prefix;
+        };
+
+        // The partitions of a chained scan are small enough for the data
+        // touched by the first step to still be cached when the third step
+        // revisits it.
+        template <typename FwdIter>
+        constexpr std::size_t scan_partition_size() noexcept
+        {
+            constexpr std::size_t partition_bytes = 128 * 1024;
+            constexpr std::size_t value_size =
+                sizeof(typename std::iterator_traits<FwdIter>::value_type);
+            return (std::max)(std::size_t(1024),
+                partition_bytes / (std::max)(value_size, std::size_t(1)));
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // The static partitioner simply spawns one chunk of iterations for
         // each available core.
@@ -63,6 +101,15 @@ namespace hpx { namespace parallel { namespace util {
             using handle_local_exceptions =
                 detail::handle_local_exceptions<ExPolicy>;
 
+            // The scan is performed in a single pass over the data (a
+            // chained scan with decoupled look-back). The chunks are split
+            // into partitions small enough to stay in the cache between the
+            // first and the third step. Each task repeatedly claims the next
+            // partition, runs f1 on it, and publishes its aggregate. It then
+            // combines the aggregates of the partitions to its left (using f2)
+            // until it finds a partition that has already published its
+            // inclusive prefix, publishes its own inclusive prefix, and runs
+            // f3 on the partition.
             template <typename ExPolicy_, typename FwdIter, typename T,
                 typename F1, typename F2, typename F3, typename F4>
             static R call(scan_partitioner_normal_tag, ExPolicy_ policy,
@@ -81,20 +128,77 @@ namespace hpx { namespace parallel { namespace util {
                 HPX_ASSERT(false);
                 return R();
 #else
+                static_assert(std::is_void_v<Result2>,
+                    "the results of the third step are not collected");
+
+                using state_type = scan_partition_state<Result1>;
+
                 // inform parameter traits
                 scoped_executor_parameters scoped_params(
                     policy.parameters(), policy.executor());
 
-                std::vector<hpx::shared_future<Result1>> workitems;
+                std::vector<hpx::future<Result1>> workitems;
                 std::vector<hpx::future<Result2>> finalitems;
-                std::vector<Result1> f2results;
                 std::list<std::exception_ptr> errors;
+
+                // the partitions and their states, the state of the
+                // partitions is preceded by the state holding 'init' (and
+                // the state of the chunk used for testing the chunk size)
+                std::vector<hpx::tuple<FwdIter, std::size_t>> partitions;
+                std::unique_ptr<state_type[]> states;
+                std::size_t first_state = 1;
+                std::atomic<std::size_t> next_partition(0);
+
+                auto worker = [&]() -> void {
+                    std::size_t const num_partitions = partitions.size();
+                    for (std::size_t part = next_partition.fetch_add(1);
+                         part < num_partitions;
+                         part = next_partition.fetch_add(1))
+                    {
+                        FwdIter it = hpx::get<0>(partitions[part]);
+                        std::size_t const size = hpx::get<1>(partitions[part]);
+                        std::size_t const index = first_state + part;
+                        state_type& state = states[index];
+
+                        Result1 prefix;
+                        try
+                        {
+                            // the algorithms rely on f1 and f3 being invoked
+                            // on a fresh copy for each partition
+                            std::decay_t<F1> f1_(f1);
+                            state.aggregate = HPX_INVOKE(f1_, it, size);
+                            state.status.store(state_type::aggregate_available,
+                                std::memory_order_release);
+
+                            if (!look_back(states.get(), index, f2, prefix))
+                            {
+                                // a partition to the left has failed, its
+                                // exception is reported by its task
+                                state.status.store(state_type::failed,
+                                    std::memory_order_release);
+                                return;
+                            }
+
+                            state.prefix =
+                                HPX_INVOKE(f2, prefix, state.aggregate);
+                        }
+                        catch (...)
+                        {
+                            state.status.store(
+                                state_type::failed, std::memory_order_release);
+                            throw;
+                        }
+
+                        state.status.store(state_type::prefix_available,
+                            std::memory_order_release);
+
+                        std::decay_t<F3> f3_(f3);
+                        HPX_INVOKE(f3_, it, size, HPX_MOVE(prefix));
+                    }
+                };
+
                 try
                 {
-                    // pre-initialize first intermediate result
-                    workitems.push_back(
-                        make_ready_future(HPX_FORWARD(T, init)));
-
                     HPX_ASSERT(count > 0);
                     FwdIter first_ = first;
                     std::size_t count_ = count;
@@ -107,70 +211,65 @@ namespace hpx { namespace parallel { namespace util {
                         has_variable_chunk_size(), policy, workitems, f1, first,
                         count, 1);
 
-                    // schedule every chunk on a separate thread
-                    std::size_t size = hpx::util::size(shape);
+                    // split the chunks into partitions
+                    std::size_t const max_partition_size =
+                        scan_partition_size<FwdIter>();
+                    for (auto const& elem : shape)
+                    {
+                        FwdIter it = hpx::get<0>(elem);
+                        std::size_t const size = hpx::get<1>(elem);
+
+                        std::size_t const num_partitions =
+                            (size + max_partition_size - 1) /
+                            max_partition_size;
+                        for (std::size_t i = 0; i != num_partitions; ++i)
+                        {
+                            std::size_t const part_size =
+                                size / num_partitions +
+                                (i < size % num_partitions ? 1 : 0);
+                            partitions.emplace_back(it, part_size);
+                            std::advance(it, part_size);
+                        }
+                    }
 
                     // If the size of count was enough to warrant testing for a
-                    // chunk, pre-initialize second intermediate result and
-                    // start f3.
-                    if (workitems.size() == 2)
+                    // chunk, the chunk precedes all partitions.
+                    if (workitems.size() == 1)
                     {
                         HPX_ASSERT(count_ > count);
-
-                        workitems.reserve(size + 2);
-                        finalitems.reserve(size + 1);
-
-                        finalitems.push_back(
-                            execution::async_execute(policy.executor(), f3,
-                                first_, count_ - count, workitems[0].get()));
-
-                        workitems[1] = make_ready_future(HPX_INVOKE(
-                            f2, workitems[0].get(), workitems[1].get()));
-                    }
-                    else
-                    {
-                        workitems.reserve(size + 1);
-                        finalitems.reserve(size);
+                        first_state = 2;
                     }
 
-                    // Schedule first step of scan algorithm, step 2 is
-                    // performed when all f1 tasks are done
-                    for (auto const& elem : shape)
-                    {
-                        FwdIter it = hpx::get<0>(elem);
-                        std::size_t size = hpx::get<1>(elem);
-
-                        auto curr = execution::async_execute(
-                            policy.executor(), f1, it, size)
-                                        .share();
+                    states.reset(
+                        new state_type[first_state + partitions.size()]);
 
-                        workitems.push_back(curr);
-                    }
+                    states[0].prefix = HPX_FORWARD(T, init);
+                    states[0].status.store(state_type::prefix_available,
+                        std::memory_order_relaxed);
 
-                    // Wait for all f1 tasks to finish
-                    if (hpx::wait_all_nothrow(workitems))
+                    if (first_state == 2)
                     {
-                        handle_local_exceptions::call(workitems, errors);
-                    }
+                        states[1].aggregate = workitems[0].get();
+                        states[1].prefix = HPX_INVOKE(
+                            f2, states[0].prefix, states[1].aggregate);
+                        states[1].status.store(state_type::prefix_available,
+                            std::memory_order_relaxed);
 
-                    // perform f2 sequentially in one go
-                    f2results.resize(workitems.size());
-                    auto result = workitems[0].get();
-                    f2results[0] = result;
-                    for (std::size_t i = 1; i < workitems.size(); i++)
-                    {
-                        result = HPX_INVOKE(f2, result, workitems[i].get());
-                        f2results[i] = result;
+                        finalitems.push_back(
+                            execution::async_execute(policy.executor(), f3,
+                                first_, count_ - count, states[0].prefix));
                     }
 
-                    // start all f3 tasks
-                    std::size_t i = 0;
-                    for (auto const& elem : shape)
+                    // Partitions are claimed in order, a task waits only for
+                    // partitions claimed by tasks that have already started.
+                    std::size_t const num_tasks = (std::min)(
+                        std::size_t(hpx::util::size(shape)), partitions.size());
+
+                    finalitems.reserve(finalitems.size() + num_tasks);
+                    for (std::size_t i = 0; i != num_tasks; ++i)
                     {
                         finalitems.push_back(execution::async_execute(
-                            policy.executor(), f3, hpx::get<0>(elem),
-                            hpx::get<1>(elem), f2results[i]));
-                        i++;
+                            policy.executor(), worker));
                     }
 
                     scoped_params.mark_end_of_scheduling();
@@ -180,6 +279,21 @@ namespace hpx { namespace parallel { namespace util {
                     handle_local_exceptions::call(
                         std::current_exception(), errors);
                 }
+
+                // the inclusive prefixes of all partitions are passed on to
+                // f4, 'init' being the first
+                std::vector<Result1> f2results;
+                if (!hpx::wait_all_nothrow(finalitems) && errors.empty())
+                {
+                    std::size_t const num_states =
+                        first_state + partitions.size();
+                    f2results.reserve(num_states);
+                    for (std::size_t i = 0; i != num_states; ++i)
+                    {
+                        f2results.push_back(HPX_MOVE(states[i].prefix));
+                    }
+                }
+
                 return reduce(HPX_MOVE(f2results), HPX_MOVE(finalitems),
                     HPX_MOVE(errors), HPX_FORWARD(F4, f4));
 #endif
@@ -331,6 +445,59 @@ namespace hpx { namespace parallel { namespace util {
             }
 
         private:
+            // Combine the aggregates of the partitions to the left of the
+            // given one until a partition is found that has published its
+            // inclusive prefix. Returns false if one of the partitions has
+            // failed.
+            template <typename State, typename F2>
+            static bool look_back(
+                State* states, std::size_t index, F2& f2, Result1& prefix)
+            {
+                HPX_ASSERT(index != 0);
+
+                bool first = true;
+                while (index-- != 0)
+                {
+                    State& state = states[index];
+
+                    int status = State::invalid;
+                    hpx::util::yield_while(
+                        [&]() {
+                            status =
+                                state.status.load(std::memory_order_acquire);
+                            return status == State::invalid;
+                        },
+                        "scan_partitioner::look_back");
+
+                    if (status == State::failed)
+                    {
+                        return false;
+                    }
+
+                    Result1 const& value = status == State::prefix_available ?
+                        state.prefix :
+                        state.aggregate;
+                    if (first)
+                    {
+                        prefix = value;
+                        first = false;
+                    }
+                    else
+                    {
+                        prefix = HPX_INVOKE(f2, value, prefix);
+                    }
+
+                    if (status == State::prefix_available)
+                    {
+                        return true;
+                    }
+                }
+
+                // the first state always holds a prefix
+                HPX_ASSERT(false);
+                return false;
+            }
+
             template <typename F>
             static R reduce(
                 std::vector<hpx::shared_future<Result1>>&& workitems,
@@ -0,0 +1,165 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the radix sort used by hpx::sort for arithmetic keys with the
+// comparison based parallel sort (selected by using a comparison function the
+// radix sort does not know about).
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename T>
+std::vector<T> random_keys(std::size_t size)
+{
+    std::vector<T> c(size);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_real_distribution<T> dis(T(-1e6), T(1e6));
+        std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+    }
+    else
+    {
+        std::uniform_int_distribution<T> dis(
+            (std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+        std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+    }
+    return c;
+}
+
+template <typename F>
+std::uint64_t measure(F&& f, int test_count)
+{
+    std::uint64_t elapsed = 0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        elapsed += f();
+    }
+    return elapsed / test_count;
+}
+
+template <typename T>
+void run_benchmark(std::string const& name, std::size_t size, int test_count)
+{
+    using namespace hpx::execution;
+
+    std::vector<T> const keys = random_keys<T>(size);
+
+    auto time_sort = [&](auto comp) {
+        return measure(
+            [&]() {
+                std::vector<T> c(keys);
+                auto start = std::chrono::high_resolution_clock::now();
+                hpx::sort(par, c.begin(), c.end(), comp);
+                auto end = std::chrono::high_resolution_clock::now();
+                return std::uint64_t(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        end - start)
+                        .count());
+            },
+            test_count);
+    };
+
+    std::uint64_t const radix = time_sort(std::less<T>());
+    std::uint64_t const comparison =
+        time_sort([](T lhs, T rhs) { return lhs < rhs; });
+
+    auto time_sort_by_key = [&](auto comp) {
+        std::vector<std::uint32_t> const values(keys.begin(), keys.end());
+        return measure(
+            [&]() {
+                std::vector<T> k(keys);
+                std::vector<std::uint32_t> v(values);
+                auto start = std::chrono::high_resolution_clock::now();
+                hpx::parallel::sort_by_key(
+                    par, k.begin(), k.end(), v.begin(), comp);
+                auto end = std::chrono::high_resolution_clock::now();
+                return std::uint64_t(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        end - start)
+                        .count());
+            },
+            test_count);
+    };
+
+    std::uint64_t const radix_by_key = time_sort_by_key(std::less<T>());
+    std::uint64_t const comparison_by_key =
+        time_sort_by_key([](T lhs, T rhs) { return lhs < rhs; });
+
+    std::cout << name << ":\n"
+              << "  sort (radix)               : " << radix / 1000000
+              << " ms\n"
+              << "  sort (comparison)          : " << comparison / 1000000
+              << " ms\n"
+              << "  sort_by_key (radix)        : " << radix_by_key / 1000000
+              << " ms\n"
+              << "  sort_by_key (comparison)   : "
+              << comparison_by_key / 1000000 << " ms\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::size_t const size = vm["vector_size"].as<std::size_t>();
+    int const test_count = vm["test_count"].as<int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    run_benchmark<std::int32_t>("int32", size, test_count);
+    run_benchmark<std::uint32_t>("uint32", size, test_count);
+    run_benchmark<std::int64_t>("int64", size, test_count);
+    run_benchmark<float>("float", size, test_count);
+    run_benchmark<double>("double", size, test_count);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("vector_size", value<std::size_t>()->default_value(10000000),
+            "number of keys to sort (default: 10000000)")
+        ("test_count", value<int>()->default_value(5),
+            "number of tests to be averaged (default: 5)")
+        ("seed,s", value<unsigned int>(),
+            "the random number generator seed to use for this run");
+    // clang-format on
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -10,6 +10,7 @@
 #include <hpx/parallel/algorithms/copy.hpp>
 #include <hpx/parallel/algorithms/exclusive_scan.hpp>
 #include <hpx/parallel/algorithms/inclusive_scan.hpp>
+#include <hpx/parallel/algorithms/partition.hpp>
 #include <hpx/parallel/algorithms/transform_exclusive_scan.hpp>
 #include <hpx/parallel/algorithms/transform_inclusive_scan.hpp>
 #include <hpx/parallel/algorithms/unique.hpp>
@@ -32,6 +33,7 @@ enum class ALGORITHM
     TRANSFORM_EXCLUSIVE_SCAN,
     TRANSFORM_INCLUSIVE_SCAN,
     COPY_IF,
+    PARTITION_COPY,
     UNIQUE_COPY
 };
 
@@ -46,6 +48,7 @@ void measureScanAlgorithms()
         {ALGORITHM::TRANSFORM_INCLUSIVE_SCAN,
             "transformInclusiveScanCompare.csv"},
         {ALGORITHM::COPY_IF, "copyIfCompare.csv"},
+        {ALGORITHM::PARTITION_COPY, "partitionCopyCompare.csv"},
         {ALGORITHM::UNIQUE_COPY, "uniqueCopyCompare.csv"},
     };
 #endif
@@ -54,7 +57,9 @@ void measureScanAlgorithms()
          alg <= (int) ALGORITHM::UNIQUE_COPY; alg++)
     {
         std::size_t start = 32;
-        std::size_t till = 1 << 10;
+        // the larger sizes don't fit into the cache, the scans are bandwidth
+        // bound for those
+        std::size_t till = 1 << 24;
 
         const auto NUM_ITERATIONS = 5;
 
@@ -71,6 +76,7 @@ void measureScanAlgorithms()
             for (int i = 0; i < NUM_ITERATIONS + 5; i++)
             {
                 std::vector<int> res(s);
+                std::vector<int> res_false(s);
                 auto t1 = std::chrono::high_resolution_clock::now();
 
                 switch ((ALGORITHM) alg)
@@ -97,6 +103,10 @@ void measureScanAlgorithms()
                     hpx::copy_if(arr.begin(), arr.end(), res.begin(),
                         [](int x) { return (x % 2) != 0; });
                     break;
+                case ALGORITHM::PARTITION_COPY:
+                    hpx::partition_copy(arr.begin(), arr.end(), res.begin(),
+                        res_false.begin(), [](int x) { return (x % 2) != 0; });
+                    break;
                 case ALGORITHM::UNIQUE_COPY:
                     hpx::unique_copy(arr.begin(), arr.end(), res.begin(),
                         std::equal_to<int>{});
@@ -120,6 +130,7 @@ void measureScanAlgorithms()
             for (int i = 0; i < NUM_ITERATIONS + 5; i++)
             {
                 std::vector<int> res1(s);
+                std::vector<int> res1_false(s);
                 auto t2 = std::chrono::high_resolution_clock::now();
                 switch ((ALGORITHM) alg)
                 {
@@ -146,6 +157,11 @@ void measureScanAlgorithms()
                     hpx::copy_if(hpx::execution::par, arr.begin(), arr.end(),
                         res1.begin(), [](int x) { return (x % 2) != 0; });
                     break;
+                case ALGORITHM::PARTITION_COPY:
+                    hpx::partition_copy(hpx::execution::par, arr.begin(),
+                        arr.end(), res1.begin(), res1_false.begin(),
+                        [](int x) { return (x % 2) != 0; });
+                    break;
                 case ALGORITHM::UNIQUE_COPY:
                     hpx::unique_copy(hpx::execution::par, arr.begin(),
                         arr.end(), res1.begin(), std::equal_to<int>{});
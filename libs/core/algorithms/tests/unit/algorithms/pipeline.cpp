@@ -0,0 +1,198 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/pipeline.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace pl = hpx::experimental::pipeline;
+
+///////////////////////////////////////////////////////////////////////////////
+int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+auto square = [](std::size_t v) { return v * v; };
+auto is_odd = [](std::size_t v) { return (v % 2) != 0; };
+
+// the fused pipeline has to produce the same results as the stages applied
+// one after another
+std::vector<std::size_t> expected_values(std::vector<std::size_t> const& c)
+{
+    std::vector<std::size_t> values;
+    for (std::size_t v : c)
+    {
+        std::size_t const squared = square(v);
+        if (is_odd(squared))
+        {
+            values.push_back(squared);
+        }
+    }
+    return values;
+}
+
+template <typename ExPolicy>
+void test_pipeline(ExPolicy policy)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    std::vector<std::size_t> c(10007);
+    std::iota(std::begin(c), std::end(c), gen() % 10007);
+
+    std::vector<std::size_t> const expected = expected_values(c);
+
+    auto p = pl::from(policy, c) | pl::transform(square) | pl::filter(is_odd);
+
+    {
+        std::size_t r = p | pl::reduce(std::size_t(42));
+        HPX_TEST_EQ(r,
+            std::accumulate(
+                std::begin(expected), std::end(expected), std::size_t(42)));
+    }
+
+    {
+        std::size_t r = p | pl::count();
+        HPX_TEST_EQ(r, expected.size());
+    }
+
+    {
+        std::vector<std::size_t> r = p | pl::to_vector();
+        HPX_TEST(r == expected);
+    }
+
+    {
+        std::atomic<std::size_t> sum(0);
+        p | pl::for_each([&](std::size_t v) { sum += v; });
+        HPX_TEST_EQ(sum.load(),
+            std::accumulate(
+                std::begin(expected), std::end(expected), std::size_t(0)));
+    }
+}
+
+template <typename ExPolicy>
+void test_pipeline_async(ExPolicy policy)
+{
+    std::vector<std::size_t> c(10007);
+    std::iota(std::begin(c), std::end(c), gen() % 10007);
+
+    std::vector<std::size_t> const expected = expected_values(c);
+
+    auto p = pl::from(policy, c) | pl::transform(square) | pl::filter(is_odd);
+
+    hpx::future<std::size_t> f1 = p | pl::reduce(std::size_t(0));
+    hpx::future<std::size_t> f2 = p | pl::count();
+    hpx::future<std::vector<std::size_t>> f3 = p | pl::to_vector();
+
+    std::atomic<std::size_t> sum(0);
+    hpx::future<void> f4 = p | pl::for_each([&](std::size_t v) { sum += v; });
+
+    std::size_t const expected_sum = std::accumulate(
+        std::begin(expected), std::end(expected), std::size_t(0));
+
+    HPX_TEST_EQ(f1.get(), expected_sum);
+    HPX_TEST_EQ(f2.get(), expected.size());
+    HPX_TEST(f3.get() == expected);
+
+    f4.get();
+    HPX_TEST_EQ(sum.load(), expected_sum);
+}
+
+void test_pipeline_types()
+{
+    std::vector<int> c(1007);
+    std::iota(std::begin(c), std::end(c), 0);
+
+    // the value type changes with each transformation
+    auto p = pl::from(hpx::execution::par, c) |
+        pl::transform([](int v) { return std::to_string(v); }) |
+        pl::filter([](std::string const& s) { return s.size() == 2; }) |
+        pl::transform([](std::string const& s) { return s.size(); });
+
+    static_assert(
+        std::is_same_v<decltype(p)::value_type, std::size_t>, "value_type");
+
+    HPX_TEST_EQ(p | pl::reduce(std::size_t(0)), std::size_t(2 * 90));
+
+    // a pipeline without any stages produces the input sequence
+    std::vector<int> r = pl::from(hpx::execution::par, c) | pl::to_vector();
+    HPX_TEST(r == c);
+
+    // non-forward iterators and empty ranges
+    std::list<int> l(std::begin(c), std::end(c));
+    HPX_TEST_EQ(pl::from(l) | pl::filter([](int v) { return v < 10; }) |
+            pl::count(),
+        std::size_t(10));
+
+    std::vector<int> empty;
+    HPX_TEST_EQ(pl::from(hpx::execution::par, empty) | pl::reduce(42), 42);
+    HPX_TEST_EQ(
+        pl::from(hpx::execution::par, empty) | pl::count(), std::size_t(0));
+}
+
+void pipeline_test()
+{
+    using namespace hpx::execution;
+
+    test_pipeline(seq);
+    test_pipeline(par);
+    test_pipeline(par_unseq);
+
+    test_pipeline_async(seq(task));
+    test_pipeline_async(par(task));
+
+    test_pipeline_types();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    pipeline_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
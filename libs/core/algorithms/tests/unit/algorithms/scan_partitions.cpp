@@ -0,0 +1,255 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The scan algorithms split large inputs into many partitions, each of which
+// looks up the results of the partitions to its left. Verify the results for
+// inputs covering many partitions using a non-commutative operation.
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/copy.hpp>
+#include <hpx/parallel/algorithms/exclusive_scan.hpp>
+#include <hpx/parallel/algorithms/inclusive_scan.hpp>
+#include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/algorithms/transform_exclusive_scan.hpp>
+#include <hpx/parallel/algorithms/transform_inclusive_scan.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(HPX_DEBUG)
+#define HPX_SCAN_PARTITIONS_TEST_SIZE (1 << 18)
+#else
+#define HPX_SCAN_PARTITIONS_TEST_SIZE (1 << 21)
+#endif
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+////////////////////////////////////////////////////////////////////////////////
+// An affine function x -> a * x + b, composing these is associative but not
+// commutative.
+struct affine
+{
+    std::uint64_t a = 1;
+    std::uint64_t b = 0;
+
+    friend bool operator==(affine const& lhs, affine const& rhs)
+    {
+        return lhs.a == rhs.a && lhs.b == rhs.b;
+    }
+};
+
+// apply lhs first, then rhs
+struct compose
+{
+    affine operator()(affine const& lhs, affine const& rhs) const
+    {
+        return affine{rhs.a * lhs.a, rhs.a * lhs.b + rhs.b};
+    }
+};
+
+std::vector<affine> random_affine(std::size_t size)
+{
+    std::uniform_int_distribution<std::uint64_t> dis;
+    std::vector<affine> c(size);
+    std::generate(
+        c.begin(), c.end(), [&]() { return affine{dis(gen) | 1, dis(gen)}; });
+    return c;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_inclusive_scan(ExPolicy policy, std::size_t size)
+{
+    std::vector<affine> c = random_affine(size);
+    std::vector<affine> d(size);
+    std::vector<affine> expected(size);
+
+    affine const init{3, 5};
+    std::inclusive_scan(c.begin(), c.end(), expected.begin(), compose(), init);
+
+    hpx::inclusive_scan(policy, c.begin(), c.end(), d.begin(), compose(), init);
+    HPX_TEST(d == expected);
+
+    std::inclusive_scan(c.begin(), c.end(), expected.begin(), compose());
+    hpx::inclusive_scan(policy, c.begin(), c.end(), d.begin(), compose());
+    HPX_TEST(d == expected);
+}
+
+template <typename ExPolicy>
+void test_exclusive_scan(ExPolicy policy, std::size_t size)
+{
+    std::vector<affine> c = random_affine(size);
+    std::vector<affine> d(size);
+    std::vector<affine> expected(size);
+
+    affine const init{3, 5};
+    std::exclusive_scan(c.begin(), c.end(), expected.begin(), init, compose());
+
+    hpx::exclusive_scan(policy, c.begin(), c.end(), d.begin(), init, compose());
+    HPX_TEST(d == expected);
+}
+
+template <typename ExPolicy>
+void test_transform_scans(ExPolicy policy, std::size_t size)
+{
+    std::vector<affine> c = random_affine(size);
+    std::vector<affine> d(size);
+    std::vector<affine> expected(size);
+
+    affine const init{3, 5};
+    auto conv = [](affine const& f) { return affine{f.a, f.b + 1}; };
+
+    std::transform_inclusive_scan(
+        c.begin(), c.end(), expected.begin(), compose(), conv, init);
+    hpx::transform_inclusive_scan(
+        policy, c.begin(), c.end(), d.begin(), compose(), conv, init);
+    HPX_TEST(d == expected);
+
+    std::transform_exclusive_scan(
+        c.begin(), c.end(), expected.begin(), init, compose(), conv);
+    hpx::transform_exclusive_scan(
+        policy, c.begin(), c.end(), d.begin(), init, compose(), conv);
+    HPX_TEST(d == expected);
+}
+
+template <typename ExPolicy>
+void test_copy_if(ExPolicy policy, std::size_t size)
+{
+    std::vector<std::size_t> c(size);
+    std::iota(c.begin(), c.end(), std::size_t(0));
+    std::shuffle(c.begin(), c.end(), gen);
+
+    auto pred = [](std::size_t v) { return v % 3 != 0; };
+
+    std::vector<std::size_t> expected;
+    std::copy_if(c.begin(), c.end(), std::back_inserter(expected), pred);
+
+    std::vector<std::size_t> d(size);
+    auto result = hpx::copy_if(policy, c.begin(), c.end(), d.begin(), pred);
+    HPX_TEST(result == d.begin() + expected.size());
+    HPX_TEST(std::equal(expected.begin(), expected.end(), d.begin()));
+
+    std::vector<std::size_t> expected_false;
+    std::remove_copy_if(
+        c.begin(), c.end(), std::back_inserter(expected_false), pred);
+
+    std::vector<std::size_t> d_false(size);
+    auto presult = hpx::partition_copy(
+        policy, c.begin(), c.end(), d.begin(), d_false.begin(), pred);
+    HPX_TEST(presult.first == d.begin() + expected.size());
+    HPX_TEST(presult.second == d_false.begin() + expected_false.size());
+    HPX_TEST(std::equal(expected.begin(), expected.end(), d.begin()));
+    HPX_TEST(std::equal(
+        expected_false.begin(), expected_false.end(), d_false.begin()));
+}
+
+// An exception thrown for one partition must not prevent the partitions to
+// its right from completing.
+template <typename ExPolicy>
+void test_inclusive_scan_exception(ExPolicy policy, std::size_t size)
+{
+    std::vector<std::size_t> c(size, std::size_t(1));
+    std::vector<std::size_t> d(size);
+
+    // the operation throws when it sees the marker
+    std::size_t const marker = 4 * size;
+    c[size / 3] = marker;
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::inclusive_scan(policy, c.begin(), c.end(), d.begin(),
+            [marker](std::size_t v1, std::size_t v2) {
+                if (v1 == marker || v2 == marker)
+                    throw std::runtime_error("test");
+                return v1 + v2;
+            });
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+template <typename ExPolicy>
+void test_scan_partitions(ExPolicy policy, std::size_t size)
+{
+    test_inclusive_scan(policy, size);
+    test_exclusive_scan(policy, size);
+    test_transform_scans(policy, size);
+    test_copy_if(policy, size);
+}
+
+template <typename ExPolicy>
+void test_scan_partitions_async(ExPolicy policy, std::size_t size)
+{
+    std::vector<affine> c = random_affine(size);
+    std::vector<affine> d(size);
+    std::vector<affine> expected(size);
+
+    std::inclusive_scan(c.begin(), c.end(), expected.begin(), compose());
+
+    auto f =
+        hpx::inclusive_scan(policy, c.begin(), c.end(), d.begin(), compose());
+    f.wait();
+    HPX_TEST(d == expected);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    using namespace hpx::execution;
+
+    std::size_t const size = HPX_SCAN_PARTITIONS_TEST_SIZE;
+
+    test_scan_partitions(par, size);
+    test_scan_partitions(par_unseq, size);
+
+    // many small chunks and a single chunk split into many partitions
+    test_scan_partitions(par.with(static_chunk_size(100)), size);
+    test_scan_partitions(par.with(static_chunk_size(size)), size);
+
+    // exceptions thrown under the unsequenced policies terminate the program
+    test_inclusive_scan_exception(par, size);
+    test_inclusive_scan_exception(par.with(static_chunk_size(100)), size);
+
+    test_scan_partitions_async(par(task), size);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::cout << "using seed: " << seed << std::endl;
+
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
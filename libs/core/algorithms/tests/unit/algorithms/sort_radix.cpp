@@ -0,0 +1,215 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// hpx::sort and hpx::parallel::sort_by_key use a radix sort for large
+// sequences of arithmetic keys compared with std::less or std::greater. Verify
+// the result against std::sort for the key types needing special treatment.
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(HPX_DEBUG)
+#define HPX_SORT_RADIX_TEST_SIZE (1 << 17)
+#else
+#define HPX_SORT_RADIX_TEST_SIZE (1 << 20)
+#endif
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> random_keys(std::size_t size)
+{
+    std::vector<T> c(size);
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::uniform_real_distribution<T> dis(T(-1e6), T(1e6));
+        std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+
+        // special values have to end up at the correct position
+        c[0] = std::numeric_limits<T>::infinity();
+        c[1] = -std::numeric_limits<T>::infinity();
+        c[2] = (std::numeric_limits<T>::max)();
+        c[3] = std::numeric_limits<T>::lowest();
+        c[4] = std::numeric_limits<T>::denorm_min();
+        c[5] = -std::numeric_limits<T>::denorm_min();
+        c[6] = T(0);
+    }
+    else
+    {
+        // distributions are not defined for (unsigned) char
+        using dist_type =
+            std::conditional_t<(sizeof(T) < sizeof(short)), int, T>;
+        std::uniform_int_distribution<dist_type> dis(
+            (std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+        std::generate(
+            c.begin(), c.end(), [&]() { return static_cast<T>(dis(gen)); });
+
+        c[0] = (std::numeric_limits<T>::min)();
+        c[1] = (std::numeric_limits<T>::max)();
+        c[2] = T(0);
+    }
+    return c;
+}
+
+template <typename ExPolicy, typename T, typename Compare>
+void test_sort_radix(ExPolicy&& policy, std::vector<T> c, Compare comp)
+{
+    std::vector<T> expected(c);
+    std::sort(expected.begin(), expected.end(), comp);
+
+    hpx::sort(policy, c.begin(), c.end(), comp);
+    HPX_TEST(c == expected);
+}
+
+template <typename ExPolicy, typename T, typename Compare>
+void test_sort_radix_async(ExPolicy&& policy, std::vector<T> c, Compare comp)
+{
+    std::vector<T> expected(c);
+    std::sort(expected.begin(), expected.end(), comp);
+
+    auto f = hpx::sort(policy, c.begin(), c.end(), comp);
+    f.get();
+    HPX_TEST(c == expected);
+}
+
+template <typename T>
+void test_sort_radix(std::size_t size)
+{
+    using namespace hpx::execution;
+
+    test_sort_radix(par, random_keys<T>(size), std::less<T>());
+    test_sort_radix(par, random_keys<T>(size), std::less<>());
+    test_sort_radix(par, random_keys<T>(size), std::greater<T>());
+    test_sort_radix(par_unseq, random_keys<T>(size), std::greater<>());
+
+    test_sort_radix_async(par(task), random_keys<T>(size), std::less<T>());
+    test_sort_radix_async(par(task), random_keys<T>(size), std::greater<T>());
+}
+
+// Keys differing in their lowest byte only, all other passes are skipped.
+void test_sort_radix_skipped_passes(std::size_t size)
+{
+    using namespace hpx::execution;
+
+    std::uniform_int_distribution<std::int64_t> dis(-100, 100);
+    std::vector<std::int64_t> c(size);
+    std::generate(c.begin(), c.end(), [&]() { return 1000000 + dis(gen); });
+    test_sort_radix(par, c, std::less<>());
+
+    // all keys are equal
+    std::fill(c.begin(), c.end(), -42);
+    test_sort_radix(par, c, std::less<>());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+template <typename Key, typename ExPolicy, typename Compare>
+void test_sort_by_key_radix(ExPolicy&& policy, std::size_t size, Compare comp)
+{
+    // use few distinct keys to have many duplicates
+    std::uniform_int_distribution<int> dis(-1000, 1000);
+    std::vector<Key> keys(size);
+    std::generate(
+        keys.begin(), keys.end(), [&]() { return static_cast<Key>(dis(gen)); });
+
+    // each value refers to its original key
+    std::vector<std::pair<Key, std::size_t>> values(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        values[i] = std::make_pair(keys[i], i);
+    }
+
+    std::vector<Key> expected(keys);
+    std::sort(expected.begin(), expected.end(), comp);
+
+    auto result = hpx::parallel::sort_by_key(
+        policy, keys.begin(), keys.end(), values.begin(), comp);
+    HPX_TEST(result.first == keys.end());
+    HPX_TEST(result.second == values.end());
+    HPX_TEST(keys == expected);
+
+    // every value has moved along with its key, no value was lost
+    std::vector<bool> seen(size, false);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        HPX_TEST_EQ(values[i].first, keys[i]);
+        HPX_TEST(!seen[values[i].second]);
+        seen[values[i].second] = true;
+    }
+}
+
+void test_sort_by_key_radix_strings(std::size_t size)
+{
+    using namespace hpx::execution;
+
+    std::uniform_int_distribution<std::uint32_t> dis;
+    std::vector<std::uint32_t> keys(size);
+    std::generate(keys.begin(), keys.end(), [&]() { return dis(gen); });
+
+    std::vector<std::string> values(size);
+    std::transform(keys.begin(), keys.end(), values.begin(),
+        [](std::uint32_t key) { return std::to_string(key); });
+
+    auto f = hpx::parallel::sort_by_key(
+        par(task), keys.begin(), keys.end(), values.begin());
+    f.get();
+
+    HPX_TEST(std::is_sorted(keys.begin(), keys.end()));
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        HPX_TEST_EQ(values[i], std::to_string(keys[i]));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    std::size_t const size = HPX_SORT_RADIX_TEST_SIZE;
+
+    test_sort_radix<std::int8_t>(size);
+    test_sort_radix<std::uint8_t>(size);
+    test_sort_radix<std::int16_t>(size);
+    test_sort_radix<std::uint16_t>(size);
+    test_sort_radix<std::int32_t>(size);
+    test_sort_radix<std::uint32_t>(size);
+    test_sort_radix<std::int64_t>(size);
+    test_sort_radix<std::uint64_t>(size);
+    test_sort_radix<float>(size);
+    test_sort_radix<double>(size);
+
+    test_sort_radix_skipped_passes(size);
+
+    using namespace hpx::execution;
+    test_sort_by_key_radix<int>(par, size, std::less<int>());
+    test_sort_by_key_radix<int>(par, size, std::greater<int>());
+    test_sort_by_key_radix<double>(par_unseq, size, std::less<>());
+    test_sort_by_key_radix_strings(size);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::cout << "using seed: " << seed << std::endl;
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,151 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/minmax.hpp>
+#include <hpx/parallel/datapar.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const sizes[] = {1, 2, 3, 17, 64, 1023, 10007};
+std::size_t const offsets[] = {0, 1, 2, 3, 5, 7};
+
+// hpx::max_element and hpx::minmax_element return the last largest element
+template <typename Iter>
+Iter last_max_element(Iter first, Iter last)
+{
+    Iter largest = first;
+    for (/**/; first != last; ++first)
+    {
+        if (!(*first < *largest))
+            largest = first;
+    }
+    return largest;
+}
+
+template <typename ExPolicy, typename T, typename F>
+void test_minmax_element(ExPolicy policy, F f)
+{
+    // few distinct values to have many duplicates of the extremes
+    std::uniform_int_distribution<int> dis(-10, 10);
+    for (std::size_t size : sizes)
+    {
+        for (std::size_t offset : offsets)
+        {
+            std::vector<T> c(size + offset);
+            std::generate(c.begin(), c.end(), [&]() { return T(dis(gen)); });
+
+            auto first = c.begin() + offset;
+
+            auto min_it = hpx::min_element(policy, first, c.end(), f);
+            HPX_TEST(min_it == std::min_element(first, c.end()));
+
+            auto max_it = hpx::max_element(policy, first, c.end(), f);
+            HPX_TEST(max_it == last_max_element(first, c.end()));
+
+            auto result = hpx::minmax_element(policy, first, c.end(), f);
+            HPX_TEST(result.min == std::min_element(first, c.end()));
+            HPX_TEST(result.max == last_max_element(first, c.end()));
+        }
+    }
+}
+
+template <typename ExPolicy, typename T>
+void test_minmax_element(ExPolicy policy)
+{
+    test_minmax_element<ExPolicy, T>(policy, std::less<>());
+
+    // std::less<T> is replaced by std::less<> for the packs
+    test_minmax_element<ExPolicy, T>(policy, std::less<T>());
+
+    // comparisons not supporting packs use the scalar loop
+    test_minmax_element<ExPolicy, T>(
+        policy, [](T lhs, T rhs) { return lhs < rhs; });
+}
+
+template <typename ExPolicy>
+void test_minmax_element(ExPolicy policy)
+{
+    test_minmax_element<ExPolicy, std::int8_t>(policy);
+    test_minmax_element<ExPolicy, std::int32_t>(policy);
+    test_minmax_element<ExPolicy, std::uint64_t>(policy);
+    test_minmax_element<ExPolicy, float>(policy);
+    test_minmax_element<ExPolicy, double>(policy);
+
+    // the empty sequence
+    std::vector<int> c;
+    HPX_TEST(hpx::min_element(policy, c.begin(), c.end()) == c.end());
+    HPX_TEST(hpx::max_element(policy, c.begin(), c.end()) == c.end());
+}
+
+template <typename ExPolicy>
+void test_minmax_element_async(ExPolicy policy)
+{
+    std::vector<int> c(10007);
+    std::uniform_int_distribution<int> dis(-10, 10);
+    std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+
+    auto f = hpx::minmax_element(policy, c.begin(), c.end());
+    auto result = f.get();
+    HPX_TEST(result.min == std::min_element(c.begin(), c.end()));
+    HPX_TEST(result.max == last_max_element(c.begin(), c.end()));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    using namespace hpx::execution;
+
+    test_minmax_element(simd);
+    test_minmax_element(par_simd);
+
+    test_minmax_element_async(simd(task));
+    test_minmax_element_async(par_simd(task));
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
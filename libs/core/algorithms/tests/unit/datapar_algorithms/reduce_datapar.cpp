@@ -0,0 +1,156 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/reduce.hpp>
+#include <hpx/parallel/algorithms/transform_reduce.hpp>
+#include <hpx/parallel/datapar.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+// The vectorized reduction handles the elements in front of the first aligned
+// pack and after the last full pack separately, test all possible offsets.
+std::size_t const sizes[] = {0, 1, 3, 17, 64, 1023, 10007};
+std::size_t const offsets[] = {0, 1, 2, 3, 5, 7};
+
+template <typename ExPolicy, typename T>
+void test_reduce(ExPolicy policy)
+{
+    std::uniform_int_distribution<int> dis(-100, 100);
+    for (std::size_t size : sizes)
+    {
+        for (std::size_t offset : offsets)
+        {
+            std::vector<T> c(size + offset);
+            std::generate(c.begin(), c.end(), [&]() { return T(dis(gen)); });
+
+            auto first = c.begin() + offset;
+            T const init = T(42);
+
+            T expected = std::accumulate(first, c.end(), init);
+
+            // std::plus<T> is replaced by std::plus<> for the packs
+            HPX_TEST_EQ(hpx::reduce(policy, first, c.end(), init), expected);
+            HPX_TEST_EQ(
+                hpx::reduce(policy, first, c.end(), init, std::plus<>()),
+                expected);
+            HPX_TEST_EQ(hpx::reduce(policy, first, c.end(), init,
+                            [](auto lhs, auto rhs) { return lhs + rhs; }),
+                expected);
+
+            // operations not supporting packs use the scalar loop
+            HPX_TEST_EQ(hpx::reduce(policy, first, c.end(), init,
+                            [](T lhs, T rhs) { return lhs + rhs; }),
+                expected);
+        }
+    }
+}
+
+template <typename ExPolicy, typename T>
+void test_transform_reduce(ExPolicy policy)
+{
+    std::uniform_int_distribution<int> dis(-100, 100);
+    for (std::size_t size : sizes)
+    {
+        for (std::size_t offset : offsets)
+        {
+            std::vector<T> c(size + offset);
+            std::generate(c.begin(), c.end(), [&]() { return T(dis(gen)); });
+
+            auto first = c.begin() + offset;
+            T const init = T(3);
+
+            T expected = std::transform_reduce(first, c.end(), init,
+                std::plus<>(), [](T v) { return v * v; });
+
+            HPX_TEST_EQ(hpx::transform_reduce(policy, first, c.end(), init,
+                            std::plus<>(), [](auto v) { return v * v; }),
+                expected);
+            HPX_TEST_EQ(hpx::transform_reduce(policy, first, c.end(), init,
+                            std::plus<T>(), [](T v) { return v * v; }),
+                expected);
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_reduce(ExPolicy policy)
+{
+    test_reduce<ExPolicy, std::int32_t>(policy);
+    test_reduce<ExPolicy, std::int64_t>(policy);
+    test_reduce<ExPolicy, float>(policy);
+    test_reduce<ExPolicy, double>(policy);
+
+    test_transform_reduce<ExPolicy, std::int32_t>(policy);
+    test_transform_reduce<ExPolicy, double>(policy);
+}
+
+template <typename ExPolicy>
+void test_reduce_async(ExPolicy policy)
+{
+    std::vector<std::int32_t> c(10007);
+    std::iota(c.begin(), c.end(), 0);
+
+    auto f = hpx::reduce(policy, c.begin(), c.end(), std::int32_t(0));
+    HPX_TEST_EQ(f.get(), std::accumulate(c.begin(), c.end(), std::int32_t(0)));
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    using namespace hpx::execution;
+
+    test_reduce(simd);
+    test_reduce(par_simd);
+
+    test_reduce_async(simd(task));
+    test_reduce_async(par_simd(task));
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,158 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/exclusive_scan.hpp>
+#include <hpx/parallel/algorithms/inclusive_scan.hpp>
+#include <hpx/parallel/algorithms/transform_exclusive_scan.hpp>
+#include <hpx/parallel/algorithms/transform_inclusive_scan.hpp>
+#include <hpx/parallel/datapar.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const sizes[] = {1, 3, 17, 64, 1023, 100007};
+std::size_t const offsets[] = {0, 1, 3, 7};
+
+template <typename ExPolicy, typename T, typename Op>
+void test_scans(ExPolicy policy, Op op)
+{
+    std::uniform_int_distribution<int> dis(-10, 10);
+    for (std::size_t size : sizes)
+    {
+        for (std::size_t offset : offsets)
+        {
+            std::vector<T> c(size);
+            std::generate(c.begin(), c.end(), [&]() { return T(dis(gen)); });
+
+            // the destination decides about the alignment of the packs
+            std::vector<T> d(size + offset);
+            std::vector<T> expected(size);
+            auto dest = d.begin() + offset;
+
+            T const init = T(5);
+
+            std::inclusive_scan(c.begin(), c.end(), expected.begin(), op);
+            hpx::inclusive_scan(policy, c.begin(), c.end(), dest, op);
+            HPX_TEST(std::equal(expected.begin(), expected.end(), dest));
+
+            std::inclusive_scan(
+                c.begin(), c.end(), expected.begin(), op, init);
+            hpx::inclusive_scan(policy, c.begin(), c.end(), dest, op, init);
+            HPX_TEST(std::equal(expected.begin(), expected.end(), dest));
+
+            std::exclusive_scan(
+                c.begin(), c.end(), expected.begin(), init, op);
+            hpx::exclusive_scan(policy, c.begin(), c.end(), dest, init, op);
+            HPX_TEST(std::equal(expected.begin(), expected.end(), dest));
+
+            auto conv = [](T v) { return T(2 * v); };
+
+            std::transform_inclusive_scan(
+                c.begin(), c.end(), expected.begin(), op, conv, init);
+            hpx::transform_inclusive_scan(
+                policy, c.begin(), c.end(), dest, op, conv, init);
+            HPX_TEST(std::equal(expected.begin(), expected.end(), dest));
+
+            std::transform_exclusive_scan(
+                c.begin(), c.end(), expected.begin(), init, op, conv);
+            hpx::transform_exclusive_scan(
+                policy, c.begin(), c.end(), dest, init, op, conv);
+            HPX_TEST(std::equal(expected.begin(), expected.end(), dest));
+        }
+    }
+}
+
+template <typename ExPolicy, typename T>
+void test_scans(ExPolicy policy)
+{
+    test_scans<ExPolicy, T>(policy, std::plus<>());
+
+    // std::plus<T> is replaced by std::plus<> for the packs
+    test_scans<ExPolicy, T>(policy, std::plus<T>());
+
+    // operations not supporting packs use the scalar loop
+    test_scans<ExPolicy, T>(policy, [](T lhs, T rhs) { return lhs + rhs; });
+}
+
+template <typename ExPolicy>
+void test_scans(ExPolicy policy)
+{
+    test_scans<ExPolicy, std::int32_t>(policy);
+    test_scans<ExPolicy, std::int64_t>(policy);
+    test_scans<ExPolicy, double>(policy);
+}
+
+template <typename ExPolicy>
+void test_scans_async(ExPolicy policy)
+{
+    std::vector<int> c(100007);
+    std::vector<int> d(c.size());
+    std::vector<int> expected(c.size());
+    std::fill(c.begin(), c.end(), 1);
+
+    std::inclusive_scan(c.begin(), c.end(), expected.begin());
+
+    auto f = hpx::inclusive_scan(policy, c.begin(), c.end(), d.begin());
+    f.wait();
+    HPX_TEST(d == expected);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    using namespace hpx::execution;
+
+    test_scans(simd);
+    test_scans(par_simd);
+
+    test_scans_async(simd(task));
+    test_scans_async(par_simd(task));
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,129 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace hpx { namespace util {
+
+    namespace detail {
+
+        // Blocks of up to this size are served from the caches, larger
+        // requests are forwarded to the internal allocator.
+        inline constexpr std::size_t caching_allocator_max_size = 512;
+
+        // Blocks handed out by the caches are aligned to this value.
+        inline constexpr std::size_t caching_allocator_alignment =
+            alignof(std::max_align_t);
+
+        // Allocate a block of at least the given size from the cache of the
+        // calling thread. The cache is refilled in batches from a process
+        // wide depot, which in turn falls back to the internal allocator.
+        HPX_CORE_EXPORT void* thread_local_cache_allocate(std::size_t size);
+
+        // Return a block to the cache of the calling thread, the size has to
+        // be the same as used for allocating the block. Blocks freed on a
+        // different thread than they were allocated on end up in the cache of
+        // the freeing thread, surplus blocks are returned to the depot in
+        // batches.
+        HPX_CORE_EXPORT void thread_local_cache_deallocate(
+            void* p, std::size_t size) noexcept;
+    }    // namespace detail
+
+    /// Enable or disable the per-thread caches used by
+    /// \a thread_local_caching_allocator. While disabled, all allocations are
+    /// forwarded to the internal allocator. Blocks may be allocated and freed
+    /// with different settings.
+    HPX_CORE_EXPORT void enable_thread_local_caching(bool enable) noexcept;
+
+    /// Return whether the per-thread caches are enabled (the default).
+    HPX_CORE_EXPORT bool thread_local_caching_enabled() noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Stateless allocator serving small objects from per-thread, size-class
+    // bucketed caches. This is the default allocator for future shared
+    // states and continuations.
+    template <typename T = char>
+    struct thread_local_caching_allocator
+    {
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = thread_local_caching_allocator<U>;
+        };
+
+        using is_always_equal = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+
+        constexpr thread_local_caching_allocator() noexcept = default;
+
+        template <typename U>
+        constexpr thread_local_caching_allocator(    //-V659
+            thread_local_caching_allocator<U> const&) noexcept
+        {
+        }
+
+        [[nodiscard]] T* allocate(size_type n)
+        {
+            if constexpr (alignof(T) > detail::caching_allocator_alignment)
+            {
+                return internal_allocator<T>{}.allocate(n);
+            }
+            else
+            {
+                if (max_size() < n)
+                {
+                    throw std::bad_array_new_length();
+                }
+                return static_cast<T*>(
+                    detail::thread_local_cache_allocate(n * sizeof(T)));
+            }
+        }
+
+        void deallocate(T* p, size_type n) noexcept
+        {
+            if constexpr (alignof(T) > detail::caching_allocator_alignment)
+            {
+                internal_allocator<T>{}.deallocate(p, n);
+            }
+            else
+            {
+                detail::thread_local_cache_deallocate(p, n * sizeof(T));
+            }
+        }
+
+        constexpr size_type max_size() const noexcept
+        {
+            return (std::numeric_limits<size_type>::max)() / sizeof(T);
+        }
+    };
+
+    template <typename T, typename U>
+    constexpr bool operator==(thread_local_caching_allocator<T> const&,
+        thread_local_caching_allocator<U> const&) noexcept
+    {
+        return true;
+    }
+
+    template <typename T, typename U>
+    constexpr bool operator!=(thread_local_caching_allocator<T> const&,
+        thread_local_caching_allocator<U> const&) noexcept
+    {
+        return false;
+    }
+}}    // namespace hpx::util
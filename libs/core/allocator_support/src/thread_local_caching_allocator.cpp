@@ -0,0 +1,284 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace hpx { namespace util {
+
+    namespace detail {
+
+        namespace {
+
+            // Blocks are grouped into size classes which are multiples of the
+            // block alignment.
+            constexpr std::size_t size_class_granularity =
+                caching_allocator_alignment;
+            constexpr std::size_t num_size_classes =
+                caching_allocator_max_size / size_class_granularity;
+
+            // Blocks are moved between the thread caches and the depot in
+            // batches of this many blocks. A thread cache holds at most two
+            // batches per size class.
+            constexpr std::size_t batch_size = 32;
+            constexpr std::size_t max_thread_cached_blocks = 2 * batch_size;
+
+            // The depot holds at most this many batches per size class.
+            constexpr std::size_t max_depot_batches = 256;
+
+            std::atomic<bool> caching_enabled(true);
+
+            struct free_block
+            {
+                free_block* next;
+            };
+
+            constexpr std::size_t get_size_class(std::size_t size) noexcept
+            {
+                return size == 0 ? 0 : (size - 1) / size_class_granularity;
+            }
+
+            constexpr std::size_t get_class_size(std::size_t cls) noexcept
+            {
+                return (cls + 1) * size_class_granularity;
+            }
+
+            void* allocate_block(std::size_t cls)
+            {
+                return internal_allocator<char>{}.allocate(get_class_size(cls));
+            }
+
+            void deallocate_block(void* p, std::size_t cls) noexcept
+            {
+                internal_allocator<char>{}.deallocate(
+                    static_cast<char*>(p), get_class_size(cls));
+            }
+
+            void deallocate_blocks(free_block* head, std::size_t cls) noexcept
+            {
+                while (head != nullptr)
+                {
+                    free_block* next = head->next;
+                    deallocate_block(head, cls);
+                    head = next;
+                }
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            // The process wide depot keeps full batches of free blocks for
+            // each size class.
+            class depot
+            {
+            public:
+                static depot& get() noexcept
+                {
+                    // The depot is never destroyed as threads may return
+                    // their blocks after static objects have been destroyed.
+                    static depot* instance = new depot();
+                    return *instance;
+                }
+
+                free_block* get_batch(std::size_t cls) noexcept
+                {
+                    size_class& c = classes_[cls];
+                    std::lock_guard<std::mutex> l(c.mtx);
+                    if (c.batches.empty())
+                    {
+                        return nullptr;
+                    }
+
+                    free_block* batch = c.batches.back();
+                    c.batches.pop_back();
+                    return batch;
+                }
+
+                void put_batch(free_block* batch, std::size_t cls) noexcept
+                {
+                    {
+                        size_class& c = classes_[cls];
+                        std::lock_guard<std::mutex> l(c.mtx);
+                        if (c.batches.size() < max_depot_batches)
+                        {
+                            c.batches.push_back(batch);
+                            return;
+                        }
+                    }
+                    deallocate_blocks(batch, cls);
+                }
+
+            private:
+                depot()
+                {
+                    for (size_class& c : classes_)
+                    {
+                        c.batches.reserve(max_depot_batches);
+                    }
+                }
+
+                struct size_class
+                {
+                    std::mutex mtx;
+                    std::vector<free_block*> batches;
+                };
+
+                size_class classes_[num_size_classes];
+            };
+
+            ///////////////////////////////////////////////////////////////////
+            // Per-thread free lists, one for each size class.
+            class thread_cache
+            {
+            public:
+                thread_cache() = default;
+
+                thread_cache(thread_cache const&) = delete;
+                thread_cache& operator=(thread_cache const&) = delete;
+
+                ~thread_cache();
+
+                void* allocate(std::size_t cls)
+                {
+                    free_list& list = lists_[cls];
+                    if (list.head == nullptr)
+                    {
+                        list.head = depot::get().get_batch(cls);
+                        if (list.head == nullptr)
+                        {
+                            return allocate_block(cls);
+                        }
+                        list.count = batch_size;
+                    }
+
+                    free_block* block = list.head;
+                    list.head = block->next;
+                    --list.count;
+                    return block;
+                }
+
+                void deallocate(void* p, std::size_t cls) noexcept
+                {
+                    free_list& list = lists_[cls];
+                    if (list.count == max_thread_cached_blocks)
+                    {
+                        // hand one batch back to the depot
+                        depot::get().put_batch(take_batch(list), cls);
+                    }
+
+                    free_block* block = static_cast<free_block*>(p);
+                    block->next = list.head;
+                    list.head = block;
+                    ++list.count;
+                }
+
+            private:
+                struct free_list
+                {
+                    free_block* head = nullptr;
+                    std::size_t count = 0;
+                };
+
+                // detach the first batch_size blocks from the given list
+                static free_block* take_batch(free_list& list) noexcept
+                {
+                    free_block* batch = list.head;
+                    free_block* last = batch;
+                    for (std::size_t i = 1; i != batch_size; ++i)
+                    {
+                        last = last->next;
+                    }
+                    list.head = last->next;
+                    list.count -= batch_size;
+
+                    last->next = nullptr;
+                    return batch;
+                }
+
+                free_list lists_[num_size_classes];
+            };
+
+            // Set once the cache of the current thread has been destroyed,
+            // later requests are forwarded to the internal allocator.
+            thread_local bool thread_cache_destroyed = false;
+
+            thread_cache::~thread_cache()
+            {
+                thread_cache_destroyed = true;
+
+                depot& d = depot::get();
+                for (std::size_t cls = 0; cls != num_size_classes; ++cls)
+                {
+                    free_list& list = lists_[cls];
+                    while (list.count >= batch_size)
+                    {
+                        d.put_batch(take_batch(list), cls);
+                    }
+                    deallocate_blocks(list.head, cls);
+                }
+            }
+
+            thread_cache* get_thread_cache() noexcept
+            {
+                if (thread_cache_destroyed ||
+                    !caching_enabled.load(std::memory_order_relaxed))
+                {
+                    return nullptr;
+                }
+
+                thread_local thread_cache cache;
+                return &cache;
+            }
+        }    // namespace
+
+        void* thread_local_cache_allocate(std::size_t size)
+        {
+            if (size > caching_allocator_max_size)
+            {
+                return internal_allocator<char>{}.allocate(size);
+            }
+
+            std::size_t const cls = get_size_class(size);
+            if (thread_cache* cache = get_thread_cache())
+            {
+                return cache->allocate(cls);
+            }
+            return allocate_block(cls);
+        }
+
+        void thread_local_cache_deallocate(void* p, std::size_t size) noexcept
+        {
+            if (size > caching_allocator_max_size)
+            {
+                internal_allocator<char>{}.deallocate(
+                    static_cast<char*>(p), size);
+                return;
+            }
+
+            std::size_t const cls = get_size_class(size);
+            if (thread_cache* cache = get_thread_cache())
+            {
+                cache->deallocate(p, cls);
+                return;
+            }
+            deallocate_block(p, cls);
+        }
+    }    // namespace detail
+
+    void enable_thread_local_caching(bool enable) noexcept
+    {
+        detail::caching_enabled.store(enable, std::memory_order_relaxed);
+    }
+
+    bool thread_local_caching_enabled() noexcept
+    {
+        return detail::caching_enabled.load(std::memory_order_relaxed);
+    }
+}}    // namespace hpx::util
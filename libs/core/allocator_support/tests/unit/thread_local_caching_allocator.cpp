@@ -0,0 +1,122 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using hpx::util::thread_local_caching_allocator;
+
+template <std::size_t N>
+struct block
+{
+    char data[N];
+};
+
+template <typename T>
+void test_allocate(std::size_t count)
+{
+    thread_local_caching_allocator<T> alloc;
+    using traits = std::allocator_traits<thread_local_caching_allocator<T>>;
+
+    std::vector<T*> blocks;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        T* p = traits::allocate(alloc, 1);
+        HPX_TEST(p != nullptr);
+        HPX_TEST_EQ(reinterpret_cast<std::uintptr_t>(p) % alignof(T),
+            std::uintptr_t(0));
+        std::memset(static_cast<void*>(p), static_cast<int>(i), sizeof(T));
+        blocks.push_back(p);
+    }
+
+    for (T* p : blocks)
+    {
+        traits::deallocate(alloc, p, 1);
+    }
+}
+
+void test_reuse()
+{
+    thread_local_caching_allocator<block<48>> alloc;
+
+    // a freed block is handed out again on the same thread
+    block<48>* p1 = alloc.allocate(1);
+    alloc.deallocate(p1, 1);
+
+    block<48>* p2 = alloc.allocate(1);
+    HPX_TEST_EQ(p1, p2);
+    alloc.deallocate(p2, 1);
+
+    // rebound allocators compare equal
+    thread_local_caching_allocator<char> other(alloc);
+    HPX_TEST(other == alloc);
+}
+
+void test_cross_thread()
+{
+    constexpr std::size_t count = 1000;
+
+    thread_local_caching_allocator<block<64>> alloc;
+
+    std::vector<block<64>*> blocks;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        blocks.push_back(alloc.allocate(1));
+    }
+
+    // free the blocks on another thread, which returns them to the depot
+    // when its cache overflows or when it exits
+    std::thread t([&]() {
+        for (block<64>* p : blocks)
+        {
+            alloc.deallocate(p, 1);
+        }
+    });
+    t.join();
+
+    test_allocate<block<64>>(count);
+}
+
+void test_disabled()
+{
+    HPX_TEST(hpx::util::thread_local_caching_enabled());
+
+    thread_local_caching_allocator<block<32>> alloc;
+    block<32>* p1 = alloc.allocate(1);
+
+    // blocks may be freed after caching was disabled
+    hpx::util::enable_thread_local_caching(false);
+    HPX_TEST(!hpx::util::thread_local_caching_enabled());
+
+    block<32>* p2 = alloc.allocate(1);
+    alloc.deallocate(p1, 1);
+
+    hpx::util::enable_thread_local_caching(true);
+    alloc.deallocate(p2, 1);
+}
+
+int main()
+{
+    test_allocate<char>(100);
+    test_allocate<block<16>>(1000);
+    test_allocate<block<100>>(1000);
+    test_allocate<block<512>>(100);
+    test_allocate<block<4096>>(100);
+
+    test_reuse();
+    test_cross_thread();
+    test_disabled();
+
+    return hpx::util::report_errors();
+}
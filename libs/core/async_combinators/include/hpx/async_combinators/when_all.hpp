@@ -133,7 +133,7 @@ namespace hpx {
 #else    // DOXYGEN
 
 #include <hpx/config.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/futures/detail/future_data.hpp>
 #include <hpx/futures/detail/future_transforms.hpp>
@@ -233,7 +233,7 @@ namespace hpx {
             using no_addref = typename frame_type::base_type::init_no_addref;
 
             auto frame = hpx::util::traverse_pack_async_allocator(
-                hpx::util::internal_allocator<>{},
+                hpx::util::thread_local_caching_allocator<>{},
                 hpx::util::async_traverse_in_place_tag<frame_type>{},
                 no_addref{},
                 hpx::traits::acquire_future_disp()(HPX_FORWARD(T, args))...);
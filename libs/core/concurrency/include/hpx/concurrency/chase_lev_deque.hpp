@@ -0,0 +1,207 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace hpx { namespace concurrency {
+
+    /// \brief A lock-free work-stealing deque (Chase and Lev, 2005).
+    ///
+    /// The deque has a single owner which is the only thread allowed to call
+    /// push() and pop(). Those operate on the bottom end of the deque in LIFO
+    /// order. Any number of other threads (thieves) may concurrently call
+    /// steal(), which takes items from the top end of the deque in FIFO
+    /// order. The memory orderings follow N.M. Lê et al., "Correct and
+    /// Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013).
+    ///
+    /// The underlying circular buffer grows on demand. Buffers which have
+    /// been replaced are retained until the deque is destroyed, as thieves
+    /// might still be reading from them.
+    template <typename T>
+    class chase_lev_deque
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+            "chase_lev_deque requires trivially copyable elements");
+
+        class array
+        {
+        public:
+            explicit array(std::int64_t capacity)
+              : capacity_(capacity)
+              , buffer_(new std::atomic<T>[static_cast<std::size_t>(capacity)])
+            {
+                HPX_ASSERT(capacity > 0 && (capacity & (capacity - 1)) == 0);
+            }
+
+            std::int64_t capacity() const noexcept
+            {
+                return capacity_;
+            }
+
+            void put(std::int64_t i, T item) noexcept
+            {
+                buffer_[i & (capacity_ - 1)].store(
+                    item, std::memory_order_relaxed);
+            }
+
+            T get(std::int64_t i) const noexcept
+            {
+                return buffer_[i & (capacity_ - 1)].load(
+                    std::memory_order_relaxed);
+            }
+
+            array* grow(std::int64_t bottom, std::int64_t top) const
+            {
+                array* a = new array(2 * capacity_);
+                for (std::int64_t i = top; i != bottom; ++i)
+                {
+                    a->put(i, get(i));
+                }
+                return a;
+            }
+
+        private:
+            std::int64_t const capacity_;
+            std::unique_ptr<std::atomic<T>[]> buffer_;
+        };
+
+        static std::int64_t round_up_capacity(std::size_t capacity) noexcept
+        {
+            std::int64_t result = 2;
+            while (result < static_cast<std::int64_t>(capacity))
+            {
+                result *= 2;
+            }
+            return result;
+        }
+
+    public:
+        explicit chase_lev_deque(std::size_t initial_capacity = 1024)
+          : array_(new array(round_up_capacity(initial_capacity)))
+        {
+            top_.data_.store(0, std::memory_order_relaxed);
+            bottom_.data_.store(0, std::memory_order_relaxed);
+        }
+
+        chase_lev_deque(chase_lev_deque const&) = delete;
+        chase_lev_deque(chase_lev_deque&&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque const&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque&&) = delete;
+
+        ~chase_lev_deque()
+        {
+            delete array_.load(std::memory_order_relaxed);
+        }
+
+        /// Push an item onto the bottom end of the deque, may only be called
+        /// by the owner.
+        void push(T item)
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            array* a = array_.load(std::memory_order_relaxed);
+
+            if (b - t > a->capacity() - 1)
+            {
+                retired_.emplace_back(a);
+                a = a->grow(b, t);
+                array_.store(a, std::memory_order_release);
+            }
+
+            a->put(b, item);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+        }
+
+        /// Pop an item from the bottom end of the deque, may only be called
+        /// by the owner. Returns false if the deque was empty.
+        bool pop(T& item)
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed) - 1;
+            array* a = array_.load(std::memory_order_relaxed);
+            bottom_.data_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                // the deque was empty
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            item = a->get(b);
+            if (t == b)
+            {
+                // this is the last item, race against the thieves
+                bool result = top_.data_.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed);
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return result;
+            }
+            return true;
+        }
+
+        /// Steal an item from the top end of the deque, may be called by any
+        /// thread. Returns false if the deque was empty or if the item was
+        /// taken by a concurrent pop() or steal().
+        bool steal(T& item)
+        {
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t b = bottom_.data_.load(std::memory_order_acquire);
+
+            if (t >= b)
+            {
+                return false;
+            }
+
+            array* a = array_.load(std::memory_order_acquire);
+            T result = a->get(t);
+            if (!top_.data_.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            item = result;
+            return true;
+        }
+
+        /// Return the number of items in the deque. This is an estimate only
+        /// if other threads concurrently modify the deque.
+        std::int64_t size() const noexcept
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+            return b > t ? b - t : 0;
+        }
+
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+    private:
+        util::cache_line_data<std::atomic<std::int64_t>> top_;
+        util::cache_line_data<std::atomic<std::int64_t>> bottom_;
+        std::atomic<array*> array_;
+
+        // buffers replaced by push(), only accessed by the owner
+        std::vector<std::unique_ptr<array>> retired_;
+    };
+}}    // namespace hpx::concurrency
@@ -0,0 +1,116 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/chase_lev_deque.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using deque = hpx::concurrency::chase_lev_deque<std::uint64_t>;
+
+void test_sequential()
+{
+    // use a small initial capacity to exercise growing the buffer
+    deque d(4);
+    HPX_TEST(d.empty());
+
+    std::uint64_t item = 0;
+    HPX_TEST(!d.pop(item));
+    HPX_TEST(!d.steal(item));
+
+    for (std::uint64_t i = 0; i != 100; ++i)
+    {
+        d.push(i);
+    }
+    HPX_TEST_EQ(d.size(), std::int64_t(100));
+
+    // the owner pops in LIFO order
+    HPX_TEST(d.pop(item));
+    HPX_TEST_EQ(item, std::uint64_t(99));
+
+    // thieves steal in FIFO order
+    HPX_TEST(d.steal(item));
+    HPX_TEST_EQ(item, std::uint64_t(0));
+
+    for (std::uint64_t i = 1; i != 99; ++i)
+    {
+        HPX_TEST(d.steal(item));
+        HPX_TEST_EQ(item, i);
+    }
+
+    HPX_TEST(d.empty());
+    HPX_TEST(!d.pop(item));
+    HPX_TEST(!d.steal(item));
+}
+
+void test_concurrent(std::size_t num_thieves, std::uint64_t items)
+{
+    deque d(16);
+
+    std::atomic<bool> done(false);
+    std::vector<std::atomic<int>> seen(items);
+    for (auto& s : seen)
+    {
+        s.store(0);
+    }
+
+    std::vector<std::thread> thieves;
+    for (std::size_t i = 0; i != num_thieves; ++i)
+    {
+        thieves.emplace_back([&]() {
+            std::uint64_t item = 0;
+            while (!done.load() || !d.empty())
+            {
+                if (d.steal(item))
+                {
+                    ++seen[item];
+                }
+            }
+        });
+    }
+
+    // the owner pushes all items and pops every other one
+    std::uint64_t item = 0;
+    for (std::uint64_t i = 0; i != items; ++i)
+    {
+        d.push(i);
+        if (i % 2 == 0 && d.pop(item))
+        {
+            ++seen[item];
+        }
+    }
+    while (d.pop(item))
+    {
+        ++seen[item];
+    }
+    done.store(true);
+
+    for (auto& t : thieves)
+    {
+        t.join();
+    }
+
+    // every item must have been taken exactly once
+    for (std::uint64_t i = 0; i != items; ++i)
+    {
+        HPX_TEST_EQ(seen[i].load(), 1);
+    }
+}
+
+int main()
+{
+    test_sequential();
+
+    std::size_t num_thieves = std::thread::hardware_concurrency();
+    test_concurrent(num_thieves > 1 ? num_thieves - 1 : 1, 100000);
+
+    return hpx::util::report_errors();
+}
@@ -408,6 +408,36 @@
 #  define HPX_THREAD_QUEUE_INIT_THREADS_COUNT 10
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Maximum number of recycled thread objects (per stack size) to keep in a
+// thread queue before handing them over to the global overflow pool. Setting
+// this to zero disables recycling of thread objects.
+#if !defined(HPX_THREAD_QUEUE_MAX_RECYCLED_THREAD_COUNT)
+#  define HPX_THREAD_QUEUE_MAX_RECYCLED_THREAD_COUNT 1000
+#endif
+
+// Access the recycled thread objects of a thread queue without acquiring a
+// lock. Setting this to zero protects them with a mutex instead, which is
+// useful for comparing both variants only.
+#if !defined(HPX_THREAD_QUEUE_LOCK_FREE_RECYCLING)
+#  define HPX_THREAD_QUEUE_LOCK_FREE_RECYCLING 1
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// Maximum number of consecutive HPX threads a worker thread runs from its LIFO
+// slot (holding the thread most recently made ready on this worker) before
+// looking at its queues again. Setting this to zero disables the LIFO slot.
+#if !defined(HPX_THREAD_QUEUE_MAX_LIFO_SLOT_RUNS)
+#  define HPX_THREAD_QUEUE_MAX_LIFO_SLOT_RUNS 3
+#endif
+
+// Every Nth HPX thread made ready on a worker thread is used to sample the time
+// threads wait in the scheduling queues. Setting this to zero disables the
+// sampling.
+#if !defined(HPX_THREAD_QUEUE_WAIT_TIME_SAMPLE_INTERVAL)
+#  define HPX_THREAD_QUEUE_WAIT_TIME_SAMPLE_INTERVAL 64
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Maximum sleep time for idle backoff in milliseconds (used only if
 // HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF is defined).
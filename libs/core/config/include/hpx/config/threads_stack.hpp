@@ -55,6 +55,9 @@
 #  endif
 #endif
 
+#if !defined(HPX_REDUCED_STACK_SIZE)
+#  define HPX_REDUCED_STACK_SIZE  0x0004000       // 16kByte
+#endif
 #if !defined(HPX_MEDIUM_STACK_SIZE)
 #  define HPX_MEDIUM_STACK_SIZE   0x0020000       // 128kByte
 #endif
@@ -64,4 +67,11 @@
 #if !defined(HPX_HUGE_STACK_SIZE)
 #  define HPX_HUGE_STACK_SIZE     0x2000000       // 32MByte
 #endif
+
+#if !defined(HPX_STACK_POOL_WATERMARK)
+#  define HPX_STACK_POOL_WATERMARK 0x4000000      // 64MByte
+#endif
+#if !defined(HPX_STACK_POOL_MAX_SIZE)
+#  define HPX_STACK_POOL_MAX_SIZE 0x40000000      // 1GByte
+#endif
 // clang-format on
@@ -59,7 +59,8 @@ namespace hpx { namespace threads { namespace coroutines {
         using result_type = impl_type::result_type;
         using arg_type = impl_type::arg_type;
 
-        using functor_type = hpx::move_only_function<result_type(arg_type)>;
+        using functor_type = hpx::move_only_function<result_type(arg_type),
+            false, functor_storage_size>;
 
         coroutine(functor_type&& f, thread_id_type id,
             std::ptrdiff_t stack_size = detail::default_stack_size)
@@ -162,6 +163,13 @@ namespace hpx { namespace threads { namespace coroutines {
 #endif
         }
 
+        // Return the number of bytes of stack used since the last call, this
+        // is available only if stack usage tracking is enabled.
+        std::ptrdiff_t get_stack_usage()
+        {
+            return impl_.get_stack_usage();
+        }
+
         impl_type* impl()
         {
             return &impl_;
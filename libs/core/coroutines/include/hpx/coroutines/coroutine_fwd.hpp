@@ -32,7 +32,16 @@
 
 #include <hpx/config.hpp>
 
+#include <cstddef>
+
 namespace hpx { namespace threads { namespace coroutines {
+
+    // Thread functions of up to this size are stored inside the coroutine
+    // without a separate heap allocation. This covers tasks capturing a couple
+    // of shared pointers and an id, including the wrappers added by the
+    // executors when scheduling them.
+    inline constexpr std::size_t functor_storage_size = 6 * sizeof(void*);
+
     namespace detail {
         class coroutine_self;
 
@@ -93,6 +93,10 @@ namespace hpx { namespace threads { namespace coroutines {
 #if defined(_POSIX_VERSION)
                 void* limit = posix::alloc_stack(size);
                 posix::watermark_stack(limit, size);
+                if (posix::track_stack_usage)
+                {
+                    posix::paint_stack(limit, size);
+                }
 #else
                 void* limit = std::calloc(size, sizeof(char));
                 if (!limit)
@@ -239,6 +243,22 @@ namespace hpx { namespace threads { namespace coroutines {
 #endif
             }
 
+            // Return the number of bytes of the stack used since the last
+            // call, this is available only if stack usage tracking is enabled.
+            std::ptrdiff_t get_stack_usage()
+            {
+#if defined(_POSIX_VERSION)
+                if (ctx_ && posix::track_stack_usage)
+                {
+                    void* limit =
+                        static_cast<char*>(stack_pointer_) - stack_size_;
+                    return static_cast<std::ptrdiff_t>(
+                        posix::measure_stack_usage(limit, stack_size_));
+                }
+#endif
+                return 0;
+            }
+
             void reset_stack()
             {
                 if (ctx_)
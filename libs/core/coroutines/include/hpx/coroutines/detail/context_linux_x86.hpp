@@ -320,6 +320,11 @@ namespace hpx::threads::coroutines::detail::lx {
 
             posix::watermark_stack(
                 m_stack, static_cast<std::size_t>(m_stack_size));
+            if (posix::track_stack_usage)
+            {
+                posix::paint_stack(
+                    m_stack, static_cast<std::size_t>(m_stack_size));
+            }
 
             typedef void fun(void*);
             fun* funp = trampoline<CoroutineImpl>;
@@ -365,6 +370,18 @@ namespace hpx::threads::coroutines::detail::lx {
             return m_stack_size;
         }
 
+        // Return the number of bytes of the stack used since the last call,
+        // this is available only if stack usage tracking is enabled.
+        std::ptrdiff_t get_stack_usage()
+        {
+            if (!m_stack || !posix::track_stack_usage)
+            {
+                return 0;
+            }
+            return static_cast<std::ptrdiff_t>(posix::measure_stack_usage(
+                m_stack, static_cast<std::size_t>(m_stack_size)));
+        }
+
         void reset_stack()
         {
             HPX_ASSERT(m_stack);
@@ -250,6 +250,12 @@ namespace hpx { namespace threads { namespace coroutines {
                         "could not allocate memory for stack");
                 }
 
+                if (posix::track_stack_usage)
+                {
+                    posix::paint_stack(
+                        m_stack, static_cast<std::size_t>(m_stack_size));
+                }
+
                 int error = HPX_COROUTINE_MAKE_CONTEXT(
                     &m_ctx, m_stack, m_stack_size, funp_, this, nullptr);
 
@@ -346,6 +352,18 @@ namespace hpx { namespace threads { namespace coroutines {
 #endif
             }
 
+            // Return the number of bytes of the stack used since the last
+            // call, this is available only if stack usage tracking is enabled.
+            std::ptrdiff_t get_stack_usage()
+            {
+                if (!m_stack || !posix::track_stack_usage)
+                {
+                    return 0;
+                }
+                return static_cast<std::ptrdiff_t>(posix::measure_stack_usage(
+                    m_stack, static_cast<std::size_t>(m_stack_size)));
+            }
+
             void reset_stack()
             {
                 if (m_stack)
@@ -64,7 +64,8 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
         using result_type = std::pair<thread_schedule_state, thread_id_type>;
         using arg_type = thread_restart_state;
 
-        using functor_type = hpx::move_only_function<result_type(arg_type)>;
+        using functor_type = hpx::move_only_function<result_type(arg_type),
+            false, functor_storage_size>;
 
         coroutine_impl(
             functor_type&& f, thread_id_type id, std::ptrdiff_t stack_size)
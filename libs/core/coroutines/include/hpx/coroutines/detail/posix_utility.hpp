@@ -32,6 +32,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
 
 // include unist.d conditionally to check for POSIX version. Not all OSs have the
 // unistd header...
@@ -74,11 +75,20 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
     namespace posix {
         HPX_CORE_EXPORT extern bool use_guard_pages;
 
+        // this controls whether stacks are painted to measure their usage
+        HPX_CORE_EXPORT extern bool track_stack_usage;
+
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
     _POSIX_MAPPED_FILES > 0
 
         inline void* alloc_stack(std::size_t size)
         {
+            // reuse a previously mapped stack, if possible
+            if (void* stack = stack_pool::get().allocate(size))
+            {
+                return stack;
+            }
+
             void* real_stack = ::mmap(nullptr, size + EXEC_PAGESIZE,
                 PROT_EXEC | PROT_READ | PROT_WRITE,
 #if defined(__APPLE__)
@@ -131,8 +141,58 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
             *watermark = reinterpret_cast<void*>(0xDEADBEEFDEADBEEFull);
         }
 
+        // Fill all but the first page of the stack (which holds the
+        // watermark) with a known pattern.
+        inline void paint_stack(void* stack, std::size_t size)
+        {
+            HPX_ASSERT(size > EXEC_PAGESIZE);
+
+            void** p = static_cast<void**>(stack);
+            void** end = p + ((size - EXEC_PAGESIZE) / sizeof(void*));
+            for (/**/; p != end; ++p)
+            {
+                *p = reinterpret_cast<void*>(0xFEEDFACEFEEDFACEull);
+            }
+        }
+
+        // Return the number of bytes of the stack which have been touched
+        // since it was painted and paint the touched part again. This must
+        // not be called while the stack is in use.
+        inline std::size_t measure_stack_usage(void* stack, std::size_t size)
+        {
+            HPX_ASSERT(size > EXEC_PAGESIZE);
+
+            void** begin = static_cast<void**>(stack);
+            void** end = begin + ((size - EXEC_PAGESIZE) / sizeof(void*));
+
+            void** p = begin;
+            while (p != end &&
+                *p == reinterpret_cast<void*>(0xFEEDFACEFEEDFACEull))
+            {
+                ++p;
+            }
+
+            // paint the touched part of the stack again
+            std::size_t usage = static_cast<std::size_t>(end - p) *
+                sizeof(void*);
+            for (void** q = p; q != end; ++q)
+            {
+                *q = reinterpret_cast<void*>(0xFEEDFACEFEEDFACEull);
+            }
+
+            // the first page is always in use
+            return usage + EXEC_PAGESIZE;
+        }
+
         inline bool reset_stack(void* stack, std::size_t size)
         {
+            // the stack's memory must not be released as this would discard
+            // its painting
+            if (track_stack_usage)
+            {
+                return false;
+            }
+
             void** watermark = static_cast<void**>(stack) +
                 ((size - EXEC_PAGESIZE) / sizeof(void*));
 
@@ -151,6 +211,12 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
 
         inline void free_stack(void* stack, std::size_t size)
         {
+            // keep the stack mapped for later reuse, if possible
+            if (stack_pool::get().deallocate(stack, size))
+            {
+                return;
+            }
+
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
             if (use_guard_pages)
             {
@@ -196,6 +262,13 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
         inline void watermark_stack(void* stack, std::size_t size) {
         }    // no-op
 
+        inline void paint_stack(void* stack, std::size_t size) {}    // no-op
+
+        inline std::size_t measure_stack_usage(void* stack, std::size_t size)
+        {
+            return 0;
+        }
+
         inline bool reset_stack(void* stack, std::size_t size)
         {
             return false;
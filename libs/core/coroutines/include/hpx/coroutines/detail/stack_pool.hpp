@@ -0,0 +1,94 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace hpx { namespace threads { namespace coroutines { namespace detail {
+    namespace posix {
+
+        ///////////////////////////////////////////////////////////////////////
+        // The stack pool caches the mapped stacks of destroyed coroutines for
+        // the whole process, which avoids mmap/munmap (and mprotect) calls
+        // for every stack. Stacks are kept in separate free lists per NUMA
+        // domain (as reported by the OS for the calling thread) and size.
+        //
+        // Once the cached stacks occupy more than 'watermark' bytes, the
+        // memory of the least recently cached stacks is handed back to the OS
+        // using madvise (the mappings stay valid). Stacks beyond 'max_size'
+        // bytes of cached address space are not pooled at all.
+        class HPX_CORE_EXPORT stack_pool
+        {
+        public:
+            static constexpr std::size_t max_numa_domains = 8;
+
+            static stack_pool& get() noexcept;
+
+            // Set the sizes (in bytes) of cached memory that is allowed to
+            // stay resident and of cached address space.
+            void configure(std::size_t watermark, std::size_t max_size) noexcept
+            {
+                watermark_.store(watermark, std::memory_order_relaxed);
+                max_size_.store(max_size, std::memory_order_relaxed);
+            }
+
+            // Return a cached stack of the given size, or nullptr if none
+            // is available.
+            void* allocate(std::size_t size);
+
+            // Cache the given stack, returns false if the stack was not
+            // accepted and has to be unmapped by the caller.
+            bool deallocate(void* stack, std::size_t size);
+
+            // Performance counter data
+            std::int64_t get_hit_count(bool reset);
+            std::int64_t get_miss_count(bool reset);
+            std::int64_t get_release_count(bool reset);
+            std::int64_t get_cached_bytes(bool reset);
+            std::int64_t get_resident_bytes(bool reset);
+
+        private:
+            stack_pool() = default;
+
+            // Stacks are pushed to and taken from the back of a free list,
+            // the first 'num_released' entries have been released to the OS.
+            struct free_list
+            {
+                std::size_t size;
+                std::vector<void*> stacks;
+                std::size_t num_released;
+            };
+
+            struct numa_domain
+            {
+                std::mutex mtx;
+                std::vector<free_list> lists;
+            };
+
+            static std::size_t get_numa_domain() noexcept;
+
+            void release_stacks(numa_domain& domain);
+
+            numa_domain domains_[max_numa_domains];
+
+            std::atomic<std::size_t> watermark_{HPX_STACK_POOL_WATERMARK};
+            std::atomic<std::size_t> max_size_{HPX_STACK_POOL_MAX_SIZE};
+
+            std::atomic<std::int64_t> cached_bytes_{0};
+            std::atomic<std::int64_t> resident_bytes_{0};
+
+            std::atomic<std::int64_t> hits_{0};
+            std::atomic<std::int64_t> misses_{0};
+            std::atomic<std::int64_t> releases_{0};
+        };
+}}}}}    // namespace hpx::threads::coroutines::detail::posix
@@ -172,6 +172,9 @@ namespace hpx { namespace threads {
         nostack = 5,    ///< this thread does not suspend
                         ///< (does not need a stack)
         current = 6,    ///< use size of current thread's stack
+        reduced = 7,    ///< use a stack smaller than the default one, this
+                        ///< is selected by the adaptive stack size policy
+                        ///< for threads known to use very little stack
 
         default_ = small_,    ///< use default stack size
         minimal = small_,     ///< use minimally stack size
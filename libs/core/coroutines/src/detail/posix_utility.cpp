@@ -16,5 +16,9 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
         // this global (urghhh) variable is used to control whether guard pages
         // will be used or not
         HPX_CORE_EXPORT bool use_guard_pages = true;
+
+        // this variable is used to control whether the usage of stacks will
+        // be measured
+        HPX_CORE_EXPORT bool track_stack_usage = false;
 }}}}}    // namespace hpx::threads::coroutines::detail::posix
 #endif
@@ -0,0 +1,180 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+#include <hpx/assert.hpp>
+#include <hpx/coroutines/detail/stack_pool.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <sys/mman.h>
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace hpx { namespace threads { namespace coroutines { namespace detail {
+    namespace posix {
+
+        stack_pool& stack_pool::get() noexcept
+        {
+            static stack_pool pool;
+            return pool;
+        }
+
+        std::size_t stack_pool::get_numa_domain() noexcept
+        {
+#if (defined(__linux) || defined(linux) || defined(__linux__)) &&              \
+    defined(SYS_getcpu)
+            unsigned cpu = 0;
+            unsigned node = 0;
+            if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+            {
+                return node % max_numa_domains;
+            }
+#endif
+            return 0;
+        }
+
+        void* stack_pool::allocate(std::size_t size)
+        {
+            // try the free lists of our own NUMA domain first
+            std::size_t const first = get_numa_domain();
+            for (std::size_t i = 0; i != max_numa_domains; ++i)
+            {
+                numa_domain& domain =
+                    domains_[(first + i) % max_numa_domains];
+
+                std::lock_guard<std::mutex> l(domain.mtx);
+                for (free_list& list : domain.lists)
+                {
+                    if (list.size != size || list.stacks.empty())
+                    {
+                        continue;
+                    }
+
+                    void* stack = list.stacks.back();
+                    list.stacks.pop_back();
+
+                    auto const bytes = static_cast<std::int64_t>(size);
+                    cached_bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+                    if (list.num_released > list.stacks.size())
+                    {
+                        // this stack has been released already
+                        --list.num_released;
+                    }
+                    else
+                    {
+                        resident_bytes_.fetch_sub(
+                            bytes, std::memory_order_relaxed);
+                    }
+
+                    hits_.fetch_add(1, std::memory_order_relaxed);
+                    return stack;
+                }
+            }
+
+            misses_.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        bool stack_pool::deallocate(void* stack, std::size_t size)
+        {
+            auto const bytes = static_cast<std::int64_t>(size);
+            if (cached_bytes_.fetch_add(bytes, std::memory_order_relaxed) +
+                    bytes >
+                static_cast<std::int64_t>(
+                    max_size_.load(std::memory_order_relaxed)))
+            {
+                cached_bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+                return false;
+            }
+
+            numa_domain& domain = domains_[get_numa_domain()];
+
+            std::lock_guard<std::mutex> l(domain.mtx);
+
+            auto it = std::find_if(domain.lists.begin(), domain.lists.end(),
+                [&](free_list const& list) { return list.size == size; });
+            if (it == domain.lists.end())
+            {
+                domain.lists.push_back(free_list{size, {}, 0});
+                it = domain.lists.end() - 1;
+            }
+            it->stacks.push_back(stack);
+
+            if (resident_bytes_.fetch_add(bytes, std::memory_order_relaxed) +
+                    bytes >
+                static_cast<std::int64_t>(
+                    watermark_.load(std::memory_order_relaxed)))
+            {
+                release_stacks(domain);
+            }
+            return true;
+        }
+
+        // Release the memory of the least recently cached stacks of the given
+        // domain until the resident size drops below the watermark. This has
+        // to be called with the domain's mutex held, as otherwise a stack
+        // could be handed out while it is being released.
+        void stack_pool::release_stacks(numa_domain& domain)
+        {
+            auto const watermark = static_cast<std::int64_t>(
+                watermark_.load(std::memory_order_relaxed));
+
+            for (free_list& list : domain.lists)
+            {
+                while (list.num_released != list.stacks.size() &&
+                    resident_bytes_.load(std::memory_order_relaxed) > watermark)
+                {
+                    void* stack = list.stacks[list.num_released++];
+#if defined(MADV_FREE)
+                    ::madvise(stack, list.size, MADV_FREE);
+#else
+                    ::madvise(stack, list.size, MADV_DONTNEED);
+#endif
+                    resident_bytes_.fetch_sub(
+                        static_cast<std::int64_t>(list.size),
+                        std::memory_order_relaxed);
+                    releases_.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        std::int64_t stack_pool::get_hit_count(bool reset)
+        {
+            return util::get_and_reset_value(hits_, reset);
+        }
+
+        std::int64_t stack_pool::get_miss_count(bool reset)
+        {
+            return util::get_and_reset_value(misses_, reset);
+        }
+
+        std::int64_t stack_pool::get_release_count(bool reset)
+        {
+            return util::get_and_reset_value(releases_, reset);
+        }
+
+        std::int64_t stack_pool::get_cached_bytes(bool /* reset */)
+        {
+            return cached_bytes_.load(std::memory_order_relaxed);
+        }
+
+        std::int64_t stack_pool::get_resident_bytes(bool /* reset */)
+        {
+            return resident_bytes_.load(std::memory_order_relaxed);
+        }
+}}}}}    // namespace hpx::threads::coroutines::detail::posix
+#endif
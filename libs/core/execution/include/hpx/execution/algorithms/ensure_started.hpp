@@ -8,7 +8,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/allocator_support/traits/is_allocator.hpp>
 #include <hpx/concepts/concepts.hpp>
 #include <hpx/execution/algorithms/detail/partial_algorithm.hpp>
@@ -54,7 +54,7 @@ namespace hpx::execution::experimental {
     private:
         // clang-format off
         template <typename Sender,
-            typename Allocator = hpx::util::internal_allocator<>,
+            typename Allocator = hpx::util::thread_local_caching_allocator<>,
             HPX_CONCEPT_REQUIRES_(
                 is_sender_v<Sender> &&
                 hpx::traits::is_allocator_v<Allocator> &&
@@ -77,7 +77,7 @@ namespace hpx::execution::experimental {
 
         // clang-format off
         template <typename Sender,
-            typename Allocator = hpx::util::internal_allocator<>,
+            typename Allocator = hpx::util::thread_local_caching_allocator<>,
             HPX_CONCEPT_REQUIRES_(
                 is_sender_v<Sender> &&
                 hpx::traits::is_allocator_v<Allocator>
@@ -103,7 +103,8 @@ namespace hpx::execution::experimental {
         }
 
         // clang-format off
-        template <typename Allocator = hpx::util::internal_allocator<>,
+        template <
+            typename Allocator = hpx::util::thread_local_caching_allocator<>,
             HPX_CONCEPT_REQUIRES_(
                 hpx::traits::is_allocator_v<Allocator>
             )>
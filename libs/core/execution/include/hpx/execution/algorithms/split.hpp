@@ -9,11 +9,10 @@
 
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/allocator_deleter.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/allocator_support/traits/is_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/concepts/concepts.hpp>
-#include <hpx/datastructures/detail/small_vector.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/datastructures/variant.hpp>
 #include <hpx/errors/try_catch_exception_ptr.hpp>
@@ -27,7 +26,6 @@
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/functional/detail/tag_priority_invoke.hpp>
 #include <hpx/functional/invoke_fused.hpp>
-#include <hpx/functional/move_only_function.hpp>
 #include <hpx/modules/memory.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/thread_support/atomic_count.hpp>
@@ -148,8 +146,27 @@ namespace hpx::execution::experimental {
                     value_type>
                     v;
 
-                using continuation_type = hpx::move_only_function<void()>;
-                hpx::detail::small_vector<continuation_type, 1> continuations;
+                // Operation states waiting for the predecessor to complete
+                // are linked into an intrusive list, which avoids allocating
+                // memory for each continuation. An operation state stays alive
+                // until it has been completed.
+                struct continuation_base
+                {
+                    using complete_function_type =
+                        void (*)(continuation_base&) noexcept;
+
+                    explicit continuation_base(
+                        complete_function_type complete) noexcept
+                      : complete(complete)
+                    {
+                    }
+
+                    complete_function_type complete;
+                    continuation_base* next = nullptr;
+                };
+
+                continuation_base* continuations = nullptr;
+                continuation_base** continuations_tail = &continuations;
 
                 struct split_receiver
                 {
@@ -282,56 +299,55 @@ namespace hpx::execution::experimental {
 
                     {
                         // We require taking the lock here to synchronize with
-                        // threads attempting to add continuations to the vector
+                        // threads attempting to add continuations to the list
                         // of continuations. However, it is enough to take it
                         // once and release it immediately.
                         //
-                        // Without the lock we may not see writes to the vector.
+                        // Without the lock we may not see writes to the list.
                         // With the lock threads attempting to add continuations
                         // will either:
                         // - See predecessor_done = true in which case they will
                         //   call the continuation directly without adding it to
-                        //   the vector of continuations. Accessing the vector
-                        //   below without the lock is safe in this case because
-                        //   the vector is not modified.
+                        //   the list of continuations. Accessing the list below
+                        //   without the lock is safe in this case because the
+                        //   list is not modified.
                         // - See predecessor_done = false and proceed to take
                         //   the lock. If they see predecessor_done after taking
                         //   the lock they can again release the lock and call
-                        //   the continuation directly. Accessing the vector
-                        //   without the lock is again safe because the vector
-                        //   is not modified.
+                        //   the continuation directly. Accessing the list
+                        //   without the lock is again safe because the list is
+                        //   not modified.
                         // - See predecessor_done = false and proceed to take
                         //   the lock. If they see predecessor_done is still
                         //   false after taking the lock, they will proceed to
-                        //   add a continuation to the vector. Since they keep
-                        //   the lock they can safely write to the vector. This
-                        //   thread will not proceed past the lock until they
-                        //   have finished writing to the vector.
+                        //   add a continuation to the list. Since they keep the
+                        //   lock they can safely write to the list. This thread
+                        //   will not proceed past the lock until they have
+                        //   finished writing to the list.
                         //
                         // Importantly, once this thread has taken and released
                         // this lock, threads attempting to add continuations to
-                        // the vector must see predecessor_done = true after
+                        // the list must see predecessor_done = true after
                         // taking the lock in their threads and will not add
-                        // continuations to the vector.
+                        // continuations to the list.
                         std::unique_lock l{mtx};
                     }
 
-                    if (!continuations.empty())
-                    {
-                        for (auto const& continuation : continuations)
-                        {
-                            continuation();
-                        }
+                    continuation_base* continuation = continuations;
+                    continuations = nullptr;
+                    continuations_tail = &continuations;
 
-                        continuations.clear();
+                    while (continuation != nullptr)
+                    {
+                        // completing a continuation may destroy the operation
+                        // state it is embedded in
+                        continuation_base* next = continuation->next;
+                        continuation->complete(*continuation);
+                        continuation = next;
                     }
                 }
 
-                template <typename Receiver>
-                void add_continuation(Receiver& receiver) = delete;
-
-                template <typename Receiver>
-                void add_continuation(Receiver&& receiver)
+                void add_continuation(continuation_base& continuation)
                 {
                     if (predecessor_done)
                     {
@@ -341,16 +357,13 @@ namespace hpx::execution::experimental {
                         // We can trigger the continuation directly.
                         // TODO: Should this preserve the scheduler? It does not
                         // if we call set_* inline.
-                        hpx::visit(
-                            done_error_value_visitor<Receiver>{
-                                HPX_FORWARD(Receiver, receiver)},
-                            v);
+                        continuation.complete(continuation);
                     }
                     else
                     {
                         // If predecessor_done is false, we have to take the
                         // lock to potentially add the continuation to the
-                        // vector of continuations.
+                        // list of continuations.
                         std::unique_lock l{mtx};
 
                         if (predecessor_done)
@@ -360,29 +373,19 @@ namespace hpx::execution::experimental {
                             // release the lock early and call the continuation
                             // directly again.
                             l.unlock();
-                            hpx::visit(
-                                done_error_value_visitor<Receiver>{
-                                    HPX_FORWARD(Receiver, receiver)},
-                                v);
+                            continuation.complete(continuation);
                         }
                         else
                         {
                             // If predecessor_done is still false, we add the
-                            // continuation to the vector of continuations. This
+                            // continuation to the list of continuations. This
                             // has to be done while holding the lock, since
                             // other threads may also try to add continuations
-                            // to the vector and the vector is not threadsafe in
-                            // itself. The continuation will be called later
-                            // when set_error/set_stopped/set_value is called.
-                            continuations.emplace_back(
-                                [this,
-                                    receiver = HPX_FORWARD(
-                                        Receiver, receiver)]() mutable {
-                                    hpx::visit(
-                                        done_error_value_visitor<Receiver>{
-                                            HPX_MOVE(receiver)},
-                                        v);
-                                });
+                            // to the list. The continuation will be called
+                            // later when set_error/set_stopped/set_value is
+                            // called.
+                            *continuations_tail = &continuation;
+                            continuations_tail = &continuation.next;
                         }
                     }
                 }
@@ -448,15 +451,19 @@ namespace hpx::execution::experimental {
             split_sender& operator=(split_sender&&) = default;
 
             template <typename Receiver>
-            struct operation_state
+            struct operation_state : shared_state::continuation_base
             {
+                using continuation_base =
+                    typename shared_state::continuation_base;
+
                 HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
                 hpx::intrusive_ptr<shared_state> state;
 
                 template <typename Receiver_>
                 operation_state(Receiver_&& receiver,
                     hpx::intrusive_ptr<shared_state> state)
-                  : receiver(HPX_FORWARD(Receiver_, receiver))
+                  : continuation_base(&operation_state::complete)
+                  , receiver(HPX_FORWARD(Receiver_, receiver))
                   , state(HPX_MOVE(state))
                 {
                 }
@@ -476,7 +483,19 @@ namespace hpx::execution::experimental {
                         os.state->start();
                     }
 
-                    os.state->add_continuation(HPX_MOVE(os.receiver));
+                    os.state->add_continuation(os);
+                }
+
+            private:
+                static void complete(continuation_base& continuation) noexcept
+                {
+                    using visitor_type = typename shared_state::
+                        template done_error_value_visitor<
+                            std::decay_t<Receiver>>;
+
+                    auto& os = static_cast<operation_state&>(continuation);
+                    hpx::visit(
+                        visitor_type{HPX_MOVE(os.receiver)}, os.state->v);
                 }
             };
 
@@ -522,7 +541,7 @@ namespace hpx::execution::experimental {
     private:
         // clang-format off
         template <typename Sender,
-            typename Allocator = hpx::util::internal_allocator<>,
+            typename Allocator = hpx::util::thread_local_caching_allocator<>,
             HPX_CONCEPT_REQUIRES_(
                 is_sender_v<Sender> &&
                 hpx::traits::is_allocator_v<Allocator> &&
@@ -545,7 +564,7 @@ namespace hpx::execution::experimental {
 
         // clang-format off
         template <typename Sender,
-            typename Allocator = hpx::util::internal_allocator<>,
+            typename Allocator = hpx::util::thread_local_caching_allocator<>,
             HPX_CONCEPT_REQUIRES_(
                 is_sender_v<Sender> &&
                 hpx::traits::is_allocator_v<Allocator>
@@ -570,7 +589,8 @@ namespace hpx::execution::experimental {
         }
 
         // clang-format off
-        template <typename Allocator = hpx::util::internal_allocator<>,
+        template <
+            typename Allocator = hpx::util::thread_local_caching_allocator<>,
             HPX_CONCEPT_REQUIRES_(
                 hpx::traits::is_allocator_v<Allocator>
             )>
@@ -9,7 +9,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/allocator_deleter.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/allocator_support/traits/is_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/concepts/concepts.hpp>
@@ -130,7 +130,7 @@ namespace hpx::execution::experimental {
     private:
         // clang-format off
         template <typename Sender,
-            typename Allocator = hpx::util::internal_allocator<>,
+            typename Allocator = hpx::util::thread_local_caching_allocator<>,
             HPX_CONCEPT_REQUIRES_(
                 is_sender_v<Sender> &&
                 hpx::traits::is_allocator_v<Allocator> &&
@@ -153,7 +153,7 @@ namespace hpx::execution::experimental {
 
         // clang-format off
         template <typename Sender,
-            typename Allocator = hpx::util::internal_allocator<>,
+            typename Allocator = hpx::util::thread_local_caching_allocator<>,
             HPX_CONCEPT_REQUIRES_(
                 is_sender_v<Sender> &&
                 hpx::traits::is_allocator_v<Allocator>
@@ -182,7 +182,8 @@ namespace hpx::execution::experimental {
         }
 
         // clang-format off
-        template <typename Allocator = hpx::util::internal_allocator<>,
+        template <
+            typename Allocator = hpx::util::thread_local_caching_allocator<>,
             HPX_CONCEPT_REQUIRES_(
                 hpx::traits::is_allocator_v<Allocator>
             )>
@@ -12,6 +12,7 @@
 #include <hpx/execution/detail/sync_launch_policy_dispatch.hpp>
 #include <hpx/functional/deferred_call.hpp>
 #include <hpx/functional/invoke.hpp>
+#include <hpx/threading_base/detail/stackless_fast_path.hpp>
 #include <hpx/threading_base/thread_description.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/threading_base/thread_num_tss.hpp>
@@ -39,7 +40,8 @@ namespace hpx::detail {
             threads::thread_init_data data(
                 threads::make_thread_function_nullary(hpx::util::deferred_call(
                     HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...)),
-                desc, policy.priority(), policy.hint(), policy.stacksize(),
+                desc, policy.priority(), policy.hint(),
+                threads::detail::get_stacksize_for<F>(policy.stacksize()),
                 threads::thread_schedule_state::pending);
 
             threads::register_work(data, pool);
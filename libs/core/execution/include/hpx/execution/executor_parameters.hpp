@@ -8,8 +8,10 @@
 
 #include <hpx/config.hpp>
 
+#include <hpx/execution/executors/adaptive_chunk_size.hpp>
 #include <hpx/execution/executors/auto_chunk_size.hpp>
 #include <hpx/execution/executors/dynamic_chunk_size.hpp>
 #include <hpx/execution/executors/guided_chunk_size.hpp>
+#include <hpx/execution/executors/numa_affine_chunks.hpp>
 #include <hpx/execution/executors/persistent_auto_chunk_size.hpp>
 #include <hpx/execution/executors/static_chunk_size.hpp>
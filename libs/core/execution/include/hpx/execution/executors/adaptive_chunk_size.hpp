@@ -0,0 +1,265 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/adaptive_chunk_size.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_base/scheduling_properties.hpp>
+#include <hpx/execution_base/traits/is_executor.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/serialization/serialize.hpp>
+
+#include <hpx/execution/executors/execution.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+
+namespace hpx { namespace execution { namespace experimental {
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        // The values learned for one call site of a parallel algorithm. All
+        // times are in nanoseconds.
+        struct adaptive_chunk_size_site
+        {
+            // moving averages of the measured values
+            std::atomic<std::int64_t> iteration_time{0};
+            std::atomic<std::int64_t> task_overhead{0};
+
+            // the chunk size used by the last invocation
+            std::atomic<std::int64_t> chunk_size{0};
+
+            std::atomic<std::int64_t> invocations{0};
+            std::atomic<std::int64_t> measurements{0};
+        };
+
+        // Return the entry for the given call site, creating it if needed.
+        // Entries are never removed, the returned reference stays valid.
+        HPX_CORE_EXPORT adaptive_chunk_size_site& get_adaptive_chunk_size_site(
+            char const* site);
+
+        // Add a new sample to the moving average (the first sample is taken
+        // as is).
+        HPX_CORE_EXPORT void update_adaptive_chunk_size_average(
+            std::atomic<std::int64_t>& average, std::int64_t sample) noexcept;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into pieces and then assigned to threads.
+    /// The number of loop iterations combined is chosen such that each chunk
+    /// runs for (at least) the given target duration, based on the execution
+    /// time per iteration and the overhead of scheduling a task measured in
+    /// earlier invocations of the same parallel algorithm.
+    ///
+    /// The measured values are remembered for each call site. A call site is
+    /// identified by the annotation of the executor used (if any) or by the
+    /// type of the function executed by the algorithm otherwise. The first
+    /// invocations for a call site measure the execution time of a chunk and
+    /// the task overhead, later invocations measure only once in a while and
+    /// otherwise use the learned values without any additional cost.
+    ///
+    /// The learned values are available from the /chunking performance
+    /// counters, using the annotation as the parameter. Call sites without an
+    /// annotation are included in the totals only, the counters can't be
+    /// queried for them individually.
+    ///
+    /// \note The chunks are never made larger than necessary to create one
+    ///       chunk per core.
+    ///
+    struct adaptive_chunk_size
+    {
+        /// Construct an \a adaptive_chunk_size executor parameters object
+        ///
+        /// \note Default constructed \a adaptive_chunk_size executor
+        ///       parameter types will use 200 microseconds as the target
+        ///       execution time for each chunk.
+        ///
+        constexpr adaptive_chunk_size() noexcept
+          : target_time_(200000)
+        {
+        }
+
+        /// Construct an \a adaptive_chunk_size executor parameters object
+        ///
+        /// \param target_time  [in] The time each of the scheduled chunks
+        ///                     should run. The target time is raised to ten
+        ///                     times the measured task overhead, if necessary.
+        ///
+        explicit adaptive_chunk_size(
+            hpx::chrono::steady_duration const& target_time) noexcept
+          : target_time_(target_time.value().count())
+        {
+        }
+
+        /// \cond NOINTERNAL
+        // This executor parameters type synchronously invokes the provided
+        // testing function in order to measure the time per iteration.
+        using invokes_testing_function = std::true_type;
+
+        template <typename Executor, typename F>
+        std::size_t get_chunk_size(
+            Executor& exec, F&& f, std::size_t cores, std::size_t count)
+        {
+            if (cores == 0)
+            {
+                cores = 1;
+            }
+
+            detail::adaptive_chunk_size_site& site =
+                detail::get_adaptive_chunk_size_site(get_site<F>(exec));
+
+            std::int64_t const invocation =
+                site.invocations.fetch_add(1, std::memory_order_relaxed);
+
+            // measure the first invocations for each call site, afterwards
+            // every 16th invocation only
+            if (count > 1 && (invocation < 8 || (invocation & 15) == 0))
+            {
+                count -= measure(site, exec, f, cores, count);
+            }
+
+            std::size_t chunk_size = (count + cores - 1) / cores;
+
+            std::int64_t const iteration_time =
+                site.iteration_time.load(std::memory_order_relaxed);
+            if (iteration_time != 0)
+            {
+                std::int64_t const target_time = (std::max)(target_time_,
+                    10 * site.task_overhead.load(std::memory_order_relaxed));
+
+                chunk_size = (std::min)(chunk_size,
+                    static_cast<std::size_t>(target_time / iteration_time));
+            }
+
+            if (chunk_size == 0)
+            {
+                chunk_size = 1;
+            }
+
+            site.chunk_size.store(static_cast<std::int64_t>(chunk_size),
+                std::memory_order_relaxed);
+            return chunk_size;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        template <typename F, typename Executor>
+        static char const* get_site(Executor const& exec) noexcept
+        {
+            if constexpr (hpx::functional::is_tag_invocable_v<
+                              hpx::execution::experimental::get_annotation_t,
+                              Executor const&>)
+            {
+                char const* annotation =
+                    hpx::execution::experimental::get_annotation(exec);
+                if (annotation != nullptr)
+                {
+                    return annotation;
+                }
+            }
+
+            // the (mangled) type name keeps unannotated sites apart, it is
+            // not meant to be used as a counter parameter
+            return typeid(F).name();
+        }
+
+        // Run a test chunk to measure the time per iteration, and an empty
+        // task to measure the overhead of scheduling it. Returns the number
+        // of iterations executed.
+        template <typename Executor, typename F>
+        static std::size_t measure(detail::adaptive_chunk_size_site& site,
+            Executor& exec, F& f, std::size_t cores, std::size_t count)
+        {
+            using hpx::chrono::high_resolution_clock;
+
+            // use the learned chunk size, but run at most a quarter of the
+            // iterations of one core sequentially
+            std::size_t test_chunk_size = static_cast<std::size_t>(
+                site.chunk_size.load(std::memory_order_relaxed));
+            if (test_chunk_size == 0)
+            {
+                test_chunk_size = count / 100;
+            }
+            test_chunk_size = (std::max)(std::size_t(1),
+                (std::min)(test_chunk_size, count / (4 * cores)));
+
+            std::uint64_t t = high_resolution_clock::now();
+            std::size_t const executed = f(test_chunk_size);
+            if (executed == 0)
+            {
+                return 0;
+            }
+
+            t = high_resolution_clock::now() - t;
+            detail::update_adaptive_chunk_size_average(site.iteration_time,
+                (std::max)(std::int64_t(1),
+                    static_cast<std::int64_t>(t / executed)));
+
+            if constexpr (hpx::traits::is_two_way_executor_v<Executor>)
+            {
+                t = high_resolution_clock::now();
+                hpx::parallel::execution::async_execute(exec, []() {}).get();
+                t = high_resolution_clock::now() - t;
+
+                detail::update_adaptive_chunk_size_average(
+                    site.task_overhead, static_cast<std::int64_t>(t));
+            }
+
+            site.measurements.fetch_add(1, std::memory_order_relaxed);
+            return executed;
+        }
+
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, const unsigned int /* version */)
+        {
+            // clang-format off
+            ar & target_time_;
+            // clang-format on
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::int64_t target_time_;    // nanoseconds
+        /// \endcond
+    };
+}}}    // namespace hpx::execution::experimental
+
+namespace hpx { namespace parallel { namespace execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<
+        hpx::execution::experimental::adaptive_chunk_size> : std::true_type
+    {
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
+
+namespace hpx { namespace parallel { namespace execution { namespace detail {
+    // Retrieve the values learned by adaptive_chunk_size for the given call
+    // site. If no site is given the values are averaged (the measurements
+    // are summed up) over all call sites.
+    HPX_CORE_EXPORT std::int64_t get_adaptive_chunk_size_sites(bool reset);
+    HPX_CORE_EXPORT std::int64_t get_adaptive_chunk_size_iteration_time(
+        std::string const& site, bool reset);
+    HPX_CORE_EXPORT std::int64_t get_adaptive_chunk_size_task_overhead(
+        std::string const& site, bool reset);
+    HPX_CORE_EXPORT std::int64_t get_adaptive_chunk_size_chunk_size(
+        std::string const& site, bool reset);
+    HPX_CORE_EXPORT std::int64_t get_adaptive_chunk_size_measurements(
+        std::string const& site, bool reset);
+}}}}    // namespace hpx::parallel::execution::detail
@@ -0,0 +1,127 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/numa_affine_chunks.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/serialization/serialize.hpp>
+
+#include <hpx/execution/executors/execution_parameters_fwd.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace hpx { namespace execution { namespace experimental {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into chunks of
+    /// ceil(num_tasks / (cores * chunks_per_core)) iterations each (except
+    /// possibly the last one), resulting in at most \a chunks_per_core chunks
+    /// per core. For small numbers of loop iterations fewer chunks are
+    /// created, e.g. 9 iterations on 4 cores result in 3 chunks of 3
+    /// iterations. The chunk boundaries depend only on the number of cores
+    /// and the number of loop iterations. Executors that place consecutive
+    /// chunks onto consecutive worker threads (like the
+    /// \a parallel_executor, or the \a block_executor for NUMA domains) will
+    /// therefore run the same index range on the same worker thread in every
+    /// invocation.
+    ///
+    /// If the memory the loop operates on was first touched using the same
+    /// executor and parameters (e.g. through a \a policy_allocator or a
+    /// \a block_allocator), each worker thread accesses memory local to its
+    /// NUMA domain. A \a numa_allocator splits the memory at
+    /// (i * num_tasks) / num_domains instead. These boundaries differ from
+    /// the chunk boundaries by less than one element per chunk preceding
+    /// them, which is negligible for large arrays.
+    ///
+    /// \note The placement of the chunks onto worker threads is a hint to the
+    ///       scheduler only. Work stealing across NUMA domains should be
+    ///       disabled (hpx.numa_sensitive=2) to keep the chunks in place.
+    ///
+    /// \note This executor parameters type is similar to OpenMP's STATIC
+    ///       scheduling directive without a chunk size.
+    ///
+    struct numa_affine_chunks
+    {
+        /// Construct a \a numa_affine_chunks executor parameters object
+        ///
+        /// \note By default at most one chunk per core is created.
+        ///
+        constexpr numa_affine_chunks() noexcept
+          : chunks_per_core_(1)
+        {
+        }
+
+        /// Construct a \a numa_affine_chunks executor parameters object
+        ///
+        /// \param chunks_per_core  [in] The number of chunks to create for
+        ///                     each core. Using more than one chunk per core
+        ///                     keeps the chunks of a core adjacent to each
+        ///                     other while allowing for smaller blocks of
+        ///                     work.
+        ///
+        constexpr explicit numa_affine_chunks(
+            std::size_t chunks_per_core) noexcept
+          : chunks_per_core_(chunks_per_core == 0 ? 1 : chunks_per_core)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        template <typename Executor, typename F>
+        std::size_t get_chunk_size(
+            Executor& exec, F&&, std::size_t cores, std::size_t num_tasks)
+        {
+            // Make sure the internal round robin counter of the executor is
+            // reset, the first chunk has to go to the first core
+            parallel::execution::reset_thread_distribution(*this, exec);
+
+            std::size_t const num_chunks = (cores == 0 ? 1 : cores) *
+                chunks_per_core_;
+
+            std::size_t const chunk_size =
+                (num_tasks + num_chunks - 1) / num_chunks;
+            return chunk_size == 0 ? 1 : chunk_size;
+        }
+
+        template <typename Executor>
+        constexpr std::size_t maximal_number_of_chunks(
+            Executor&&, std::size_t cores, std::size_t) const noexcept
+        {
+            return (cores == 0 ? 1 : cores) * chunks_per_core_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, const unsigned int /* version */)
+        {
+            // clang-format off
+            ar & chunks_per_core_;
+            // clang-format on
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t chunks_per_core_;
+        /// \endcond
+    };
+}}}    // namespace hpx::execution::experimental
+
+namespace hpx { namespace parallel { namespace execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<
+        hpx::execution::experimental::numa_affine_chunks> : std::true_type
+    {
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
@@ -0,0 +1,28 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_CXX20_EXPERIMENTAL_SIMD)
+#include <experimental/simd>
+
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE std::experimental::simd<T, Abi> choose(
+        std::experimental::simd_mask<T, Abi> const& msk,
+        std::experimental::simd<T, Abi> const& v_true,
+        std::experimental::simd<T, Abi> const& v_false)
+    {
+        std::experimental::simd<T, Abi> result = v_false;
+        std::experimental::where(msk, result) = v_true;
+        return result;
+    }
+}}}    // namespace hpx::parallel::traits
+
+#endif
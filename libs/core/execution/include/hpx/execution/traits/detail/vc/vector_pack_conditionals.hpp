@@ -0,0 +1,26 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_VC)
+#include <Vc/Vc>
+#include <Vc/global.h>
+
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Vc::Vector<T, Abi> choose(
+        Vc::Mask<T, Abi> const& msk, Vc::Vector<T, Abi> const& v_true,
+        Vc::Vector<T, Abi> const& v_false)
+    {
+        return Vc::iif(msk, v_true, v_false);
+    }
+}}}    // namespace hpx::parallel::traits
+
+#endif
@@ -0,0 +1,173 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/adaptive_chunk_size.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace hpx::execution::experimental::detail {
+
+    namespace {
+
+        // Weight of a new sample in the moving averages is
+        // 1 / 2^average_weight_shift
+        constexpr int average_weight_shift = 2;
+
+        ///////////////////////////////////////////////////////////////////////
+        // All call sites are registered here. The sites are looked up by
+        // their name only, annotations may live in temporary storage whose
+        // address is reused for a different name later on.
+        struct adaptive_chunk_size_registry
+        {
+            using statistic_type =
+                std::atomic<std::int64_t> adaptive_chunk_size_site::*;
+
+            static adaptive_chunk_size_registry& get()
+            {
+                static adaptive_chunk_size_registry registry;
+                return registry;
+            }
+
+            adaptive_chunk_size_site& get_site(char const* name)
+            {
+                std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+
+                auto site_it = sites_.find(name);
+                if (site_it == sites_.end())
+                {
+                    site_it = sites_
+                                  .emplace(name,
+                                      std::make_unique<
+                                          adaptive_chunk_size_site>())
+                                  .first;
+                }
+                return *site_it->second;
+            }
+
+            std::int64_t get_num_sites()
+            {
+                std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+                return static_cast<std::int64_t>(sites_.size());
+            }
+
+            // Return the value of the given site, or the average over all
+            // sites if no site is given (the sum if accumulate is true).
+            std::int64_t get_value(std::string const& name,
+                statistic_type value, bool accumulate, bool reset)
+            {
+                std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+
+                if (!name.empty())
+                {
+                    auto it = sites_.find(name);
+                    if (it == sites_.end())
+                    {
+                        return 0;
+                    }
+                    return get_value(*it->second, value, reset);
+                }
+
+                std::int64_t result = 0;
+                for (auto const& site : sites_)
+                {
+                    result += get_value(*site.second, value, reset);
+                }
+
+                if (!accumulate && !sites_.empty())
+                {
+                    result /= static_cast<std::int64_t>(sites_.size());
+                }
+                return result;
+            }
+
+        private:
+            static std::int64_t get_value(adaptive_chunk_size_site& site,
+                statistic_type value, bool reset) noexcept
+            {
+                if (reset)
+                {
+                    return (site.*value).exchange(0, std::memory_order_relaxed);
+                }
+                return (site.*value).load(std::memory_order_relaxed);
+            }
+
+            hpx::util::detail::spinlock mtx_;
+            std::map<std::string, std::unique_ptr<adaptive_chunk_size_site>,
+                std::less<>>
+                sites_;
+        };
+    }    // namespace
+
+    adaptive_chunk_size_site& get_adaptive_chunk_size_site(char const* site)
+    {
+        return adaptive_chunk_size_registry::get().get_site(site);
+    }
+
+    void update_adaptive_chunk_size_average(
+        std::atomic<std::int64_t>& average, std::int64_t sample) noexcept
+    {
+        // concurrent updates may lose a sample, which is acceptable for an
+        // estimate
+        std::int64_t const current = average.load(std::memory_order_relaxed);
+        if (current == 0)
+        {
+            average.store(sample, std::memory_order_relaxed);
+        }
+        else
+        {
+            average.store(
+                current + ((sample - current) >> average_weight_shift),
+                std::memory_order_relaxed);
+        }
+    }
+}    // namespace hpx::execution::experimental::detail
+
+namespace hpx::parallel::execution::detail {
+
+    using hpx::execution::experimental::detail::adaptive_chunk_size_registry;
+    using hpx::execution::experimental::detail::adaptive_chunk_size_site;
+
+    std::int64_t get_adaptive_chunk_size_sites(bool)
+    {
+        return adaptive_chunk_size_registry::get().get_num_sites();
+    }
+
+    std::int64_t get_adaptive_chunk_size_iteration_time(
+        std::string const& site, bool)
+    {
+        return adaptive_chunk_size_registry::get().get_value(
+            site, &adaptive_chunk_size_site::iteration_time, false, false);
+    }
+
+    std::int64_t get_adaptive_chunk_size_task_overhead(
+        std::string const& site, bool)
+    {
+        return adaptive_chunk_size_registry::get().get_value(
+            site, &adaptive_chunk_size_site::task_overhead, false, false);
+    }
+
+    std::int64_t get_adaptive_chunk_size_chunk_size(
+        std::string const& site, bool)
+    {
+        return adaptive_chunk_size_registry::get().get_value(
+            site, &adaptive_chunk_size_site::chunk_size, false, false);
+    }
+
+    std::int64_t get_adaptive_chunk_size_measurements(
+        std::string const& site, bool reset)
+    {
+        return adaptive_chunk_size_registry::get().get_value(
+            site, &adaptive_chunk_size_site::measurements, true, reset);
+    }
+}    // namespace hpx::parallel::execution::detail
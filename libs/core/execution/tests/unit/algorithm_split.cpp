@@ -5,13 +5,16 @@
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
+#include <hpx/functional/move_only_function.hpp>
 #include <hpx/modules/execution.hpp>
 #include <hpx/modules/testing.hpp>
+#include <hpx/type_support/detail/with_result_of.hpp>
 
 #include "algorithm_test_utils.hpp"
 
 #include <atomic>
 #include <exception>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -29,6 +32,37 @@ auto tag_invoke(
     return void_sender{};
 }
 
+// Sender which completes only once trigger has been called, used to attach
+// receivers to a split sender before its predecessor has completed.
+struct triggered_sender
+{
+    hpx::move_only_function<void()>* trigger;
+
+    template <typename R>
+    struct operation_state
+    {
+        std::decay_t<R> r;
+        hpx::move_only_function<void()>* trigger;
+
+        friend void tag_invoke(ex::start_t, operation_state& os) noexcept
+        {
+            *os.trigger = [&os]() { ex::set_value(std::move(os.r), 42); };
+        }
+    };
+
+    template <typename R>
+    friend operation_state<R> tag_invoke(
+        ex::connect_t, triggered_sender s, R&& r)
+    {
+        return {std::forward<R>(r), s.trigger};
+    }
+
+    template <typename Env>
+    friend auto tag_invoke(
+        ex::get_completion_signatures_t, triggered_sender const&, Env)
+        -> ex::completion_signatures<ex::set_value_t(int)>;
+};
+
 int main()
 {
     // Success path
@@ -286,5 +320,46 @@ int main()
         HPX_TEST(receiver_set_value_called);
     }
 
+    // Receivers attached before the predecessor completes are kept until it
+    // completes
+    {
+        hpx::move_only_function<void()> trigger;
+        auto s = triggered_sender{&trigger} | ex::split();
+
+        auto f = [](int x) { HPX_TEST_EQ(x, 42); };
+
+        using receiver_type = callback_receiver<decltype(f)>;
+        using operation_state_type =
+            ex::connect_result_t<decltype(s)&, receiver_type>;
+
+        constexpr int num_receivers = 3;
+        std::atomic<bool> set_value_called[num_receivers] = {};
+        std::optional<operation_state_type> os[num_receivers];
+        for (int i = 0; i != num_receivers; ++i)
+        {
+            os[i].emplace(hpx::util::detail::with_result_of([&]() {
+                return ex::connect(s, receiver_type{f, set_value_called[i]});
+            }));
+            ex::start(*os[i]);
+            HPX_TEST(!set_value_called[i]);
+        }
+
+        HPX_TEST(trigger);
+        trigger();
+
+        for (int i = 0; i != num_receivers; ++i)
+        {
+            HPX_TEST(set_value_called[i]);
+        }
+
+        // receivers attached after the predecessor completed are completed
+        // right away
+        std::atomic<bool> late_set_value_called{false};
+        auto late_os =
+            ex::connect(s, receiver_type{f, late_set_value_called});
+        ex::start(late_os);
+        HPX_TEST(late_set_value_called);
+    }
+
     return hpx::util::report_errors();
 }
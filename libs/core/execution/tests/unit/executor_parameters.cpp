@@ -11,6 +11,9 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <iterator>
@@ -135,6 +138,85 @@ void test_persistent_auto_chunk_size()
     }
 }
 
+void test_adaptive_chunk_size()
+{
+    {
+        hpx::execution::experimental::adaptive_chunk_size acs;
+        parameters_test(acs);
+    }
+
+    {
+        hpx::execution::experimental::adaptive_chunk_size acs(
+            std::chrono::microseconds(50));
+        parameters_test(acs);
+    }
+
+    // the values are learned for the annotation of the executor
+    {
+        auto policy = hpx::execution::experimental::with_annotation(
+            hpx::execution::par.with(
+                hpx::execution::experimental::adaptive_chunk_size(
+                    std::chrono::microseconds(50))),
+            "test_adaptive_chunk_size");
+
+        std::vector<std::size_t> c(10007);
+        for (int i = 0; i != 20; ++i)
+        {
+            std::iota(c.begin(), c.end(), std::size_t(i));
+            hpx::for_each(policy, c.begin(), c.end(), [](std::size_t& v) {
+                v = static_cast<std::size_t>(std::sqrt(double(v)));
+            });
+            HPX_TEST_EQ(c[10006],
+                static_cast<std::size_t>(std::sqrt(double(10006 + i))));
+        }
+
+        using namespace hpx::parallel::execution::detail;
+
+        std::string const site("test_adaptive_chunk_size");
+        HPX_TEST_LTE(std::int64_t(8),
+            get_adaptive_chunk_size_measurements(site, false));
+        HPX_TEST_LT(std::int64_t(0),
+            get_adaptive_chunk_size_iteration_time(site, false));
+        HPX_TEST_LT(
+            std::int64_t(0), get_adaptive_chunk_size_chunk_size(site, false));
+        HPX_TEST_LTE(std::int64_t(1), get_adaptive_chunk_size_sites(false));
+
+        // unknown call sites have no values
+        HPX_TEST_EQ(std::int64_t(0),
+            get_adaptive_chunk_size_measurements("unknown", false));
+    }
+}
+
+void test_numa_affine_chunks()
+{
+    {
+        hpx::execution::experimental::numa_affine_chunks nac;
+        parameters_test(nac);
+    }
+
+    {
+        hpx::execution::experimental::numa_affine_chunks nac(4);
+        parameters_test(nac);
+    }
+
+    // the chunk boundaries depend on the number of cores and iterations only
+    {
+        hpx::execution::experimental::numa_affine_chunks nac(2);
+        hpx::execution::parallel_executor par_exec;
+
+        auto f = [](std::size_t) { return 0; };
+        HPX_TEST_EQ(nac.get_chunk_size(par_exec, f, 4, 1000), std::size_t(125));
+        HPX_TEST_EQ(nac.get_chunk_size(par_exec, f, 4, 1001), std::size_t(126));
+        HPX_TEST_EQ(nac.get_chunk_size(par_exec, f, 4, 3), std::size_t(1));
+
+        // fewer than chunks_per_core chunks per core for small loops
+        HPX_TEST_EQ(nac.get_chunk_size(par_exec, f, 4, 9), std::size_t(2));
+        HPX_TEST_EQ(nac.get_chunk_size(par_exec, f, 4, 0), std::size_t(1));
+        HPX_TEST_EQ(
+            nac.maximal_number_of_chunks(par_exec, 4, 1000), std::size_t(8));
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 struct timer_hooks_parameters
 {
@@ -192,6 +274,8 @@ int hpx_main(hpx::program_options::variables_map& vm)
     test_guided_chunk_size();
     test_auto_chunk_size();
     test_persistent_auto_chunk_size();
+    test_adaptive_chunk_size();
+    test_numa_affine_chunks();
 
     test_combined_hooks();
 
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/errors/error.hpp>
 #include <hpx/errors/throw_exception.hpp>
@@ -17,6 +19,7 @@
 #include <cstring>
 #include <exception>
 #include <memory>
+#include <new>
 #include <type_traits>
 #include <utility>
 
@@ -58,6 +61,42 @@ namespace hpx::detail {
     }
 #endif
 
+    // Objects which do not fit into the embedded storage of the type erased
+    // wrappers below are allocated from the thread local caches. The bases
+    // of the stored objects have virtual destructors, thus the sized operator
+    // delete receives the size of the most derived type.
+    struct sbo_heap_allocated
+    {
+        static void* operator new(std::size_t size)
+        {
+            return hpx::util::detail::thread_local_cache_allocate(size);
+        }
+
+        static void operator delete(void* p, std::size_t size) noexcept
+        {
+            hpx::util::detail::thread_local_cache_deallocate(p, size);
+        }
+
+        static void* operator new(std::size_t size, std::align_val_t alignment)
+        {
+            return ::operator new(size, alignment);
+        }
+
+        static void operator delete(
+            void* p, std::size_t size, std::align_val_t alignment) noexcept
+        {
+            ::operator delete(p, size, alignment);
+        }
+
+        // objects stored in the embedded storage are constructed in place
+        static void* operator new(std::size_t, void* p) noexcept
+        {
+            return p;
+        }
+
+        static void operator delete(void*, void*) noexcept {}
+    };
+
     template <typename Base, std::size_t EmbeddedStorageSize,
         std::size_t AlignmentSize = sizeof(void*)>
     class movable_sbo_storage
@@ -287,7 +326,7 @@ namespace hpx::detail {
 }    // namespace hpx::detail
 
 namespace hpx::execution::experimental::detail {
-    struct any_operation_state_base
+    struct any_operation_state_base : hpx::detail::sbo_heap_allocated
     {
         virtual ~any_operation_state_base() = default;
         virtual bool empty() const noexcept
@@ -366,7 +405,7 @@ namespace hpx::execution::experimental::detail {
     };
 
     template <typename... Ts>
-    struct any_receiver_base
+    struct any_receiver_base : hpx::detail::sbo_heap_allocated
     {
         virtual ~any_receiver_base() = default;
         virtual void move_into(void* p) = 0;
@@ -531,7 +570,7 @@ namespace hpx::execution::experimental::detail {
     };
 
     template <typename... Ts>
-    struct unique_any_sender_base
+    struct unique_any_sender_base : hpx::detail::sbo_heap_allocated
     {
         virtual ~unique_any_sender_base() = default;
         virtual void move_into(void* p) = 0;
@@ -700,8 +739,12 @@ namespace hpx::execution::experimental {
     }    // namespace detail
 #endif
 
-    template <typename... Ts>
-    class unique_any_sender
+    // The type erased senders store senders of up to EmbeddedStorageSize
+    // bytes in place, larger senders are allocated on the heap.
+    // unique_any_sender and any_sender use a default storage size of four
+    // pointers.
+    template <std::size_t EmbeddedStorageSize, typename... Ts>
+    class basic_unique_any_sender
 #if !defined(HPX_HAVE_CXX20_TRIVIAL_VIRTUAL_DESTRUCTOR)
       : private detail::any_sender_static_empty_vtable_helper<Ts...>
 #endif
@@ -710,48 +753,50 @@ namespace hpx::execution::experimental {
         template <typename Sender>
         using impl_type = detail::unique_any_sender_impl<Sender, Ts...>;
         using storage_type =
-            hpx::detail::movable_sbo_storage<base_type, 4 * sizeof(void*)>;
+            hpx::detail::movable_sbo_storage<base_type, EmbeddedStorageSize>;
 
         storage_type storage{};
 
     public:
-        unique_any_sender() = default;
+        basic_unique_any_sender() = default;
 
         template <typename Sender,
-            typename = std::enable_if_t<
-                !std::is_same_v<std::decay_t<Sender>, unique_any_sender>>>
-        unique_any_sender(Sender&& sender)
+            typename = std::enable_if_t<!std::is_same_v<std::decay_t<Sender>,
+                basic_unique_any_sender>>>
+        basic_unique_any_sender(Sender&& sender)
         {
             storage.template store<impl_type<Sender>>(
                 HPX_FORWARD(Sender, sender));
         }
 
         template <typename Sender,
-            typename = std::enable_if_t<
-                !std::is_same_v<std::decay_t<Sender>, unique_any_sender>>>
-        unique_any_sender& operator=(Sender&& sender)
+            typename = std::enable_if_t<!std::is_same_v<std::decay_t<Sender>,
+                basic_unique_any_sender>>>
+        basic_unique_any_sender& operator=(Sender&& sender)
         {
             storage.template store<impl_type<Sender>>(
                 HPX_FORWARD(Sender, sender));
             return *this;
         }
 
-        ~unique_any_sender() = default;
-        unique_any_sender(unique_any_sender&&) = default;
-        unique_any_sender(unique_any_sender const&) = delete;
-        unique_any_sender& operator=(unique_any_sender&&) = default;
-        unique_any_sender& operator=(unique_any_sender const&) = delete;
+        ~basic_unique_any_sender() = default;
+        basic_unique_any_sender(basic_unique_any_sender&&) = default;
+        basic_unique_any_sender(basic_unique_any_sender const&) = delete;
+        basic_unique_any_sender& operator=(
+            basic_unique_any_sender&&) = default;
+        basic_unique_any_sender& operator=(
+            basic_unique_any_sender const&) = delete;
 
         template <typename Env>
-        friend auto tag_invoke(
-            get_completion_signatures_t, unique_any_sender const&, Env) noexcept
+        friend auto tag_invoke(get_completion_signatures_t,
+            basic_unique_any_sender const&, Env) noexcept
             -> completion_signatures<set_value_t(Ts...),
                 set_error_t(std::exception_ptr)>;
 
         template <typename R>
         friend detail::any_operation_state tag_invoke(
-            hpx::execution::experimental::connect_t, unique_any_sender&& s,
-            R&& r)
+            hpx::execution::experimental::connect_t,
+            basic_unique_any_sender&& s, R&& r)
         {
             // We first move the storage to a temporary variable so that this
             // any_sender is empty after this connect. Doing
@@ -763,8 +808,8 @@ namespace hpx::execution::experimental {
         }
     };
 
-    template <typename... Ts>
-    class any_sender
+    template <std::size_t EmbeddedStorageSize, typename... Ts>
+    class basic_any_sender
 #if !defined(HPX_HAVE_CXX20_TRIVIAL_VIRTUAL_DESTRUCTOR)
       : private detail::any_sender_static_empty_vtable_helper<Ts...>
 #endif
@@ -773,17 +818,17 @@ namespace hpx::execution::experimental {
         template <typename Sender>
         using impl_type = detail::any_sender_impl<Sender, Ts...>;
         using storage_type =
-            hpx::detail::copyable_sbo_storage<base_type, 4 * sizeof(void*)>;
+            hpx::detail::copyable_sbo_storage<base_type, EmbeddedStorageSize>;
 
         storage_type storage{};
 
     public:
-        any_sender() = default;
+        basic_any_sender() = default;
 
         template <typename Sender,
             typename = std::enable_if_t<
-                !std::is_same_v<std::decay_t<Sender>, any_sender>>>
-        any_sender(Sender&& sender)
+                !std::is_same_v<std::decay_t<Sender>, basic_any_sender>>>
+        basic_any_sender(Sender&& sender)
         {
             static_assert(std::is_copy_constructible_v<std::decay_t<Sender>>,
                 "any_sender requires the given sender to be copy "
@@ -796,8 +841,8 @@ namespace hpx::execution::experimental {
 
         template <typename Sender,
             typename = std::enable_if_t<
-                !std::is_same_v<std::decay_t<Sender>, any_sender>>>
-        any_sender& operator=(Sender&& sender)
+                !std::is_same_v<std::decay_t<Sender>, basic_any_sender>>>
+        basic_any_sender& operator=(Sender&& sender)
         {
             static_assert(std::is_copy_constructible_v<std::decay_t<Sender>>,
                 "any_sender requires the given sender to be copy "
@@ -809,20 +854,22 @@ namespace hpx::execution::experimental {
             return *this;
         }
 
-        ~any_sender() = default;
-        any_sender(any_sender&&) = default;
-        any_sender(any_sender const&) = default;
-        any_sender& operator=(any_sender&&) = default;
-        any_sender& operator=(any_sender const&) = default;
+        ~basic_any_sender() = default;
+        basic_any_sender(basic_any_sender&&) = default;
+        basic_any_sender(basic_any_sender const&) = default;
+        basic_any_sender& operator=(basic_any_sender&&) = default;
+        basic_any_sender& operator=(basic_any_sender const&) = default;
 
         template <typename Env>
-        friend auto tag_invoke(get_completion_signatures_t, any_sender const&,
-            Env) noexcept -> completion_signatures<set_value_t(Ts...),
-            set_error_t(std::exception_ptr)>;
+        friend auto tag_invoke(get_completion_signatures_t,
+            basic_any_sender const&, Env) noexcept
+            -> completion_signatures<set_value_t(Ts...),
+                set_error_t(std::exception_ptr)>;
 
         template <typename R>
         friend detail::any_operation_state tag_invoke(
-            hpx::execution::experimental::connect_t, any_sender& s, R&& r)
+            hpx::execution::experimental::connect_t, basic_any_sender& s,
+            R&& r)
         {
             return s.storage.get().connect(
                 detail::any_receiver<Ts...>{HPX_FORWARD(R, r)});
@@ -830,7 +877,8 @@ namespace hpx::execution::experimental {
 
         template <typename R>
         friend detail::any_operation_state tag_invoke(
-            hpx::execution::experimental::connect_t, any_sender&& s, R&& r)
+            hpx::execution::experimental::connect_t, basic_any_sender&& s,
+            R&& r)
         {
             // We first move the storage to a temporary variable so that this
             // any_sender is empty after this connect. Doing
@@ -841,6 +889,13 @@ namespace hpx::execution::experimental {
                 .connect(detail::any_receiver<Ts...>{HPX_FORWARD(R, r)});
         }
     };
+
+    template <typename... Ts>
+    using unique_any_sender =
+        basic_unique_any_sender<4 * sizeof(void*), Ts...>;
+
+    template <typename... Ts>
+    using any_sender = basic_any_sender<4 * sizeof(void*), Ts...>;
 }    // namespace hpx::execution::experimental
 
 namespace hpx::detail {
@@ -15,6 +15,7 @@
 #include "algorithm_test_utils.hpp"
 
 #include <atomic>
+#include <cstddef>
 #include <exception>
 #include <string>
 #include <utility>
@@ -522,6 +523,51 @@ void test_unique_any_sender_set_error()
 // any_operation_state. If the empty vtables are function-local statics they
 // would get constructed after s_global is constructed, and thus destroyed
 // before s_global is destroyed. This will typically lead to a segfault. If the
+// Senders which are too large for the default embedded storage are stored in
+// place if the storage size is increased accordingly.
+void test_embedded_storage()
+{
+    constexpr std::size_t storage_size = sizeof(large_sender<int>);
+
+    auto f = [](int x) { HPX_TEST_EQ(x, 42); };
+    using F = decltype(f);
+
+    {
+        ex::basic_any_sender<storage_size, int> as1{large_sender<int>{42}};
+        auto as2 = as1;
+
+        static_assert(ex::is_sender_v<decltype(as1)>);
+        check_value_types<hpx::variant<hpx::tuple<int>>>(as1);
+
+        std::atomic<bool> set_value_called{false};
+        auto os1 = ex::connect(as1, callback_receiver<F>{f, set_value_called});
+        ex::start(os1);
+        HPX_TEST(set_value_called);
+
+        set_value_called = false;
+        auto os2 = ex::connect(
+            std::move(as2), callback_receiver<F>{f, set_value_called});
+        ex::start(os2);
+        HPX_TEST(set_value_called);
+    }
+
+    {
+        ex::basic_unique_any_sender<sizeof(large_non_copyable_sender<int>),
+            int>
+            as1{large_non_copyable_sender<int>{42}};
+        auto as2 = std::move(as1);
+
+        static_assert(ex::is_sender_v<decltype(as2)>);
+        check_value_types<hpx::variant<hpx::tuple<int>>>(as2);
+
+        std::atomic<bool> set_value_called{false};
+        auto os = ex::connect(
+            std::move(as2), callback_receiver<F>{f, set_value_called});
+        ex::start(os);
+        HPX_TEST(set_value_called);
+    }
+}
+
 // empty vtables are (constant) global variables they should be constructed
 // before s_global is constructed and destroyed after s_global is destroyed.
 ex::unique_any_sender<> global_unique_any_sender{ex::just()};
@@ -616,6 +662,7 @@ int main()
     test_unique_any_sender_set_error();
 
     // Test use of *any_* in globals
+    test_embedded_storage();
     test_globals();
 
     return hpx::util::report_errors();
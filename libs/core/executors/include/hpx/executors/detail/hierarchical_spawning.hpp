@@ -19,12 +19,15 @@
 #include <hpx/execution/detail/post_policy_dispatch.hpp>
 #include <hpx/execution/executors/execution.hpp>
 #include <hpx/execution/executors/fused_bulk_execute.hpp>
+#include <hpx/functional/deferred_call.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/future_traits.hpp>
 #include <hpx/iterator_support/range.hpp>
 #include <hpx/pack_traversal/unwrap.hpp>
 #include <hpx/synchronization/latch.hpp>
+#include <hpx/threading_base/detail/stackless_fast_path.hpp>
+#include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
@@ -40,6 +43,68 @@
 
 namespace hpx { namespace parallel { namespace execution { namespace detail {
 
+    ////////////////////////////////////////////////////////////////////////////
+    // Launch one task for each of the given number of elements starting at the
+    // given iterator. Asynchronous tasks are handed to the scheduler as one
+    // batch, all other policies launch the tasks one by one. The tasks run
+    // stackless if Callable (the user supplied function wrapped by F, if
+    // given) is known not to suspend.
+    template <typename Callable = void, typename Launch, typename F,
+        typename Iter, typename... Ts>
+    void post_policy_dispatch_bulk(Launch const& policy,
+        hpx::util::thread_description const& desc,
+        threads::thread_pool_base* pool, F& f, Iter it,
+        std::size_t count, Ts const&... ts)
+    {
+        using callable_type =
+            std::conditional_t<std::is_void_v<Callable>, F, Callable>;
+
+        bool create_batch = std::is_same_v<Launch, hpx::launch::async_policy>;
+        if constexpr (std::is_same_v<Launch, hpx::launch>)
+        {
+            // the generic policy falls back to async for everything else
+            create_batch = !(policy == hpx::launch::sync ||
+                policy == hpx::launch::deferred ||
+                policy == hpx::launch::fork);
+        }
+
+        if (!create_batch || count < 2)
+        {
+            Launch task_policy = policy;
+            if constexpr (!std::is_void_v<Callable>)
+            {
+                if (create_batch)
+                {
+                    task_policy.set_stacksize(
+                        threads::detail::get_stacksize_for<callable_type>(
+                            policy.stacksize()));
+                }
+            }
+
+            for (std::size_t i = 0; i != count; (void) ++it, ++i)
+            {
+                hpx::detail::post_policy_dispatch<Launch>::call(
+                    task_policy, desc, pool, f, *it, ts...);
+            }
+            return;
+        }
+
+        std::vector<threads::thread_init_data> data;
+        data.reserve(count);
+        for (std::size_t i = 0; i != count; (void) ++it, ++i)
+        {
+            data.emplace_back(
+                threads::make_thread_function_nullary(
+                    hpx::util::deferred_call(f, *it, ts...)),
+                desc, policy.priority(), policy.hint(),
+                threads::detail::get_stacksize_for<callable_type>(
+                    policy.stacksize()),
+                threads::thread_schedule_state::pending);
+        }
+
+        threads::register_work_batch(data.data(), data.size(), pool);
+    }
+
     ////////////////////////////////////////////////////////////////////////////
     template <typename Launch, typename F, typename S, typename... Ts>
     std::vector<hpx::future<detail::bulk_function_result_t<F, S, Ts...>>>
@@ -174,18 +239,16 @@ namespace hpx { namespace parallel { namespace execution { namespace detail {
                     auto&& launcher = [&, wrapped, begin, end, it](
                                           bool direct) mutable {
                         // launch N-1 tasks
-                        auto iter = it;
-                        for (std::size_t i = begin + direct; i != end;
-                             (void) ++iter, ++i)
-                        {
-                            hpx::detail::post_policy_dispatch<Launch>::call(
-                                inner_post_policy, desc, pool, wrapped, *iter,
-                                ts...);
-                        }
+                        std::size_t const count = end - begin - direct;
+                        post_policy_dispatch_bulk<std::decay_t<F>>(
+                            inner_post_policy, desc, pool, wrapped, it, count,
+                            ts...);
 
                         // execute last task directly, if needed
                         if (direct)
                         {
+                            auto iter = it;
+                            std::advance(iter, count);
                             HPX_INVOKE(wrapped, *iter, ts...);
                         }
                     };
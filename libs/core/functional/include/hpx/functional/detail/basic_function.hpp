@@ -17,20 +17,42 @@
 #include <hpx/functional/traits/get_function_address.hpp>
 #include <hpx/functional/traits/get_function_annotation.hpp>
 #include <hpx/functional/traits/is_invocable.hpp>
+#include <hpx/modules/itt_notify.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <new>
 #include <string>
 #include <type_traits>
 #include <utility>
 
+namespace hpx { namespace util {
+
+    /// Return the number of function objects which did not fit into the
+    /// embedded storage of a hpx::function or hpx::move_only_function and
+    /// were allocated on the heap instead. Always returns zero unless HPX was
+    /// configured with HPX_WITH_FUNCTION_HEAP_SPILL_COUNTING=ON.
+    HPX_CORE_EXPORT std::int64_t get_function_heap_spill_count(
+        bool reset = false) noexcept;
+}}    // namespace hpx::util
+
 namespace hpx { namespace util { namespace detail {
     static const std::size_t function_storage_size = 3 * sizeof(void*);
 
+    // Function objects of type T are stored in the embedded storage of a
+    // function wrapper with the given storage size, larger objects are
+    // allocated on the heap.
+    template <typename T, std::size_t StorageSize = function_storage_size>
+    inline constexpr bool is_stored_inline_v = sizeof(T) <= StorageSize;
+
     ///////////////////////////////////////////////////////////////////////////
-    class HPX_CORE_EXPORT function_base
+    template <std::size_t StorageSize>
+    class function_base
     {
+        static_assert(StorageSize >= function_storage_size,
+            "the embedded storage shall not be smaller than the default");
+
         using vtable = function_base_vtable;
 
     public:
@@ -74,10 +96,150 @@ namespace hpx { namespace util { namespace detail {
         union
         {
             char storage_init;
-            mutable unsigned char storage[function_storage_size];
+            mutable unsigned char storage[StorageSize];
         };
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <std::size_t StorageSize>
+    function_base<StorageSize>::function_base(
+        function_base const& other, vtable const* /* empty_vtable */)
+      : vptr(other.vptr)
+      , object(other.object)
+    {
+        if (other.object != nullptr)
+        {
+            object =
+                vptr->copy(storage, StorageSize, other.object, /*destroy*/ false);
+        }
+    }
+
+    template <std::size_t StorageSize>
+    function_base<StorageSize>::function_base(
+        function_base&& other, vtable const* empty_vptr) noexcept
+      : vptr(other.vptr)
+      , object(other.object)
+    {
+        if (object == &other.storage)
+        {
+            std::memcpy(storage, other.storage, StorageSize);
+            object = &storage;
+        }
+        other.vptr = empty_vptr;
+        other.object = nullptr;
+    }
+
+    template <std::size_t StorageSize>
+    function_base<StorageSize>::~function_base()
+    {
+        destroy();
+    }
+
+    template <std::size_t StorageSize>
+    void function_base<StorageSize>::op_assign(
+        function_base const& other, vtable const* /* empty_vtable */)
+    {
+        if (vptr == other.vptr)
+        {
+            if (this != &other && object)
+            {
+                HPX_ASSERT(other.object != nullptr);
+                // reuse object storage
+                object = vptr->copy(
+                    object, std::size_t(-1), other.object, /*destroy*/ true);
+            }
+        }
+        else
+        {
+            destroy();
+            vptr = other.vptr;
+            if (other.object != nullptr)
+            {
+                object = vptr->copy(
+                    storage, StorageSize, other.object, /*destroy*/ false);
+            }
+            else
+            {
+                object = nullptr;
+            }
+        }
+    }
+
+    template <std::size_t StorageSize>
+    void function_base<StorageSize>::op_assign(
+        function_base&& other, vtable const* empty_vtable) noexcept
+    {
+        if (this != &other)
+        {
+            swap(other);
+            other.reset(empty_vtable);
+        }
+    }
+
+    template <std::size_t StorageSize>
+    void function_base<StorageSize>::destroy() noexcept
+    {
+        if (object != nullptr)
+        {
+            vptr->deallocate(object, StorageSize, /*destroy*/ true);
+        }
+    }
+
+    template <std::size_t StorageSize>
+    void function_base<StorageSize>::reset(vtable const* empty_vptr) noexcept
+    {
+        destroy();
+        vptr = empty_vptr;
+        object = nullptr;
+    }
+
+    template <std::size_t StorageSize>
+    void function_base<StorageSize>::swap(function_base& f) noexcept
+    {
+        std::swap(vptr, f.vptr);
+        std::swap(object, f.object);
+        std::swap(storage, f.storage);
+        if (object == &f.storage)
+            object = &storage;
+        if (f.object == &storage)
+            f.object = &f.storage;
+    }
+
+    template <std::size_t StorageSize>
+    std::size_t function_base<StorageSize>::get_function_address() const
+    {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+        return vptr->get_function_address(object);
+#else
+        return 0;
+#endif
+    }
+
+    template <std::size_t StorageSize>
+    char const* function_base<StorageSize>::get_function_annotation() const
+    {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+        return vptr->get_function_annotation(object);
+#else
+        return nullptr;
+#endif
+    }
+
+    template <std::size_t StorageSize>
+    util::itt::string_handle
+    function_base<StorageSize>::get_function_annotation_itt() const
+    {
+#if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
+        return vptr->get_function_annotation_itt(object);
+#else
+        return util::itt::string_handle{};
+#endif
+    }
+
+    // the function_base used by all function objects with the default
+    // storage size is instantiated in the core library
+    extern template class HPX_CORE_EXPORT function_base<function_storage_size>;
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename F>
     constexpr bool is_empty_function(F* fp) noexcept
@@ -91,7 +253,8 @@ namespace hpx { namespace util { namespace detail {
         return mp == nullptr;
     }
 
-    inline bool is_empty_function_impl(function_base const* f) noexcept
+    template <std::size_t StorageSize>
+    bool is_empty_function_impl(function_base<StorageSize> const* f) noexcept
     {
         return f->empty();
     }
@@ -108,14 +271,16 @@ namespace hpx { namespace util { namespace detail {
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    template <typename Sig, bool Copyable, bool Serializable>
+    template <typename Sig, bool Copyable, bool Serializable,
+        std::size_t StorageSize = function_storage_size>
     class basic_function;
 
-    template <bool Copyable, typename R, typename... Ts>
-    class basic_function<R(Ts...), Copyable, /*Serializable*/ false>
-      : public function_base
+    template <bool Copyable, typename R, typename... Ts,
+        std::size_t StorageSize>
+    class basic_function<R(Ts...), Copyable, /*Serializable*/ false,
+        StorageSize> : public function_base<StorageSize>
     {
-        using base_type = function_base;
+        using base_type = function_base<StorageSize>;
         using vtable = function_vtable<R(Ts...), Copyable>;
 
     public:
@@ -172,10 +337,10 @@ namespace hpx { namespace util { namespace detail {
                 }
                 else
                 {
-                    destroy();
+                    base_type::destroy();
                     vptr = f_vptr;
-                    buffer = vtable::template allocate<T>(
-                        storage, function_storage_size);
+                    buffer =
+                        vtable::template allocate<T>(storage, StorageSize);
                 }
                 object = ::new (buffer) T(HPX_FORWARD(F, f));
             }
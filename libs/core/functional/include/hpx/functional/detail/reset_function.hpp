@@ -9,6 +9,8 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/functional/move_only_function.hpp>
 
+#include <cstddef>
+
 namespace hpx { namespace util { namespace detail {
 
     template <typename Sig, bool Serializable>
@@ -17,8 +19,9 @@ namespace hpx { namespace util { namespace detail {
         f.reset();
     }
 
-    template <typename Sig, bool Serializable>
-    inline void reset_function(hpx::move_only_function<Sig, Serializable>& f)
+    template <typename Sig, bool Serializable, std::size_t StorageSize>
+    inline void reset_function(
+        hpx::move_only_function<Sig, Serializable, StorageSize>& f)
     {
         f.reset();
     }
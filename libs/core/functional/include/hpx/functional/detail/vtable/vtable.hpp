@@ -9,11 +9,17 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 
 #include <cstddef>
 #include <type_traits>
 
 namespace hpx { namespace util { namespace detail {
+#if defined(HPX_HAVE_FUNCTION_HEAP_SPILL_COUNTING)
+    // Record a function object which did not fit into the embedded storage
+    HPX_CORE_EXPORT void count_function_heap_spill() noexcept;
+#endif
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
     struct construct_vtable
@@ -53,6 +59,12 @@ namespace hpx { namespace util { namespace detail {
             return *reinterpret_cast<T const*>(obj);
         }
 
+        // function objects which do not fit into the embedded storage are
+        // allocated from the thread local caches
+        template <typename T>
+        static constexpr bool use_caching_allocator =
+            alignof(T) <= caching_allocator_alignment;
+
         template <typename T>
         static void* allocate(void* storage, std::size_t storage_size)
         {
@@ -61,7 +73,17 @@ namespace hpx { namespace util { namespace detail {
 
             if (sizeof(T) > storage_size)
             {
-                return new storage_t;
+#if defined(HPX_HAVE_FUNCTION_HEAP_SPILL_COUNTING)
+                count_function_heap_spill();
+#endif
+                if constexpr (use_caching_allocator<T>)
+                {
+                    return thread_local_cache_allocate(sizeof(storage_t));
+                }
+                else
+                {
+                    return new storage_t;
+                }
             }
             return storage;
         }
@@ -80,7 +102,14 @@ namespace hpx { namespace util { namespace detail {
 
             if (sizeof(T) > storage_size)
             {
-                delete static_cast<storage_t*>(obj);
+                if constexpr (use_caching_allocator<T>)
+                {
+                    thread_local_cache_deallocate(obj, sizeof(storage_t));
+                }
+                else
+                {
+                    delete static_cast<storage_t*>(obj);
+                }
             }
         }
         void (*deallocate)(void*, std::size_t storage_size, bool) noexcept;
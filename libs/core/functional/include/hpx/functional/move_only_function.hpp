@@ -22,15 +22,22 @@
 namespace hpx {
 
     ///////////////////////////////////////////////////////////////////////////
-    template <typename Sig, bool Serializable = false>
+    // Function objects of up to StorageSize bytes are stored inside the
+    // move_only_function itself, larger ones are allocated on the heap. Use
+    // util::detail::is_stored_inline_v to verify at compile time that a given
+    // function object avoids the heap allocation.
+    template <typename Sig, bool Serializable = false,
+        std::size_t StorageSize = util::detail::function_storage_size>
     class move_only_function;
 
-    template <typename R, typename... Ts, bool Serializable>
-    class move_only_function<R(Ts...), Serializable>
-      : public util::detail::basic_function<R(Ts...), false, Serializable>
+    template <typename R, typename... Ts, bool Serializable,
+        std::size_t StorageSize>
+    class move_only_function<R(Ts...), Serializable, StorageSize>
+      : public util::detail::basic_function<R(Ts...), false, Serializable,
+            StorageSize>
     {
-        using base_type =
-            util::detail::basic_function<R(Ts...), false, Serializable>;
+        using base_type = util::detail::basic_function<R(Ts...), false,
+            Serializable, StorageSize>;
 
     public:
         using result_type = R;
@@ -99,33 +106,38 @@ namespace hpx::util {
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace traits {
 
-    template <typename Sig, bool Serializable>
-    struct get_function_address<hpx::move_only_function<Sig, Serializable>>
+    template <typename Sig, bool Serializable, std::size_t StorageSize>
+    struct get_function_address<
+        hpx::move_only_function<Sig, Serializable, StorageSize>>
     {
         static constexpr std::size_t call(
-            hpx::move_only_function<Sig, Serializable> const& f) noexcept
+            hpx::move_only_function<Sig, Serializable, StorageSize> const&
+                f) noexcept
         {
             return f.get_function_address();
         }
     };
 
-    template <typename Sig, bool Serializable>
-    struct get_function_annotation<hpx::move_only_function<Sig, Serializable>>
+    template <typename Sig, bool Serializable, std::size_t StorageSize>
+    struct get_function_annotation<
+        hpx::move_only_function<Sig, Serializable, StorageSize>>
     {
         static constexpr char const* call(
-            hpx::move_only_function<Sig, Serializable> const& f) noexcept
+            hpx::move_only_function<Sig, Serializable, StorageSize> const&
+                f) noexcept
         {
             return f.get_function_annotation();
         }
     };
 
 #if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
-    template <typename Sig, bool Serializable>
+    template <typename Sig, bool Serializable, std::size_t StorageSize>
     struct get_function_annotation_itt<
-        hpx::move_only_function<Sig, Serializable>>
+        hpx::move_only_function<Sig, Serializable, StorageSize>>
     {
         static util::itt::string_handle call(
-            hpx::move_only_function<Sig, Serializable> const& f) noexcept
+            hpx::move_only_function<Sig, Serializable, StorageSize> const&
+                f) noexcept
         {
             return f.get_function_annotation_itt();
         }
@@ -7,146 +7,46 @@
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
-#include <hpx/assert.hpp>
+#include <hpx/config.hpp>
 #include <hpx/functional/detail/basic_function.hpp>
-#include <hpx/functional/detail/empty_function.hpp>
-#include <hpx/functional/detail/vtable/function_vtable.hpp>
 #include <hpx/functional/detail/vtable/vtable.hpp>
-#include <hpx/functional/traits/get_function_address.hpp>
-#include <hpx/functional/traits/get_function_annotation.hpp>
-#include <hpx/functional/traits/is_invocable.hpp>
-#include <hpx/modules/itt_notify.hpp>
+#include <hpx/type_support/unused.hpp>
 
+#include <atomic>
 #include <cstddef>
-#include <cstring>
-#include <new>
-#include <string>
-#include <type_traits>
-#include <utility>
+#include <cstdint>
 
-namespace hpx { namespace util { namespace detail {
-    ///////////////////////////////////////////////////////////////////////////
-    function_base::function_base(
-        function_base const& other, vtable const* /* empty_vtable */)
-      : vptr(other.vptr)
-      , object(other.object)
-    {
-        if (other.object != nullptr)
-        {
-            object = vptr->copy(storage, detail::function_storage_size,
-                other.object, /*destroy*/ false);
-        }
-    }
+namespace hpx { namespace util {
 
-    function_base::function_base(
-        function_base&& other, vtable const* empty_vptr) noexcept
-      : vptr(other.vptr)
-      , object(other.object)
-    {
-        if (object == &other.storage)
-        {
-            std::memcpy(storage, other.storage, function_storage_size);
-            object = &storage;
-        }
-        other.vptr = empty_vptr;
-        other.object = nullptr;
-    }
+    namespace detail {
 
-    function_base::~function_base()
-    {
-        destroy();
-    }
+        template class HPX_CORE_EXPORT function_base<function_storage_size>;
 
-    void function_base::op_assign(
-        function_base const& other, vtable const* /* empty_vtable */)
-    {
-        if (vptr == other.vptr)
-        {
-            if (this != &other && object)
-            {
-                HPX_ASSERT(other.object != nullptr);
-                // reuse object storage
-                object = vptr->copy(
-                    object, std::size_t(-1), other.object, /*destroy*/ true);
-            }
-        }
-        else
-        {
-            destroy();
-            vptr = other.vptr;
-            if (other.object != nullptr)
-            {
-                object = vptr->copy(storage, detail::function_storage_size,
-                    other.object, /*destroy*/ false);
-            }
-            else
-            {
-                object = nullptr;
-            }
+#if defined(HPX_HAVE_FUNCTION_HEAP_SPILL_COUNTING)
+        namespace {
+
+            std::atomic<std::int64_t> function_heap_spills(0);
         }
-    }
 
-    void function_base::op_assign(
-        function_base&& other, vtable const* empty_vtable) noexcept
-    {
-        if (this != &other)
+        void count_function_heap_spill() noexcept
         {
-            swap(other);
-            other.reset(empty_vtable);
+            function_heap_spills.fetch_add(1, std::memory_order_relaxed);
         }
-    }
+#endif
+    }    // namespace detail
 
-    void function_base::destroy() noexcept
+    std::int64_t get_function_heap_spill_count(bool reset) noexcept
     {
-        if (object != nullptr)
+#if defined(HPX_HAVE_FUNCTION_HEAP_SPILL_COUNTING)
+        if (reset)
         {
-            vptr->deallocate(object, function_storage_size,
-                /*destroy*/ true);
+            return detail::function_heap_spills.exchange(
+                0, std::memory_order_relaxed);
         }
-    }
-
-    void function_base::reset(vtable const* empty_vptr) noexcept
-    {
-        destroy();
-        vptr = empty_vptr;
-        object = nullptr;
-    }
-
-    void function_base::swap(function_base& f) noexcept
-    {
-        std::swap(vptr, f.vptr);
-        std::swap(object, f.object);
-        std::swap(storage, f.storage);
-        if (object == &f.storage)
-            object = &storage;
-        if (f.object == &storage)
-            f.object = &f.storage;
-    }
-
-    std::size_t function_base::get_function_address() const
-    {
-#if defined(HPX_HAVE_THREAD_DESCRIPTION)
-        return vptr->get_function_address(object);
+        return detail::function_heap_spills.load(std::memory_order_relaxed);
 #else
+        HPX_UNUSED(reset);
         return 0;
 #endif
     }
-
-    char const* function_base::get_function_annotation() const
-    {
-#if defined(HPX_HAVE_THREAD_DESCRIPTION)
-        return vptr->get_function_annotation(object);
-#else
-        return nullptr;
-#endif
-    }
-
-    util::itt::string_handle function_base::get_function_annotation_itt() const
-    {
-#if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
-        return vptr->get_function_annotation_itt(object);
-#else
-        return util::itt::string_handle{};
-#endif
-    }
-}}}    // namespace hpx::util::detail
+}}    // namespace hpx::util
@@ -0,0 +1,144 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/functional/move_only_function.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+constexpr std::size_t storage_size = 5 * sizeof(void*);
+
+using small_function = hpx::move_only_function<std::int64_t()>;
+using large_function =
+    hpx::move_only_function<std::int64_t(), false, storage_size>;
+
+// a function object capturing a couple of shared pointers and an id
+struct task
+{
+    std::shared_ptr<std::int64_t> a;
+    std::shared_ptr<std::int64_t> b;
+    std::int64_t id;
+
+    std::int64_t operator()() const
+    {
+        return *a + *b + id;
+    }
+};
+
+struct big_task
+{
+    task t;
+    char padding[storage_size];
+
+    std::int64_t operator()() const
+    {
+        return t();
+    }
+};
+
+static_assert(!hpx::util::detail::is_stored_inline_v<task>,
+    "task should not fit into the default storage");
+static_assert(hpx::util::detail::is_stored_inline_v<task, storage_size>,
+    "task should fit into the enlarged storage");
+static_assert(!hpx::util::detail::is_stored_inline_v<big_task, storage_size>,
+    "big_task should not fit into the enlarged storage");
+
+template <typename F, typename T>
+bool is_stored_inline(F const& f, T const* target)
+{
+    auto const* begin = reinterpret_cast<char const*>(&f);
+    auto const* p = reinterpret_cast<char const*>(target);
+    return p >= begin && p < begin + sizeof(F);
+}
+
+task make_task(std::int64_t id)
+{
+    return task{std::make_shared<std::int64_t>(1),
+        std::make_shared<std::int64_t>(2), id};
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_storage()
+{
+    small_function small = make_task(3);
+    HPX_TEST(!is_stored_inline(small, small.target<task>()));
+    HPX_TEST_EQ(small(), 6);
+
+    large_function large = make_task(4);
+    HPX_TEST(is_stored_inline(large, large.target<task>()));
+    HPX_TEST_EQ(large(), 7);
+
+    large_function big = big_task{make_task(5), {}};
+    HPX_TEST(!is_stored_inline(big, big.target<big_task>()));
+    HPX_TEST_EQ(big(), 8);
+}
+
+void test_move()
+{
+    task t = make_task(3);
+    std::weak_ptr<std::int64_t> a = t.a;
+
+    large_function f1 = HPX_MOVE(t);
+    HPX_TEST_EQ(a.use_count(), 1);
+
+    large_function f2 = HPX_MOVE(f1);
+    HPX_TEST(f1.empty());
+    HPX_TEST(is_stored_inline(f2, f2.target<task>()));
+    HPX_TEST_EQ(a.use_count(), 1);
+    HPX_TEST_EQ(f2(), 6);
+
+    f1 = HPX_MOVE(f2);
+    HPX_TEST(f2.empty());
+    HPX_TEST(is_stored_inline(f1, f1.target<task>()));
+    HPX_TEST_EQ(f1(), 6);
+
+    f1.reset();
+    HPX_TEST(a.expired());
+}
+
+void test_swap()
+{
+    large_function f1 = make_task(3);
+    large_function f2 = big_task{make_task(4), {}};
+
+    f1.swap(f2);
+    HPX_TEST(is_stored_inline(f2, f2.target<task>()));
+    HPX_TEST(!is_stored_inline(f1, f1.target<big_task>()));
+    HPX_TEST_EQ(f1(), 7);
+    HPX_TEST_EQ(f2(), 6);
+}
+
+void test_heap_spill_count()
+{
+    std::int64_t const count = hpx::util::get_function_heap_spill_count(true);
+    HPX_TEST(count >= 0);
+
+    {
+        large_function f1 = make_task(3);
+        large_function f2 = big_task{make_task(4), {}};
+        small_function f3 = make_task(5);
+    }
+
+#if defined(HPX_HAVE_FUNCTION_HEAP_SPILL_COUNTING)
+    HPX_TEST_EQ(hpx::util::get_function_heap_spill_count(true), 2);
+#else
+    HPX_TEST_EQ(hpx::util::get_function_heap_spill_count(true), 0);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_storage();
+    test_move();
+    test_swap();
+    test_heap_spill_count();
+
+    return hpx::util::report_errors();
+}
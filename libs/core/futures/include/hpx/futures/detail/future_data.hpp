@@ -10,7 +10,6 @@
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/coroutines/detail/get_stack_pointer.hpp>
-#include <hpx/datastructures/detail/small_vector.hpp>
 #include <hpx/errors/try_catch_exception_ptr.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/futures/future_fwd.hpp>
@@ -29,6 +28,7 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <memory>
 #include <mutex>
@@ -90,9 +90,12 @@ namespace hpx { namespace lcos { namespace detail {
         future_data_refcnt_base& operator=(future_data_refcnt_base&&) = delete;
 
     public:
-        using completed_callback_type = hpx::move_only_function<void()>;
-        using completed_callback_vector_type =
-            hpx::detail::small_vector<completed_callback_type, 1>;
+        // Continuations usually capture a shared state and a few more
+        // pointers, which should not require a separate heap allocation. The
+        // storage size is chosen such that a completed_callback_node fits
+        // into a single cache line.
+        using completed_callback_type =
+            hpx::move_only_function<void(), false, 5 * sizeof(void*)>;
 
         using has_future_data_refcnt_base = void;
 
@@ -227,17 +230,18 @@ namespace hpx { namespace lcos { namespace detail {
 
         future_data_base() noexcept
           : state_(empty)
+          , waiters_(nullptr)
         {
         }
 
         explicit future_data_base(init_no_addref no_addref) noexcept
           : future_data_refcnt_base(no_addref)
           , state_(empty)
+          , waiters_(nullptr)
         {
         }
 
         using future_data_refcnt_base::completed_callback_type;
-        using future_data_refcnt_base::completed_callback_vector_type;
         using result_type = util::unused_type;
         using init_no_addref = future_data_refcnt_base::init_no_addref;
 
@@ -251,6 +255,122 @@ namespace hpx { namespace lcos { namespace detail {
             exception = 4 | ready
         };
 
+    protected:
+        // The readiness of the shared state and the continuations registered
+        // with it share a single atomic word (state_). While the shared state
+        // is not ready, the word holds a pointer to a lock-free stack of
+        // callback nodes, its lower bits manage the inline slot used for the
+        // first continuation. Making the shared state ready replaces the whole
+        // word with the final state, which atomically closes the stack.
+        static constexpr std::uintptr_t state_mask = 7;
+        static constexpr std::uintptr_t inline_claimed = 8;
+        static constexpr std::uintptr_t inline_published = 16;
+        static constexpr std::uintptr_t callbacks_mask = ~std::uintptr_t(31);
+
+        struct alignas(32) completed_callback_node
+        {
+            completed_callback_type f_;
+            completed_callback_node* next_ = nullptr;
+        };
+
+        static_assert(sizeof(completed_callback_node) <= 8 * sizeof(void*),
+            "completed_callback_node should fit into a cache line");
+
+        // threads waiting for the shared state to become ready, created on
+        // demand by the first waiting thread
+        struct waiters_type
+        {
+            mutex_type mtx_;
+            local::detail::condition_variable cond_;
+        };
+
+    public:
+        // The continuations that were taken from a shared state when it was
+        // made ready, held in registration order.
+        class completed_callback_list
+        {
+        public:
+            completed_callback_list() = default;
+
+            completed_callback_list(completed_callback_type&& first,
+                completed_callback_node* head) noexcept
+              : first_(HPX_MOVE(first))
+            {
+                // the nodes were pushed onto a stack, restore their order
+                while (head != nullptr)
+                {
+                    completed_callback_node* next = head->next_;
+                    head->next_ = head_;
+                    head_ = head;
+                    head = next;
+                }
+            }
+
+            completed_callback_list(completed_callback_list&& rhs) noexcept
+              : first_(HPX_MOVE(rhs.first_))
+              , head_(std::exchange(rhs.head_, nullptr))
+            {
+                rhs.first_.reset();
+            }
+
+            completed_callback_list& operator=(
+                completed_callback_list&& rhs) noexcept
+            {
+                if (this != &rhs)
+                {
+                    clear();
+                    first_ = HPX_MOVE(rhs.first_);
+                    rhs.first_.reset();
+                    head_ = std::exchange(rhs.head_, nullptr);
+                }
+                return *this;
+            }
+
+            ~completed_callback_list()
+            {
+                clear();
+            }
+
+            bool empty() const noexcept
+            {
+                return !first_ && head_ == nullptr;
+            }
+
+            // hand all held callbacks to the given function, in order
+            template <typename F>
+            void consume(F&& f)
+            {
+                if (first_)
+                {
+                    completed_callback_type cb = HPX_MOVE(first_);
+                    first_.reset();
+                    f(HPX_MOVE(cb));
+                }
+
+                while (head_ != nullptr)
+                {
+                    std::unique_ptr<completed_callback_node> node(head_);
+                    head_ = node->next_;
+                    f(HPX_MOVE(node->f_));
+                }
+            }
+
+        private:
+            void clear() noexcept
+            {
+                first_.reset();
+                while (head_ != nullptr)
+                {
+                    completed_callback_node* next = head_->next_;
+                    delete head_;
+                    head_ = next;
+                }
+            }
+
+            completed_callback_type first_;
+            completed_callback_node* head_ = nullptr;
+        };
+
         /// Return whether or not the data is available for this
         /// \a future.
         bool is_ready(
@@ -261,12 +381,12 @@ namespace hpx { namespace lcos { namespace detail {
 
         bool has_value() const noexcept
         {
-            return state_.load(std::memory_order_acquire) == value;
+            return get_state() == value;
         }
 
         bool has_exception() const noexcept
         {
-            return state_.load(std::memory_order_acquire) == exception;
+            return get_state() == exception;
         }
 
         virtual void execute_deferred(error_code& /*ec*/ = throws) {}
@@ -295,7 +415,7 @@ namespace hpx { namespace lcos { namespace detail {
         static void run_on_completed(
             completed_callback_type&& on_completed) noexcept;
         static void run_on_completed(
-            completed_callback_vector_type&& on_completed) noexcept;
+            completed_callback_list&& on_completed) noexcept;
 
         // make sure continuation invocation does not recurse deeper than
         // allowed
@@ -334,10 +454,29 @@ namespace hpx { namespace lcos { namespace detail {
         }
 
     protected:
+        state get_state(
+            std::memory_order order = std::memory_order_acquire) const noexcept
+        {
+            return static_cast<state>(state_.load(order) & state_mask);
+        }
+
+        // Make the shared state ready by switching from 'empty' to the given
+        // state. Returns false if the shared state was ready already.
+        // Otherwise takes the registered continuations and wakes up all
+        // waiting threads.
+        bool set_ready(state s, completed_callback_list& on_completed);
+
+        // Release the continuations still held by the given (not ready)
+        // value of the state word.
+        void release_on_completed(std::uintptr_t s) noexcept;
+
+        waiters_type* get_waiters();
+
+        // protects state held by derived shared states
         mutable mutex_type mtx_;
-        std::atomic<state> state_;    // current state
-        completed_callback_vector_type on_completed_;
-        local::detail::condition_variable cond_;    // threads waiting in read
+        std::atomic<std::uintptr_t> state_;    // current state
+        std::atomic<waiters_type*> waiters_;
+        completed_callback_type on_completed_inline_;
     };
 
     struct in_place
@@ -367,8 +506,8 @@ namespace hpx { namespace lcos { namespace detail {
         using init_no_addref = typename base_type::init_no_addref;
         using completed_callback_type =
             typename base_type::completed_callback_type;
-        using completed_callback_vector_type =
-            typename base_type::completed_callback_vector_type;
+        using completed_callback_list =
+            typename base_type::completed_callback_list;
 
     protected:
         using mutex_type = typename base_type::mutex_type;
@@ -456,45 +595,20 @@ namespace hpx { namespace lcos { namespace detail {
             result_type* value_ptr = reinterpret_cast<result_type*>(&storage_);
             construct(value_ptr, HPX_FORWARD(Ts, ts)...);
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = HPX_MOVE(on_completed_);
-            on_completed_.clear();
-
-            // The value has been set, changing the state to 'value' at this
-            // point signals to all other threads that this future is ready.
-            state expected = empty;
-            if (!state_.compare_exchange_strong(
-                    expected, value, std::memory_order_release))
+            // Changing the state to 'value' at this point signals to all
+            // other threads that this future is ready. This also takes all
+            // registered continuations and wakes up all waiting threads.
+            completed_callback_list on_completed;
+            if (!this->set_ready(value, on_completed))
             {
                 // this future should be 'empty' still (it can't be made ready
                 // more than once).
-                l.unlock();
                 HPX_THROW_EXCEPTION(promise_already_satisfied,
                     "future_data_base::set_value",
                     "data has already been set for this future");
                 return;
             }
 
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (
-                cond_.notify_one(HPX_MOVE(l), threads::thread_priority::boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-
             // invoke the callback (continuation) function
             if (!on_completed.empty())
             {
@@ -515,45 +629,20 @@ namespace hpx { namespace lcos { namespace detail {
                 reinterpret_cast<std::exception_ptr*>(&storage_);
             ::new ((void*) exception_ptr) std::exception_ptr(HPX_MOVE(data));
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = HPX_MOVE(on_completed_);
-            on_completed_.clear();
-
-            // The value has been set, changing the state to 'exception' at this
-            // point signals to all other threads that this future is ready.
-            state expected = empty;
-            if (!state_.compare_exchange_strong(
-                    expected, exception, std::memory_order_release))
+            // Changing the state to 'exception' at this point signals to all
+            // other threads that this future is ready. This also takes all
+            // registered continuations and wakes up all waiting threads.
+            completed_callback_list on_completed;
+            if (!this->set_ready(exception, on_completed))
             {
                 // this future should be 'empty' still (it can't be made ready
                 // more than once).
-                l.unlock();
                 HPX_THROW_EXCEPTION(promise_already_satisfied,
                     "future_data_base::set_exception",
                     "data has already been set for this future");
                 return;
             }
 
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (
-                cond_.notify_one(HPX_MOVE(l), threads::thread_priority::boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-
             // invoke the callback (continuation) function
             if (!on_completed.empty())
             {
@@ -606,7 +695,8 @@ namespace hpx { namespace lcos { namespace detail {
             // and no reader
 
             // release any stored data and callback functions
-            switch (state_.exchange(empty))
+            std::uintptr_t const s = state_.exchange(empty);
+            switch (s & base_type::state_mask)
             {
             case value:
             {
@@ -626,7 +716,7 @@ namespace hpx { namespace lcos { namespace detail {
                 break;
             }
 
-            on_completed_.clear();
+            this->release_on_completed(s);
         }
 
         std::exception_ptr get_exception_ptr() const override
@@ -637,11 +727,9 @@ namespace hpx { namespace lcos { namespace detail {
 
     protected:
         using base_type::mtx_;
-        using base_type::on_completed_;
         using base_type::state_;
 
     private:
-        using base_type::cond_;
         future_data_storage_t<Result> storage_;
     };
 
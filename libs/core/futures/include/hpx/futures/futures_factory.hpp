@@ -8,7 +8,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/allocator_deleter.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/errors/try_catch_exception_ptr.hpp>
@@ -19,6 +19,7 @@
 #include <hpx/futures/traits/future_access.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/memory.hpp>
+#include <hpx/threading_base/detail/stackless_fast_path.hpp>
 #include <hpx/threading_base/thread_description.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/threading_base/thread_num_tss.hpp>
@@ -119,7 +120,8 @@ namespace hpx { namespace lcos { namespace local {
                     threads::make_thread_function_nullary(util::deferred_call(
                         &base_type::run_impl, HPX_MOVE(this_))),
                     util::thread_description(f_, annotation), policy.priority(),
-                    policy.hint(), policy.stacksize(),
+                    policy.hint(),
+                    threads::detail::get_stacksize_for<F>(policy.stacksize()),
                     threads::thread_schedule_state::pending);
 
                 return threads::register_work(data, pool, ec);
@@ -673,13 +675,14 @@ namespace hpx { namespace lcos { namespace local {
                 !std::is_same_v<std::decay_t<F>, futures_factory>>>
         explicit futures_factory(F&& f)
           : task_(detail::create_task_object<Result, Cancelable>::call(
-                hpx::util::internal_allocator<>{}, HPX_FORWARD(F, f)))
+                hpx::util::thread_local_caching_allocator<>{},
+                HPX_FORWARD(F, f)))
         {
         }
 
         explicit futures_factory(Result (*f)())
           : task_(detail::create_task_object<Result, Cancelable>::call(
-                hpx::util::internal_allocator<>{}, f))
+                hpx::util::thread_local_caching_allocator<>{}, f))
         {
         }
 
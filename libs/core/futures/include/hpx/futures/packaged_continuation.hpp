@@ -9,7 +9,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/allocator_deleter.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/errors/try_catch_exception_ptr.hpp>
 #include <hpx/futures/detail/future_data.hpp>
@@ -20,6 +20,7 @@
 #include <hpx/modules/memory.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
 #include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/traits/is_stackless_callable.hpp>
 
 #include <exception>
 #include <functional>
@@ -120,11 +121,19 @@ namespace hpx { namespace lcos { namespace detail {
             [&](std::exception_ptr ep) { cont.set_exception(HPX_MOVE(ep)); });
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Future, typename F, typename ContResult, bool Unwrap>
+    struct continuation_async_function;
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Future, typename F, typename ContResult>
     class continuation : public detail::future_data<ContResult>
     {
     private:
+        template <typename Future_, typename F_, typename ContResult_,
+            bool Unwrap>
+        friend struct continuation_async_function;
+
         using base_type = future_data<ContResult>;
 
         using mutex_type = typename base_type::mutex_type;
@@ -283,10 +292,8 @@ namespace hpx { namespace lcos { namespace detail {
 
             hpx::intrusive_ptr<continuation> this_(this);
             hpx::util::thread_description desc(f_, "async");
-            spawner(
-                [this_ = HPX_MOVE(this_), f = HPX_MOVE(f)]() mutable -> void {
-                    this_->async_impl(HPX_MOVE(f));
-                },
+            spawner(continuation_async_function<Future, F, ContResult, true>{
+                        HPX_MOVE(this_), HPX_MOVE(f)},
                 desc);
 
             if (&ec != &throws)
@@ -313,10 +320,8 @@ namespace hpx { namespace lcos { namespace detail {
 
             hpx::intrusive_ptr<continuation> this_(this);
             hpx::util::thread_description desc(f_, "async_nounwrap");
-            spawner(
-                [this_ = HPX_MOVE(this_), f = HPX_MOVE(f)]() mutable -> void {
-                    this_->async_impl_nounwrap(HPX_MOVE(f));
-                },
+            spawner(continuation_async_function<Future, F, ContResult, false>{
+                        HPX_MOVE(this_), HPX_MOVE(f)},
                 desc);
 
             if (&ec != &throws)
@@ -523,6 +528,30 @@ namespace hpx { namespace lcos { namespace detail {
         std::decay_t<F> f_;
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The function run by the thread executing a continuation. This is a named
+    // type (instead of a lambda) to allow for it to be recognized by
+    // traits::is_stackless_callable.
+    template <typename Future, typename F, typename ContResult, bool Unwrap>
+    struct continuation_async_function
+    {
+        void operator()()
+        {
+            if constexpr (Unwrap)
+            {
+                this_->async_impl(HPX_MOVE(f_));
+            }
+            else
+            {
+                this_->async_impl_nounwrap(HPX_MOVE(f_));
+            }
+        }
+
+        hpx::intrusive_ptr<continuation<Future, F, ContResult>> this_;
+        traits::detail::shared_state_ptr_for_t<Future> f_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
     template <typename Allocator, typename Future, typename F,
         typename ContResult>
     class continuation_allocator : public continuation<Future, F, ContResult>
@@ -575,6 +604,16 @@ namespace hpx { namespace traits { namespace detail {
     };
 }}}    // namespace hpx::traits::detail
 
+namespace hpx { namespace traits {
+    // A continuation does not suspend if the function it runs does not.
+    template <typename Future, typename F, typename ContResult, bool Unwrap>
+    struct is_stackless_callable<
+        lcos::detail::continuation_async_function<Future, F, ContResult,
+            Unwrap>> : is_stackless_callable<std::decay_t<F>>
+    {
+    };
+}}    // namespace hpx::traits
+
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace lcos { namespace detail {
     ///////////////////////////////////////////////////////////////////////////
@@ -761,8 +800,8 @@ namespace hpx { namespace lcos { namespace detail {
     inline traits::detail::shared_state_ptr_t<future_unwrap_result_t<Future>>
     unwrap_impl(Future&& future, error_code& ec)
     {
-        return unwrap_impl_alloc(
-            util::internal_allocator<>{}, HPX_FORWARD(Future, future), ec);
+        return unwrap_impl_alloc(util::thread_local_caching_allocator<>{},
+            HPX_FORWARD(Future, future), ec);
     }
 
     template <typename Allocator, typename Future>
@@ -8,6 +8,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/allocator_deleter.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/future_access.hpp>
 #include <hpx/modules/errors.hpp>
@@ -63,9 +64,7 @@ namespace hpx {
                 unique_pointer p(traits::allocate(alloc, 1),
                     util::allocator_deleter<other_allocator>{alloc});
 
-                using lcos::detail::in_place;
-                traits::construct(
-                    alloc, p.get(), init_no_addref{}, in_place{}, alloc);
+                traits::construct(alloc, p.get(), init_no_addref{}, alloc);
                 shared_state_.reset(p.release(), false);
             }
 
@@ -233,7 +232,11 @@ namespace hpx {
 
     public:
         // Effects: constructs a promise object and a shared state.
-        promise() = default;
+        promise()
+          : base_type(std::allocator_arg,
+                hpx::util::thread_local_caching_allocator<>{})
+        {
+        }
 
         // Effects: constructs a promise object and a shared state. The
         // constructor uses the allocator a to allocate the memory for the
@@ -364,7 +367,11 @@ namespace hpx {
 
     public:
         // Effects: constructs a promise object and a shared state.
-        promise() = default;
+        promise()
+          : base_type(std::allocator_arg,
+                hpx::util::thread_local_caching_allocator<>{})
+        {
+        }
 
         // Effects: constructs a promise object and a shared state. The
         // constructor uses the allocator a to allocate the memory for the
@@ -454,7 +461,11 @@ namespace hpx {
 
     public:
         // Effects: constructs a promise object and a shared state.
-        promise() = default;
+        promise()
+          : base_type(std::allocator_arg,
+                hpx::util::thread_local_caching_allocator<>{})
+        {
+        }
 
         // Effects: constructs a promise object and a shared state. The
         // constructor uses the allocator a to allocate the memory for the
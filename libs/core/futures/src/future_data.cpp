@@ -19,9 +19,12 @@
 #include <hpx/modules/memory.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <utility>
 
@@ -87,8 +90,11 @@ namespace hpx { namespace lcos { namespace detail {
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    future_data_base<traits::detail::future_data_void>::~future_data_base() =
-        default;
+    future_data_base<traits::detail::future_data_void>::~future_data_base()
+    {
+        release_on_completed(state_.load(std::memory_order_relaxed));
+        delete waiters_.load(std::memory_order_relaxed);
+    }
 
     static util::unused_type unused_;
 
@@ -114,7 +120,7 @@ namespace hpx { namespace lcos { namespace detail {
         // thread was suspended, in this case we need to load it again.
         if (s == empty)
         {
-            s = state_.load(std::memory_order_relaxed);
+            s = get_state(std::memory_order_relaxed);
         }
 
         if (s == value)
@@ -178,12 +184,12 @@ namespace hpx { namespace lcos { namespace detail {
     }
 
     void future_data_base<traits::detail::future_data_void>::run_on_completed(
-        completed_callback_vector_type&& on_completed) noexcept
+        completed_callback_list&& on_completed) noexcept
     {
-        for (auto&& func : on_completed)
-        {
+        completed_callback_list callbacks = HPX_MOVE(on_completed);
+        callbacks.consume([](completed_callback_type&& func) {
             run_on_completed(HPX_MOVE(func));
-        }
+        });
     }
 
     // make sure continuation invocation does not recurse deeper than
@@ -238,12 +244,96 @@ namespace hpx { namespace lcos { namespace detail {
 
     // We need only one explicit instantiation here as the second version
     // (single callback) is implicitly instantiated below.
-    using completed_callback_vector_type =
-        future_data_refcnt_base::completed_callback_vector_type;
+    using completed_callback_list = future_data_base<
+        traits::detail::future_data_void>::completed_callback_list;
 
     template HPX_CORE_EXPORT void
     future_data_base<traits::detail::future_data_void>::handle_on_completed<
-        completed_callback_vector_type>(completed_callback_vector_type&&);
+        completed_callback_list>(completed_callback_list&&);
+
+    bool future_data_base<traits::detail::future_data_void>::set_ready(
+        state s, completed_callback_list& on_completed)
+    {
+        // Replacing the whole word closes the stack of continuations. This
+        // has to be sequentially consistent with respect to the publication
+        // of waiters_ in get_waiters().
+        std::uintptr_t old = state_.load(std::memory_order_relaxed);
+        do
+        {
+            if (old & ready)
+            {
+                return false;
+            }
+        } while (!state_.compare_exchange_weak(
+            old, s, std::memory_order_seq_cst, std::memory_order_relaxed));
+
+        completed_callback_type first;
+        if (old & inline_published)
+        {
+            first = HPX_MOVE(on_completed_inline_);
+            on_completed_inline_.reset();
+        }
+        on_completed = completed_callback_list(HPX_MOVE(first),
+            reinterpret_cast<completed_callback_node*>(old & callbacks_mask));
+
+        // handle all threads waiting for the future to become ready
+        waiters_type* waiters = waiters_.load(std::memory_order_seq_cst);
+        if (waiters != nullptr)
+        {
+            // Note: we use notify_one repeatedly instead of notify_all as we
+            //       know: a) that most of the time we have at most one thread
+            //       waiting on the future (most futures are not shared), and
+            //       b) our implementation of condition_variable::notify_one
+            //       relinquishes the lock before resuming the waiting thread
+            //       which avoids suspension of this thread when it tries to
+            //       re-lock the mutex while exiting from condition_variable::wait
+            std::unique_lock l(waiters->mtx_);
+            while (waiters->cond_.notify_one(
+                HPX_MOVE(l), threads::thread_priority::boost))
+            {
+                l = std::unique_lock(waiters->mtx_);
+            }
+
+            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
+            //       it unlocked when returning.
+        }
+        return true;
+    }
+
+    void
+    future_data_base<traits::detail::future_data_void>::release_on_completed(
+        std::uintptr_t s) noexcept
+    {
+        if (s & ready)
+        {
+            return;    // the continuations have been taken already
+        }
+
+        if (s & inline_claimed)
+        {
+            on_completed_inline_.reset();
+        }
+
+        // the list releases the remaining nodes
+        completed_callback_list(completed_callback_type(),
+            reinterpret_cast<completed_callback_node*>(s & callbacks_mask));
+    }
+
+    future_data_base<traits::detail::future_data_void>::waiters_type*
+    future_data_base<traits::detail::future_data_void>::get_waiters()
+    {
+        waiters_type* waiters = waiters_.load(std::memory_order_seq_cst);
+        if (waiters == nullptr)
+        {
+            auto new_waiters = std::make_unique<waiters_type>();
+            if (waiters_.compare_exchange_strong(waiters, new_waiters.get(),
+                    std::memory_order_seq_cst))
+            {
+                waiters = new_waiters.release();
+            }
+        }
+        return waiters;
+    }
 
     /// Set the callback which needs to be invoked when the future becomes
     /// ready. If the future is ready the function will be invoked
@@ -254,47 +344,85 @@ namespace hpx { namespace lcos { namespace detail {
         if (!data_sink)
             return;
 
-        if (is_ready())
-        {
-            // invoke the callback (continuation) function right away
-            handle_on_completed(HPX_MOVE(data_sink));
-        }
-        else
+        std::uintptr_t s = state_.load(std::memory_order_acquire);
+
+        // the first continuation is stored inline, which avoids allocating a
+        // node in the common case of a single continuation
+        while ((s & (ready | inline_claimed)) == 0)
         {
-            std::unique_lock l(mtx_);
-            if (is_ready())
+            if (state_.compare_exchange_weak(s, s | inline_claimed,
+                    std::memory_order_acquire, std::memory_order_acquire))
             {
-                l.unlock();
+                on_completed_inline_ = HPX_MOVE(data_sink);
+
+                s |= inline_claimed;
+                while ((s & ready) == 0)
+                {
+                    if (state_.compare_exchange_weak(s, s | inline_published,
+                            std::memory_order_release,
+                            std::memory_order_acquire))
+                    {
+                        return;
+                    }
+                }
 
-                // invoke the callback (continuation) function
-                handle_on_completed(HPX_MOVE(data_sink));
+                // the future became ready in the meantime, invoke the
+                // callback (continuation) function right away
+                completed_callback_type f = HPX_MOVE(on_completed_inline_);
+                on_completed_inline_.reset();
+                handle_on_completed(HPX_MOVE(f));
+                return;
             }
-            else
+        }
+
+        if ((s & ready) == 0)
+        {
+            // push the continuation onto the stack of registered callbacks
+            auto node = std::make_unique<completed_callback_node>();
+            node->f_ = HPX_MOVE(data_sink);
+
+            do
             {
-                on_completed_.push_back(HPX_MOVE(data_sink));
-            }
+                node->next_ = reinterpret_cast<completed_callback_node*>(
+                    s & callbacks_mask);
+                if (state_.compare_exchange_weak(s,
+                        reinterpret_cast<std::uintptr_t>(node.get()) |
+                            (s & ~callbacks_mask),
+                        std::memory_order_release, std::memory_order_acquire))
+                {
+                    node.release();
+                    return;
+                }
+            } while ((s & ready) == 0);
+
+            data_sink = HPX_MOVE(node->f_);
         }
+
+        // invoke the callback (continuation) function right away
+        handle_on_completed(HPX_MOVE(data_sink));
     }
 
     future_data_base<traits::detail::future_data_void>::state
     future_data_base<traits::detail::future_data_void>::wait(error_code& ec)
     {
         // block if this entry is empty
-        state s = state_.load(std::memory_order_acquire);
+        state s = get_state();
         if (s == empty)
         {
-            std::unique_lock l(mtx_);
-            s = state_.load(std::memory_order_relaxed);
+            waiters_type* waiters = get_waiters();
+
+            std::unique_lock l(waiters->mtx_);
+            s = get_state(std::memory_order_seq_cst);
             if (s == empty)
             {
-                cond_.wait(l, "future_data_base::wait", ec);
+                waiters->cond_.wait(l, "future_data_base::wait", ec);
                 if (ec)
                 {
                     return s;
                 }
 
                 // reload the state, it's not empty anymore
-                s = state_.load(std::memory_order_relaxed);
+                s = get_state();
             }
         }
 
@@ -310,20 +438,23 @@ namespace hpx { namespace lcos { namespace detail {
         std::chrono::steady_clock::time_point const& abs_time, error_code& ec)
     {
         // block if this entry is empty
-        if (state_.load(std::memory_order_acquire) == empty)
+        if (get_state() == empty)
         {
-            std::unique_lock l(mtx_);
-            if (state_.load(std::memory_order_relaxed) == empty)
+            waiters_type* waiters = get_waiters();
+
+            std::unique_lock l(waiters->mtx_);
+            if (get_state(std::memory_order_seq_cst) == empty)
             {
-                threads::thread_restart_state const reason = cond_.wait_until(
-                    l, abs_time, "future_data_base::wait_until", ec);
+                threads::thread_restart_state const reason =
+                    waiters->cond_.wait_until(
+                        l, abs_time, "future_data_base::wait_until", ec);
                 if (ec)
                 {
                     return hpx::future_status::uninitialized;
                 }
 
                 if (reason == threads::thread_restart_state::timeout &&
-                    state_.load(std::memory_order_acquire) == empty)
+                    get_state() == empty)
                 {
                     return hpx::future_status::timeout;
                 }
@@ -0,0 +1,144 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Exercise the lock-free continuation list and the on-demand waiter support
+// of the future shared state.
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_continuation_order()
+{
+    constexpr std::size_t num_continuations = 10;
+
+    hpx::lcos::local::promise<int> p;
+    hpx::shared_future<int> f = p.get_future();
+
+    std::vector<std::size_t> order;
+    std::vector<hpx::future<void>> results;
+    for (std::size_t i = 0; i != num_continuations; ++i)
+    {
+        results.push_back(f.then(hpx::launch::sync,
+            [&order, i](hpx::shared_future<int>&&) { order.push_back(i); }));
+    }
+
+    p.set_value(42);
+    hpx::wait_all(results);
+
+    // continuations run in the order they were attached
+    HPX_TEST_EQ(order.size(), num_continuations);
+    for (std::size_t i = 0; i != order.size(); ++i)
+    {
+        HPX_TEST_EQ(order[i], i);
+    }
+
+    // continuations attached to a ready future run right away
+    bool executed = false;
+    f.then(hpx::launch::sync, [&](hpx::shared_future<int>&&) {
+         executed = true;
+     }).get();
+    HPX_TEST(executed);
+}
+
+void test_concurrent_continuations()
+{
+    constexpr std::size_t num_threads = 100;
+
+    hpx::lcos::local::promise<int> p;
+    hpx::shared_future<int> f = p.get_future();
+
+    std::atomic<std::size_t> count(0);
+    std::vector<hpx::future<void>> attached;
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        attached.push_back(hpx::async([&]() {
+            f.then(hpx::launch::sync, [&](hpx::shared_future<int>&& f) {
+                HPX_TEST_EQ(f.get(), 42);
+                ++count;
+            });
+        }));
+
+        if (i == num_threads / 2)
+        {
+            p.set_value(42);
+        }
+    }
+
+    hpx::wait_all(attached);
+
+    // every continuation ran exactly once, whether it was attached before or
+    // after the future became ready
+    HPX_TEST_EQ(count.load(), num_threads);
+}
+
+void test_waiters()
+{
+    constexpr std::size_t num_waiters = 10;
+
+    hpx::lcos::local::promise<void> p;
+    hpx::shared_future<void> f = p.get_future();
+
+    HPX_TEST(f.wait_for(std::chrono::milliseconds(10)) ==
+        hpx::future_status::timeout);
+
+    std::vector<hpx::future<void>> waiters;
+    for (std::size_t i = 0; i != num_waiters; ++i)
+    {
+        waiters.push_back(hpx::async([f]() { f.wait(); }));
+    }
+
+    p.set_value();
+    hpx::wait_all(waiters);
+
+    HPX_TEST(f.is_ready());
+    HPX_TEST(f.wait_for(std::chrono::milliseconds(10)) ==
+        hpx::future_status::ready);
+}
+
+void test_set_twice()
+{
+    hpx::lcos::local::promise<int> p;
+    hpx::future<int> f = p.get_future();
+
+    p.set_value(1);
+
+    bool caught_exception = false;
+    try
+    {
+        p.set_value(2);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST(e.get_error() == hpx::promise_already_satisfied);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+    HPX_TEST_EQ(f.get(), 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_continuation_order();
+    test_concurrent_continuations();
+    test_waiters();
+    test_set_twice();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
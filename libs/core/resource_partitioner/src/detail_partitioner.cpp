@@ -149,6 +149,9 @@ namespace hpx { namespace resource { namespace detail {
         case resource::shared_priority:
             sched = "shared_priority";
             break;
+        case resource::local_workstealing:
+            sched = "local_workstealing";
+            break;
         }
 
         os << "\"" << sched << "\" is running on PUs : \n";
@@ -475,6 +478,11 @@ namespace hpx { namespace resource { namespace detail {
         {
             default_scheduler = scheduling_policy::shared_priority;
         }
+        else if (0 ==
+            std::string("local-workstealing").find(default_scheduler_str))
+        {
+            default_scheduler = scheduling_policy::local_workstealing;
+        }
         else
         {
             throw hpx::detail::command_line_error(
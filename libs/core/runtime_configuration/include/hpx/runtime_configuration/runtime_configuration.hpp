@@ -112,8 +112,21 @@ namespace hpx { namespace util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
         bool use_stack_guard_pages() const;
+
+        // Return the limits for the memory held by the process-wide pool of
+        // cached thread stacks.
+        std::size_t get_stack_pool_watermark() const;
+        std::size_t get_stack_pool_max_size() const;
 #endif
 
+        // Return whether the stack usage of threads should be measured and
+        // whether it should be used to select the stack size of new threads.
+        bool track_stack_usage() const;
+        bool adapt_stack_size() const;
+
+        // Return the interval at which thread wait times are sampled
+        std::uint32_t get_wait_time_sample_interval() const;
+
         // return trace_depth for stack-backtraces
         std::size_t trace_depth() const;
 
@@ -156,6 +169,7 @@ namespace hpx { namespace util {
         std::ptrdiff_t init_medium_stack_size() const;
         std::ptrdiff_t init_large_stack_size() const;
         std::ptrdiff_t init_huge_stack_size() const;
+        std::ptrdiff_t init_reduced_stack_size() const;
 
         void pre_initialize_ini();
         void post_initialize_ini(std::string& hpx_ini_file,
@@ -192,6 +206,7 @@ namespace hpx { namespace util {
         std::ptrdiff_t medium_stacksize;
         std::ptrdiff_t large_stacksize;
         std::ptrdiff_t huge_stacksize;
+        std::ptrdiff_t reduced_stacksize;
         bool need_to_call_pre_initialize;
 #if defined(__linux) || defined(linux) || defined(__linux__)
         char const* argv0;
@@ -209,9 +209,17 @@ namespace hpx { namespace util {
                 HPX_PP_EXPAND(HPX_LARGE_STACK_SIZE)) "}",
             "huge_size = ${HPX_HUGE_STACK_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_HUGE_STACK_SIZE)) "}",
+            "reduced_size = ${HPX_REDUCED_STACK_SIZE:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_REDUCED_STACK_SIZE)) "}",
+            "track_usage = ${HPX_TRACK_STACK_USAGE:0}",
+            "adaptive_size = ${HPX_ADAPTIVE_STACK_SIZE:0}",
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+            "pool_watermark = ${HPX_STACK_POOL_WATERMARK:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_STACK_POOL_WATERMARK)) "}",
+            "pool_max_size = ${HPX_STACK_POOL_MAX_SIZE:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_STACK_POOL_MAX_SIZE)) "}",
 #endif
 
             "[hpx.threadpools]",
@@ -255,6 +263,18 @@ namespace hpx { namespace util {
             "init_threads_count = "
             "${HPX_THREAD_QUEUE_INIT_THREADS_COUNT:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_THREAD_QUEUE_INIT_THREADS_COUNT)) "}",
+            "max_recycled_thread_count = "
+            "${HPX_THREAD_QUEUE_MAX_RECYCLED_THREAD_COUNT:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_MAX_RECYCLED_THREAD_COUNT)) "}",
+            "lock_free_recycling = "
+            "${HPX_THREAD_QUEUE_LOCK_FREE_RECYCLING:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_LOCK_FREE_RECYCLING)) "}",
+            "max_lifo_slot_runs = "
+            "${HPX_THREAD_QUEUE_MAX_LIFO_SLOT_RUNS:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_MAX_LIFO_SLOT_RUNS)) "}",
+            "wait_time_sample_interval = "
+            "${HPX_THREAD_QUEUE_WAIT_TIME_SAMPLE_INTERVAL:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_WAIT_TIME_SAMPLE_INTERVAL)) "}",
 
             "[hpx.commandline]",
             // enable aliasing
@@ -690,6 +710,7 @@ namespace hpx { namespace util {
       , medium_stacksize(HPX_MEDIUM_STACK_SIZE)
       , large_stacksize(HPX_LARGE_STACK_SIZE)
       , huge_stacksize(HPX_HUGE_STACK_SIZE)
+      , reduced_stacksize(HPX_REDUCED_STACK_SIZE)
       , need_to_call_pre_initialize(true)
 #if defined(__linux) || defined(linux) || defined(__linux__)
       , argv0(argv0_)
@@ -710,6 +731,7 @@ namespace hpx { namespace util {
         large_stacksize = init_large_stack_size();
         HPX_ASSERT(init_huge_stack_size() <= HPX_HUGE_STACK_SIZE);
         huge_stacksize = init_huge_stack_size();
+        reduced_stacksize = init_reduced_stack_size();
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -742,6 +764,7 @@ namespace hpx { namespace util {
         medium_stacksize = init_medium_stack_size();
         large_stacksize = init_large_stack_size();
         huge_stacksize = init_huge_stack_size();
+        reduced_stacksize = init_reduced_stack_size();
     }
 
     std::size_t runtime_configuration::get_ipc_data_buffer_cache_size() const
@@ -1095,8 +1118,54 @@ namespace hpx { namespace util {
         }
         return true;    // default is true
     }
+
+    std::size_t runtime_configuration::get_stack_pool_watermark() const
+    {
+        return static_cast<std::size_t>(init_stack_size("pool_watermark",
+            HPX_PP_STRINGIZE(HPX_STACK_POOL_WATERMARK),
+            HPX_STACK_POOL_WATERMARK));
+    }
+
+    std::size_t runtime_configuration::get_stack_pool_max_size() const
+    {
+        return static_cast<std::size_t>(init_stack_size("pool_max_size",
+            HPX_PP_STRINGIZE(HPX_STACK_POOL_MAX_SIZE),
+            HPX_STACK_POOL_MAX_SIZE));
+    }
 #endif
 
+    bool runtime_configuration::track_stack_usage() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(*sec, "track_usage", 0) != 0;
+        }
+        return false;    // default is false
+    }
+
+    bool runtime_configuration::adapt_stack_size() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(*sec, "adaptive_size", 0) != 0;
+        }
+        return false;    // default is false
+    }
+
+    std::uint32_t runtime_configuration::get_wait_time_sample_interval() const
+    {
+        if (util::section const* sec = get_section("hpx.thread_queue");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::uint32_t>(*sec,
+                "wait_time_sample_interval",
+                HPX_THREAD_QUEUE_WAIT_TIME_SAMPLE_INTERVAL);
+        }
+        return HPX_THREAD_QUEUE_WAIT_TIME_SAMPLE_INTERVAL;
+    }
+
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
     {
         return init_stack_size("small_size",
@@ -1121,6 +1190,12 @@ namespace hpx { namespace util {
             HPX_PP_STRINGIZE(HPX_HUGE_STACK_SIZE), HPX_HUGE_STACK_SIZE);
     }
 
+    std::ptrdiff_t runtime_configuration::init_reduced_stack_size() const
+    {
+        return init_stack_size("reduced_size",
+            HPX_PP_STRINGIZE(HPX_REDUCED_STACK_SIZE), HPX_REDUCED_STACK_SIZE);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // Return maximally allowed message size
     std::uint64_t runtime_configuration::get_max_inbound_message_size() const
@@ -1188,6 +1263,9 @@ namespace hpx { namespace util {
         case threads::thread_stacksize::huge:
             return huge_stacksize;
 
+        case threads::thread_stacksize::reduced:
+            return reduced_stacksize;
+
         case threads::thread_stacksize::nostack:
             return (std::numeric_limits<std::ptrdiff_t>::max)();
 
@@ -2063,6 +2063,8 @@ namespace hpx {
                 size_enum = thread_stacksize::large;
             else if (rtcfg.get_stack_size(thread_stacksize::huge) == size)
                 size_enum = thread_stacksize::huge;
+            else if (rtcfg.get_stack_size(thread_stacksize::reduced) == size)
+                size_enum = thread_stacksize::reduced;
             else if (rtcfg.get_stack_size(thread_stacksize::nostack) == size)
                 size_enum = thread_stacksize::nostack;
 
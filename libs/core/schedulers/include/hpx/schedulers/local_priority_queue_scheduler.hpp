@@ -592,6 +592,106 @@ namespace hpx { namespace threads { namespace policies {
                 ;
         }
 
+        // create a batch of threads, all threads have to be created in the
+        // pending state
+        void create_thread_batch(thread_init_data* data, std::size_t count,
+            error_code& ec) override
+        {
+            // Threads without a hint are distributed over all queues in
+            // contiguous chunks, consecutive normal priority threads
+            // targeting the same queue are handed to it at once.
+            std::size_t const first_queue = curr_queue_++ % num_queues_;
+            std::size_t const chunk_size =
+                (count + num_queues_ - 1) / num_queues_;
+
+            std::size_t first = 0;
+            std::size_t queue = std::size_t(-1);
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                thread_init_data& d = data[i];
+                if (d.run_now || d.priority != thread_priority::normal)
+                {
+                    create_queue_thread_batch(
+                        queue, data + first, i - first, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+
+                    create_thread(d, nullptr, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+
+                    first = i + 1;
+                    queue = std::size_t(-1);
+                    continue;
+                }
+
+                // NOTE: This scheduler ignores NUMA hints.
+                std::size_t num_thread =
+                    d.schedulehint.mode == thread_schedule_hint_mode::thread ?
+                    d.schedulehint.hint :
+                    std::size_t(-1);
+
+                if (std::size_t(-1) == num_thread)
+                {
+                    num_thread = (first_queue + i / chunk_size) % num_queues_;
+                }
+                else if (num_thread >= num_queues_)
+                {
+                    num_thread %= num_queues_;
+                }
+
+                if (num_thread != queue)
+                {
+                    create_queue_thread_batch(
+                        queue, data + first, i - first, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+
+                    first = i;
+                    queue = num_thread;
+                }
+            }
+
+            create_queue_thread_batch(
+                queue, data + first, count - first, ec);
+        }
+
+    private:
+        void create_queue_thread_batch(std::size_t num_thread,
+            thread_init_data* data, std::size_t count, error_code& ec)
+        {
+            if (count == 0)
+            {
+                return;
+            }
+
+            std::unique_lock<pu_mutex_type> l;
+            num_thread = select_active_pu(l, num_thread);
+
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                data[i].schedulehint.mode = thread_schedule_hint_mode::thread;
+                data[i].schedulehint.hint =
+                    static_cast<std::int16_t>(num_thread);
+            }
+
+            HPX_ASSERT(num_thread < num_queues_);
+            queues_[num_thread].data_->create_thread_batch(data, count, ec);
+
+            LTM_(debug).format(
+                "local_priority_queue_scheduler::create_thread_batch normal "
+                "priority queue: pool({}), scheduler({}), worker_thread({}), "
+                "count({})",
+                *this->get_parent_pool(), *this, num_thread, count);
+        }
+
+    public:
         // Return the next thread to be executed, return false if none is
         // available
         bool get_next_thread(std::size_t num_thread, bool running,
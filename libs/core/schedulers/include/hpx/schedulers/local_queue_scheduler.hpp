@@ -388,7 +388,7 @@ namespace hpx { namespace threads { namespace policies {
                             continue;
 
                         thread_queue_type* q = queues_[idx];
-                        if (q->get_next_thread(thrd, running))
+                        if (q->get_next_thread(thrd, running, true))
                         {
                             q->increment_num_stolen_from_pending();
                             queues_[num_thread]
@@ -421,7 +421,7 @@ namespace hpx { namespace threads { namespace policies {
                             continue;
 
                         thread_queue_type* q = queues_[idx];
-                        if (q->get_next_thread(thrd, running))
+                        if (q->get_next_thread(thrd, running, true))
                         {
                             q->increment_num_stolen_from_pending();
                             queues_[num_thread]
@@ -443,7 +443,7 @@ namespace hpx { namespace threads { namespace policies {
                     HPX_ASSERT(idx != num_thread);
 
                     thread_queue_type* q = queues_[idx];
-                    if (q->get_next_thread(thrd, running))
+                    if (q->get_next_thread(thrd, running, true))
                     {
                         q->increment_num_stolen_from_pending();
                         queues_[num_thread]->increment_num_stolen_to_pending();
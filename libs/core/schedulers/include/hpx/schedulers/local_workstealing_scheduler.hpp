@@ -0,0 +1,377 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/chase_lev_deque.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/schedulers/local_priority_queue_scheduler.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/threading_base/detail/wait_time_samples.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The local_workstealing_scheduler extends the
+    /// local_priority_queue_scheduler with one Chase-Lev deque per OS thread.
+    /// Normal priority threads which are created or scheduled by a worker
+    /// thread for itself are pushed onto its own deque, from where the worker
+    /// pops them in LIFO order. Idle workers steal from the other end of the
+    /// deques of randomly selected victims, preferring victims in their own
+    /// NUMA domain, and take up to half of the victim's threads at once.
+    /// Everything else (high and low priority threads, threads created from
+    /// outside of the pool) is handled by the underlying thread queues.
+    template <typename Mutex = std::mutex,
+        typename PendingQueuing = lockfree_fifo,
+        typename StagedQueuing = lockfree_fifo,
+        typename TerminatedQueuing =
+            default_local_priority_queue_scheduler_terminated_queue>
+    class HPX_CORE_EXPORT local_workstealing_scheduler
+      : public local_priority_queue_scheduler<Mutex, PendingQueuing,
+            StagedQueuing, TerminatedQueuing>
+    {
+        using base_type = local_priority_queue_scheduler<Mutex,
+            PendingQueuing, StagedQueuing, TerminatedQueuing>;
+
+        using thread_repr = typename thread_id_ref_type::thread_repr;
+        using deque_type = hpx::concurrency::chase_lev_deque<thread_repr*>;
+
+        // Every so many calls to get_next_thread the thread queue of a worker
+        // is checked before its deque to avoid starving threads which were
+        // made runnable from outside of the pool.
+        static constexpr std::size_t queue_check_interval = 16;
+
+        struct worker_data
+        {
+            worker_data()
+              : deque_(new deque_type())
+            {
+            }
+
+            std::unique_ptr<deque_type> deque_;
+            std::vector<std::size_t> local_victims_;
+            std::vector<std::size_t> remote_victims_;
+            std::minstd_rand rng_;
+            std::size_t num_calls_ = 0;
+        };
+
+    public:
+        using thread_queue_type = typename base_type::thread_queue_type;
+        using init_parameter_type = typename base_type::init_parameter_type;
+
+        local_workstealing_scheduler(init_parameter_type const& init,
+            bool deferred_initialization = true)
+          : base_type(init, deferred_initialization)
+          , workers_(this->num_queues_)
+        {
+        }
+
+        ~local_workstealing_scheduler() override
+        {
+            // release the references held by threads which were never run
+            for (auto& worker : workers_)
+            {
+                thread_repr* thrd = nullptr;
+                while (worker.data_.deque_->pop(thrd))
+                {
+                    thread_id_ref_type(thrd, thread_id_addref::no);
+                }
+            }
+        }
+
+        static std::string get_scheduler_name()
+        {
+            return "local_workstealing_scheduler";
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // create a new thread and schedule it if the initial state is equal to
+        // pending
+        void create_thread(thread_init_data& data, thread_id_ref_type* id,
+            error_code& ec) override
+        {
+            std::size_t num_thread = owning_worker(data.schedulehint);
+            if (num_thread == std::size_t(-1) ||
+                data.priority != thread_priority::normal ||
+                data.initial_state != thread_schedule_state::pending)
+            {
+                base_type::create_thread(data, id, ec);
+                return;
+            }
+
+            // Create the thread object right away (bypassing the staged
+            // queue) without scheduling it, the new thread is pushed onto
+            // the deque of the current worker instead.
+            data.schedulehint.mode = thread_schedule_hint_mode::thread;
+            data.schedulehint.hint = static_cast<std::int16_t>(num_thread);
+            data.initial_state = thread_schedule_state::pending_do_not_schedule;
+            data.run_now = true;
+
+            thread_id_ref_type thrd;
+            this->queues_[num_thread].data_->create_thread(data, &thrd, ec);
+            if (!thrd)
+            {
+                return;
+            }
+
+            if (id)
+            {
+                *id = thrd;
+            }
+
+            LTM_(debug).format(
+                "local_workstealing_scheduler::create_thread, deque: "
+                "pool({}), scheduler({}), worker_thread({}), thread({})",
+                *this->get_parent_pool(), *this, num_thread, thrd);
+
+            // detach the thread from the id_ref without decrementing the
+            // reference count
+            workers_[num_thread].data_.deque_->push(thrd.detach());
+        }
+
+        // Return the next thread to be executed, return false if none is
+        // available
+        bool get_next_thread(std::size_t num_thread, bool running,
+            threads::thread_id_ref_type& thrd, bool enable_stealing) override
+        {
+            HPX_ASSERT(num_thread < this->num_queues_);
+            worker_data& worker = workers_[num_thread].data_;
+
+            // high priority threads are always handled first
+            if (num_thread < this->num_high_priority_queues_ &&
+                this->high_priority_queues_[num_thread].data_->get_next_thread(
+                    thrd))
+            {
+                return true;
+            }
+
+            thread_queue_type* this_queue = this->queues_[num_thread].data_;
+            if (++worker.num_calls_ % queue_check_interval == 0 &&
+                this_queue->get_next_thread(thrd))
+            {
+                return true;
+            }
+
+            thread_repr* next = nullptr;
+            if (worker.deque_->pop(next))
+            {
+                thrd.reset(next, false);    // do not addref!
+                threads::detail::record_queued_time(
+                    get_thread_id_data(thrd), false);
+                return true;
+            }
+
+            if (running && enable_stealing && steal_half(num_thread, thrd))
+            {
+                return true;
+            }
+
+            return base_type::get_next_thread(
+                num_thread, running, thrd, enable_stealing);
+        }
+
+        /// Schedule the passed thread
+        void schedule_thread(threads::thread_id_ref_type thrd,
+            threads::thread_schedule_hint schedulehint,
+            bool allow_fallback = false,
+            thread_priority priority = thread_priority::normal) override
+        {
+            std::size_t num_thread = owning_worker(schedulehint);
+            if (num_thread == std::size_t(-1) ||
+                priority != thread_priority::normal)
+            {
+                base_type::schedule_thread(
+                    HPX_MOVE(thrd), schedulehint, allow_fallback, priority);
+                return;
+            }
+
+            threads::detail::sample_queued_time_start(get_thread_id_data(thrd));
+            workers_[num_thread].data_.deque_->push(thrd.detach());
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // This returns the current length of the queues, including the deques
+        std::int64_t get_queue_length(
+            std::size_t num_thread = std::size_t(-1)) const override
+        {
+            std::int64_t count = base_type::get_queue_length(num_thread);
+            if (std::size_t(-1) != num_thread)
+            {
+                HPX_ASSERT(num_thread < this->num_queues_);
+                return count + workers_[num_thread].data_.deque_->size();
+            }
+
+            for (auto const& worker : workers_)
+            {
+                count += worker.data_.deque_->size();
+            }
+            return count;
+        }
+
+        // Queries whether a given core is idle
+        bool is_core_idle(std::size_t num_thread) const override
+        {
+            if (num_thread < this->num_queues_ &&
+                !workers_[num_thread].data_.deque_->empty())
+            {
+                return false;
+            }
+            return base_type::is_core_idle(num_thread);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void on_start_thread(std::size_t num_thread) override
+        {
+            base_type::on_start_thread(num_thread);
+
+            worker_data& worker = workers_[num_thread].data_;
+            worker.rng_.seed(static_cast<unsigned>(num_thread + 1));
+
+            // split the potential victims into those which share our NUMA
+            // domain and all others
+            std::size_t num_threads = this->num_queues_;
+            auto const& topo = create_topology();
+
+            std::size_t num_pu = this->affinity_data_.get_pu_num(num_thread);
+            std::size_t numa_node = topo.get_numa_node_number(num_pu);
+
+            worker.local_victims_.clear();
+            worker.remote_victims_.clear();
+            for (std::size_t i = 0; i != num_threads; ++i)
+            {
+                if (i == num_thread)
+                {
+                    continue;
+                }
+
+                num_pu = this->affinity_data_.get_pu_num(i);
+                if (topo.get_numa_node_number(num_pu) == numa_node)
+                {
+                    worker.local_victims_.push_back(i);
+                }
+                else if (this->has_scheduler_mode(
+                             policies::scheduler_mode::enable_stealing_numa))
+                {
+                    worker.remote_victims_.push_back(i);
+                }
+            }
+        }
+
+    protected:
+        // Return the worker owning the deque the given thread should be
+        // placed on, or -1 if the thread should be handled by the thread
+        // queues. Only the calling worker may push onto its own deque, so
+        // this succeeds only if the hint doesn't ask for a different worker.
+        std::size_t owning_worker(thread_schedule_hint const& hint) const
+        {
+            if (!this->has_scheduler_mode(
+                    policies::scheduler_mode::enable_stealing))
+            {
+                return std::size_t(-1);
+            }
+
+            if (threads::detail::get_thread_pool_num_tss() !=
+                this->get_parent_pool()->get_pool_id().index())
+            {
+                return std::size_t(-1);
+            }
+
+            std::size_t num_thread =
+                threads::detail::get_local_thread_num_tss();
+            if (num_thread >= this->num_queues_)
+            {
+                return std::size_t(-1);
+            }
+
+            if (hint.mode == thread_schedule_hint_mode::thread &&
+                static_cast<std::size_t>(hint.hint) % this->num_queues_ !=
+                    num_thread)
+            {
+                return std::size_t(-1);
+            }
+
+            return num_thread;
+        }
+
+        // Steal up to half of the threads of a single victim, preferring
+        // victims in our own NUMA domain. The first stolen thread is
+        // returned, all others are moved to our own deque.
+        bool steal_half(std::size_t num_thread, thread_id_ref_type& thrd)
+        {
+            worker_data& worker = workers_[num_thread].data_;
+
+            return steal_half(worker, worker.local_victims_, thrd) ||
+                steal_half(worker, worker.remote_victims_, thrd);
+        }
+
+        bool steal_half(worker_data& worker,
+            std::vector<std::size_t> const& victims, thread_id_ref_type& thrd)
+        {
+            std::size_t num_victims = victims.size();
+            if (num_victims == 0)
+            {
+                return false;
+            }
+
+            // start at a random victim to spread the thieves
+            std::size_t start = worker.rng_() % num_victims;
+            for (std::size_t i = 0; i != num_victims; ++i)
+            {
+                deque_type& victim =
+                    *workers_[victims[(start + i) % num_victims]]
+                         .data_.deque_;
+
+                std::int64_t count = (victim.size() + 1) / 2;
+                if (count == 0)
+                {
+                    continue;
+                }
+
+                thread_repr* next = nullptr;
+                if (!victim.steal(next))
+                {
+                    continue;
+                }
+                thrd.reset(next, false);    // do not addref!
+                threads::detail::record_queued_time(
+                    get_thread_id_data(thrd), true);
+
+                // Items are stolen one by one as the owner may concurrently
+                // pop from the other end of the victim's deque.
+                while (--count != 0 && victim.steal(next))
+                {
+                    worker.deque_->push(next);
+                }
+                return true;
+            }
+            return false;
+        }
+
+        std::vector<util::cache_line_data<worker_data>> workers_;
+    };
+}}}    // namespace hpx::threads::policies
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -225,6 +225,20 @@ namespace hpx { namespace threads { namespace policies {
             return len;
         }
 
+        // ----------------------------------------------------------------
+        inline std::int64_t get_queue_length() const
+        {
+            std::size_t len = 0;
+            for (auto& q : queues_)
+            {
+                // the queues are created by the worker threads once they
+                // start running
+                if (q != nullptr)
+                    len += q->get_queue_length();
+            }
+            return len;
+        }
+
         // ----------------------------------------------------------------
         inline std::int64_t get_thread_count(
             thread_schedule_state state = thread_schedule_state::unknown,
@@ -111,6 +111,7 @@ namespace hpx { namespace threads { namespace policies {
         thread_heap_type thread_heap_large_;
         thread_heap_type thread_heap_huge_;
         thread_heap_type thread_heap_nostack_;
+        thread_heap_type thread_heap_reduced_;
 
         // these ought to be atomic, but if we get a race and assign a thread
         // to queue N instead of N+1 it doesn't really matter
@@ -252,6 +253,9 @@ namespace hpx { namespace threads { namespace policies {
 
             for (auto t : thread_heap_nostack_)
                 deallocate(get_thread_id_data(t));
+
+            for (auto t : thread_heap_reduced_)
+                deallocate(get_thread_id_data(t));
         }
 
         // ----------------------------------------------------------------
@@ -463,7 +467,8 @@ namespace hpx { namespace threads { namespace policies {
             threads::thread_id_ref_type& tid, threads::thread_init_data& data)
         {
             HPX_ASSERT(data.stacksize >= thread_stacksize::minimal);
-            HPX_ASSERT(data.stacksize <= thread_stacksize::maximal);
+            HPX_ASSERT(data.stacksize <= thread_stacksize::maximal ||
+                data.stacksize == thread_stacksize::reduced);
 
             std::ptrdiff_t const stacksize =
                 data.scheduler_base->get_stack_size(data.stacksize);
@@ -489,6 +494,10 @@ namespace hpx { namespace threads { namespace policies {
             {
                 heap = &thread_heap_nostack_;
             }
+            else if (stacksize == parameters_.reduced_stacksize_)
+            {
+                heap = &thread_heap_reduced_;
+            }
             HPX_ASSERT(heap);
 
             if (data.initial_state ==
@@ -561,6 +570,10 @@ namespace hpx { namespace threads { namespace policies {
             {
                 thread_heap_nostack_.push_front(tid);
             }
+            else if (stacksize == parameters_.reduced_stacksize_)
+            {
+                thread_heap_reduced_.push_front(tid);
+            }
             else
             {
                 HPX_ASSERT_MSG(
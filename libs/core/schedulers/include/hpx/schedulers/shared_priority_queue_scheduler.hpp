@@ -867,8 +867,6 @@ namespace hpx { namespace threads { namespace policies {
             spq_deb.debug(debug::str<>("get_queue_length"), "thread_num ",
                 debug::dec<>(thread_num));
 
-            HPX_ASSERT(thread_num != std::size_t(-1));
-
             std::int64_t count = 0;
             if (thread_num != std::size_t(-1))
             {
@@ -880,7 +878,10 @@ namespace hpx { namespace threads { namespace policies {
             }
             else
             {
-                throw std::runtime_error("unhandled get_queue_length with -1");
+                for (std::size_t d = 0; d < num_domains_; ++d)
+                {
+                    count += numa_holder_[d].get_queue_length();
+                }
             }
             return count;
         }
@@ -0,0 +1,194 @@
+//  Copyright (c) 2007-2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+
+#include <boost/lockfree/stack.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace threads { namespace policies {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A lock-free LIFO holding recycled thread objects (together with their
+    // stacks) of one stack size class. Recycled objects are handed out in
+    // LIFO order to maximize the chance of reusing a stack which is still
+    // cache (and TLB) resident.
+    class thread_heap
+    {
+        using container_type = boost::lockfree::stack<thread_data*>;
+
+    public:
+        explicit thread_heap(std::size_t initial_size = 128)
+          : heap_(initial_size)
+        {
+            count_.data_ = 0;
+        }
+
+        thread_heap(thread_heap const&) = delete;
+        thread_heap(thread_heap&&) = delete;
+        thread_heap& operator=(thread_heap const&) = delete;
+        thread_heap& operator=(thread_heap&&) = delete;
+
+        // The heap does not own the thread objects, use clear() to destroy
+        // them.
+        ~thread_heap() = default;
+
+        bool push(thread_data* thrd)
+        {
+            if (heap_.push(thrd))
+            {
+                count_.data_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+            return false;
+        }
+
+        bool pop(thread_data*& thrd)
+        {
+            if (heap_.pop(thrd))
+            {
+                count_.data_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+            return false;
+        }
+
+        // Move up to 'count' thread objects from this heap into 'dest',
+        // returns the number of objects moved.
+        std::size_t move_to(thread_heap& dest, std::size_t count)
+        {
+            std::size_t moved = 0;
+            thread_data* thrd = nullptr;
+            while (moved != count && pop(thrd))
+            {
+                if (!dest.push(thrd))
+                {
+                    push(thrd);
+                    break;
+                }
+                ++moved;
+            }
+            return moved;
+        }
+
+        void reserve(std::size_t count)
+        {
+            heap_.reserve(count);
+        }
+
+        // This is an estimate only as other threads may concurrently modify
+        // the heap.
+        std::int64_t size() const noexcept
+        {
+            return count_.data_.load(std::memory_order_relaxed);
+        }
+
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        // Destroy all thread objects held by this heap, this is not safe to
+        // be called concurrently with any of the other operations.
+        void clear() noexcept
+        {
+            thread_data* thrd = nullptr;
+            while (pop(thrd))
+            {
+                thrd->destroy();
+            }
+        }
+
+    private:
+        container_type heap_;
+        util::cache_line_data<std::atomic<std::int64_t>> count_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The global overflow pool collects the recycled thread objects which
+    // don't fit into the heaps of the thread queue they were recycled by.
+    // Thread queues that run out of recycled thread objects refill their
+    // heaps from here, which rebalances thread objects between queues with
+    // asymmetric spawn and termination patterns.
+    class HPX_CORE_EXPORT thread_heap_overflow_pool
+    {
+    public:
+        // stack size classes, the order matches thread_stacksize
+        enum heap_index
+        {
+            small_ = 0,
+            medium = 1,
+            large = 2,
+            huge = 3,
+            nostack = 4,
+            reduced = 5,
+            num_heaps = 6
+        };
+
+        // Number of thread objects moved from the overflow pool to a thread
+        // queue heap whenever the latter runs empty.
+        static constexpr std::size_t refill_count = 16;
+
+        static thread_heap_overflow_pool& get() noexcept;
+
+        thread_heap& heap(heap_index index) noexcept
+        {
+            HPX_ASSERT(index < num_heaps);
+            return heaps_[index].data_;
+        }
+
+        // Hand a thread object over to the pool. The pool holds at most as
+        // many thread objects per stack size class as all thread queues
+        // referring to it keep themselves (max_count each); returns false if
+        // that limit is reached, in which case the caller has to destroy the
+        // thread object.
+        bool push(heap_index index, thread_data* thrd,
+            std::int64_t max_count) noexcept
+        {
+            thread_heap& h = heap(index);
+            std::int64_t const max_size =
+                max_count * count_.load(std::memory_order_relaxed);
+            if (h.size() >= max_size)
+            {
+                return false;
+            }
+            return h.push(thrd);
+        }
+
+        // The pool keeps its thread objects alive for as long as at least
+        // one thread queue refers to it.
+        void add_ref() noexcept
+        {
+            count_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void release() noexcept
+        {
+            if (count_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                for (auto& heap : heaps_)
+                {
+                    heap.data_.clear();
+                }
+            }
+        }
+
+    private:
+        thread_heap_overflow_pool() = default;
+
+        util::cache_line_data<thread_heap> heaps_[num_heaps];
+        std::atomic<std::int64_t> count_{0};
+    };
+}}}    // namespace hpx::threads::policies
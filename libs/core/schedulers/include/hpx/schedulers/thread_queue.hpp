@@ -19,7 +19,9 @@
 #include <hpx/schedulers/lockfree_queue_backends.hpp>
 #include <hpx/schedulers/maintain_queue_wait_times.hpp>
 #include <hpx/schedulers/queue_helpers.hpp>
+#include <hpx/schedulers/thread_heap.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/threading_base/detail/wait_time_samples.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_data_stackful.hpp>
@@ -92,9 +94,6 @@ namespace hpx { namespace threads { namespace policies {
             std::hash<thread_id_type>, std::equal_to<thread_id_type>,
             util::internal_allocator<thread_id_type>>;
 
-        using thread_heap_type = std::vector<thread_id_type,
-            util::internal_allocator<thread_id_type>>;
-
         struct task_description
         {
             thread_init_data data;
@@ -125,39 +124,115 @@ namespace hpx { namespace threads { namespace policies {
             typename TerminatedQueuing::template apply<thread_data*>::type;
 
     protected:
-        template <typename Lock>
-        void create_thread_object(threads::thread_id_ref_type& thrd,
-            threads::thread_init_data& data, Lock& lk)
+        // Return the heap holding the recycled thread objects of the given
+        // stack size, together with the index of the corresponding heap in
+        // the global overflow pool.
+        thread_heap* get_thread_heap(std::ptrdiff_t stacksize,
+            thread_heap_overflow_pool::heap_index& index) noexcept
         {
-            HPX_ASSERT(lk.owns_lock());
-
-            std::ptrdiff_t const stacksize =
-                data.scheduler_base->get_stack_size(data.stacksize);
-
-            thread_heap_type* heap = nullptr;
-
             if (stacksize == parameters_.small_stacksize_)
             {
-                heap = &thread_heap_small_;
+                index = thread_heap_overflow_pool::small_;
+                return &thread_heap_small_;
             }
             else if (stacksize == parameters_.medium_stacksize_)
             {
-                heap = &thread_heap_medium_;
+                index = thread_heap_overflow_pool::medium;
+                return &thread_heap_medium_;
             }
             else if (stacksize == parameters_.large_stacksize_)
             {
-                heap = &thread_heap_large_;
+                index = thread_heap_overflow_pool::large;
+                return &thread_heap_large_;
             }
             else if (stacksize == parameters_.huge_stacksize_)
             {
-                heap = &thread_heap_huge_;
+                index = thread_heap_overflow_pool::huge;
+                return &thread_heap_huge_;
             }
             else if (stacksize == parameters_.nostack_stacksize_)
             {
-                heap = &thread_heap_nostack_;
+                index = thread_heap_overflow_pool::nostack;
+                return &thread_heap_nostack_;
+            }
+            else if (stacksize == parameters_.reduced_stacksize_)
+            {
+                index = thread_heap_overflow_pool::reduced;
+                return &thread_heap_reduced_;
+            }
+            return nullptr;
+        }
+
+        // The heaps of recycled thread objects are accessed without a lock,
+        // unless hpx.thread_queue.lock_free_recycling is disabled (which
+        // exists for comparing both variants only).
+        std::unique_lock<mutex_type> lock_thread_heaps()
+        {
+            if (parameters_.lock_free_recycling_)
+            {
+                return std::unique_lock<mutex_type>(
+                    thread_heap_mtx_, std::defer_lock);
             }
+            return std::unique_lock<mutex_type>(thread_heap_mtx_);
+        }
+
+        // Take an unused thread object of the given stack size from the
+        // heaps of this queue, refilling those from the global overflow pool
+        // if necessary. This does not require for the queue mutex to be
+        // held.
+        threads::thread_data* get_recycled_thread_object(
+            std::ptrdiff_t stacksize)
+        {
+            thread_heap_overflow_pool::heap_index index;
+            thread_heap* heap = get_thread_heap(stacksize, index);
             HPX_ASSERT(heap);
 
+            threads::thread_data* p = nullptr;
+            {
+                std::unique_lock<mutex_type> lk = lock_thread_heaps();
+                if (!heap->pop(p))
+                {
+                    thread_heap& overflow = overflow_pool_.heap(index);
+                    if (!overflow.pop(p))
+                    {
+                        return nullptr;
+                    }
+
+                    // move a batch of thread objects over to avoid having to
+                    // go to the global pool for each of the next threads
+                    overflow.move_to(
+                        *heap, thread_heap_overflow_pool::refill_count);
+                }
+            }
+
+            // Thread objects from the overflow pool may have been created by
+            // a queue using a different set of stack sizes.
+            if (HPX_UNLIKELY(p->get_stack_size() != stacksize))
+            {
+                deallocate(p);
+                return nullptr;
+            }
+
+            p->set_queue(this);
+            return p;
+        }
+
+        threads::thread_data* allocate_thread_object(
+            threads::thread_init_data& data, std::ptrdiff_t stacksize)
+        {
+            if (stacksize == parameters_.nostack_stacksize_)
+            {
+                return threads::thread_data_stackless::create(
+                    data, this, stacksize);
+            }
+            return threads::thread_data_stackful::create(data, this, stacksize);
+        }
+
+        // Rebind a recycled thread object, if available. This does not
+        // require for the queue mutex to be held.
+        bool create_recycled_thread_object(threads::thread_id_ref_type& thrd,
+            threads::thread_init_data& data, std::ptrdiff_t stacksize)
+        {
             if (data.initial_state ==
                     thread_schedule_state::pending_do_not_schedule ||
                 data.initial_state == thread_schedule_state::pending_boost)
@@ -169,31 +244,51 @@ namespace hpx { namespace threads { namespace policies {
 #if !defined(HPX_HAVE_ADDRESS_SANITIZER)
 
             // Check for an unused thread object.
-            if (!heap->empty())
+            if (threads::thread_data* p = get_recycled_thread_object(stacksize))
             {
                 // Take ownership of the thread object and rebind it.
-                thrd = heap->back();
-                heap->pop_back();
-                get_thread_id_data(thrd)->rebind(data);
+                thrd = thread_id_ref_type(p);
+                p->rebind(data);
+                return true;
             }
-            else
 #endif
+            return false;
+        }
+
+        // Create a new thread object (or reuse a recycled one) without
+        // holding the queue mutex.
+        void create_thread_object(
+            threads::thread_id_ref_type& thrd, threads::thread_init_data& data)
+        {
+            std::ptrdiff_t const stacksize =
+                data.scheduler_base->get_stack_size(data.stacksize);
+
+            if (!create_recycled_thread_object(thrd, data, stacksize))
+            {
+                // Allocate a new thread object.
+                thrd = thread_id_ref_type(
+                    allocate_thread_object(data, stacksize),
+                    thread_id_addref::no);
+            }
+        }
+
+        template <typename Lock>
+        void create_thread_object(threads::thread_id_ref_type& thrd,
+            threads::thread_init_data& data, Lock& lk)
+        {
+            HPX_ASSERT(lk.owns_lock());
+
+            std::ptrdiff_t const stacksize =
+                data.scheduler_base->get_stack_size(data.stacksize);
+
+            if (!create_recycled_thread_object(thrd, data, stacksize))
             {
                 hpx::util::unlock_guard<Lock> ull(lk);
 
                 // Allocate a new thread object.
-                threads::thread_data* p = nullptr;
-                if (stacksize == parameters_.nostack_stacksize_)
-                {
-                    p = threads::thread_data_stackless::create(
-                        data, this, stacksize);
-                }
-                else
-                {
-                    p = threads::thread_data_stackful::create(
-                        data, this, stacksize);
-                }
-                thrd = thread_id_ref_type(p, thread_id_addref::no);
+                thrd = thread_id_ref_type(
+                    allocate_thread_object(data, stacksize),
+                    thread_id_addref::no);
             }
         }
 
@@ -325,34 +420,45 @@ namespace hpx { namespace threads { namespace policies {
 
         void recycle_thread(thread_id_type thrd)
         {
-            std::ptrdiff_t stacksize =
-                get_thread_id_data(thrd)->get_stack_size();
+            threads::thread_data* p = get_thread_id_data(thrd);
+            std::ptrdiff_t stacksize = p->get_stack_size();
 
-            if (stacksize == parameters_.small_stacksize_)
-            {
-                thread_heap_small_.push_back(thrd);
-            }
-            else if (stacksize == parameters_.medium_stacksize_)
-            {
-                thread_heap_medium_.push_back(thrd);
-            }
-            else if (stacksize == parameters_.large_stacksize_)
+            thread_heap_overflow_pool::heap_index index;
+            thread_heap* heap = get_thread_heap(stacksize, index);
+            if (heap == nullptr)
             {
-                thread_heap_large_.push_back(thrd);
-            }
-            else if (stacksize == parameters_.huge_stacksize_)
-            {
-                thread_heap_huge_.push_back(thrd);
+                HPX_ASSERT_MSG(
+                    false, util::format("Invalid stack size {1}", stacksize));
+                deallocate(p);
+                return;
             }
-            else if (stacksize == parameters_.nostack_stacksize_)
+
+            // recycling of thread objects has been disabled
+            std::int64_t const max_count =
+                parameters_.max_recycled_thread_count_;
+            if (max_count == 0)
             {
-                thread_heap_nostack_.push_back(thrd);
+                deallocate(p);
+                return;
             }
-            else
+
             {
-                HPX_ASSERT_MSG(
-                    false, util::format("Invalid stack size {1}", stacksize));
+                std::unique_lock<mutex_type> lk = lock_thread_heaps();
+                if (heap->size() < max_count && heap->push(p))
+                {
+                    return;
+                }
+
+                // hand excess thread objects over to the global overflow
+                // pool
+                if (overflow_pool_.push(index, p, max_count))
+                {
+                    return;
+                }
             }
+
+            // free excess thread objects if the overflow pool is full as well
+            deallocate(p);
         }
 
     public:
@@ -468,6 +574,8 @@ namespace hpx { namespace threads { namespace policies {
           , thread_heap_large_()
           , thread_heap_huge_()
           , thread_heap_nostack_()
+          , thread_heap_reduced_()
+          , overflow_pool_(thread_heap_overflow_pool::get())
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
           , add_new_time_(0)
           , cleanup_terminated_time_(0)
@@ -483,6 +591,7 @@ namespace hpx { namespace threads { namespace policies {
         {
             new_tasks_count_.data_ = 0;
             work_items_count_.data_ = 0;
+            overflow_pool_.add_ref();
         }
 
         static void deallocate(threads::thread_data* p) noexcept
@@ -492,20 +601,14 @@ namespace hpx { namespace threads { namespace policies {
 
         ~thread_queue()
         {
-            for (auto t : thread_heap_small_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto t : thread_heap_medium_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto t : thread_heap_large_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto t : thread_heap_huge_)
-                deallocate(get_thread_id_data(t));
-
-            for (auto t : thread_heap_nostack_)
-                deallocate(get_thread_id_data(t));
+            thread_heap_small_.clear();
+            thread_heap_medium_.clear();
+            thread_heap_large_.clear();
+            thread_heap_huge_.clear();
+            thread_heap_nostack_.clear();
+            thread_heap_reduced_.clear();
+
+            overflow_pool_.release();
         }
 
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
@@ -666,17 +769,18 @@ namespace hpx { namespace threads { namespace policies {
             {
                 threads::thread_id_ref_type thrd;
 
+                bool schedule_now =
+                    data.initial_state == thread_schedule_state::pending;
+
                 // The mutex can not be locked while a new thread is getting
                 // created, as it might have that the current HPX thread gets
-                // suspended.
+                // suspended. Recycled thread objects are available without
+                // acquiring the mutex.
+                create_thread_object(thrd, data);
+
                 {
                     std::unique_lock<mutex_type> lk(mtx_);
 
-                    bool schedule_now =
-                        data.initial_state == thread_schedule_state::pending;
-
-                    create_thread_object(thrd, data, lk);
-
                     // add a new entry in the map for this thread
                     std::pair<thread_map_type::iterator, bool> p =
                         thread_map_.insert(thrd.noref());
@@ -697,30 +801,30 @@ namespace hpx { namespace threads { namespace policies {
                     HPX_ASSERT(
                         &get_thread_id_data(thrd)->get_queue<thread_queue>() ==
                         this);
+                }
 
-                    // push the new thread in the pending thread queue
-                    if (schedule_now)
-                    {
-                        // return the thread_id_ref of the newly created thread
-                        if (id)
-                        {
-                            *id = thrd;
-                        }
-                        schedule_thread(HPX_MOVE(thrd));
-                    }
-                    else
+                // push the new thread in the pending thread queue
+                if (schedule_now)
+                {
+                    // return the thread_id_ref of the newly created thread
+                    if (id)
                     {
-                        // if the thread should not be scheduled the id must be
-                        // returned to the caller as otherwise the thread would
-                        // go out of scope right away.
-                        HPX_ASSERT(id != nullptr);
-                        *id = HPX_MOVE(thrd);
+                        *id = thrd;
                     }
-
-                    if (&ec != &throws)
-                        ec = make_success_code();
-                    return;
+                    schedule_thread(HPX_MOVE(thrd));
                 }
+                else
+                {
+                    // if the thread should not be scheduled the id must be
+                    // returned to the caller as otherwise the thread would
+                    // go out of scope right away.
+                    HPX_ASSERT(id != nullptr);
+                    *id = HPX_MOVE(thrd);
+                }
+
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return;
             }
 
             // if the initial state is not pending, delayed creation will
@@ -749,6 +853,48 @@ namespace hpx { namespace threads { namespace policies {
                 ec = make_success_code();
         }
 
+        // register task descriptions for a batch of threads at once, all
+        // threads are created lazily
+        void create_thread_batch(
+            thread_init_data* data, std::size_t count, error_code& ec)
+        {
+            threads::thread_stacksize self_stacksize =
+                threads::thread_stacksize::current;
+
+            // the counter is updated only once for the whole batch, it is
+            // fine for it to run ahead of the queue
+            new_tasks_count_.data_ += count;
+
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                thread_init_data& d = data[i];
+
+                HPX_ASSERT(!d.run_now);
+                HPX_ASSERT(d.initial_state == thread_schedule_state::pending);
+
+                if (d.stacksize == threads::thread_stacksize::current)
+                {
+                    if (self_stacksize == threads::thread_stacksize::current)
+                    {
+                        self_stacksize = get_self_stacksize_enum();
+                    }
+                    d.stacksize = self_stacksize;
+                }
+
+                task_description* td = task_description_alloc_.allocate(1);
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                new (td) task_description{
+                    HPX_MOVE(d), hpx::chrono::high_resolution_clock::now()};
+#else
+                new (td) task_description{HPX_MOVE(d)};    //-V106
+#endif
+                new_tasks_.push(td);
+            }
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
         void move_work_items_from(thread_queue* src, std::int64_t count)
         {
             thread_description_ptr trd;
@@ -839,6 +985,8 @@ namespace hpx { namespace threads { namespace policies {
                 thrd = HPX_MOVE(tdesc->data);
                 delete tdesc;
 
+                threads::detail::record_queued_time(
+                    get_thread_id_data(thrd), steal);
                 return true;
             }
 #else
@@ -847,6 +995,8 @@ namespace hpx { namespace threads { namespace policies {
             {
                 thrd.reset(next_thrd, false);    // do not addref!
                 --work_items_count_.data_;
+                threads::detail::record_queued_time(
+                    get_thread_id_data(thrd), steal);
                 return true;
             }
 #endif
@@ -857,6 +1007,8 @@ namespace hpx { namespace threads { namespace policies {
         void schedule_thread(
             threads::thread_id_ref_type thrd, bool other_end = false)
         {
+            threads::detail::sample_queued_time_start(get_thread_id_data(thrd));
+
             ++work_items_count_.data_;
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
             work_items_.push(new thread_description{HPX_MOVE(thrd),
@@ -1117,10 +1269,17 @@ namespace hpx { namespace threads { namespace policies {
         ///////////////////////////////////////////////////////////////////////
         void on_start_thread(std::size_t /* num_thread */)
         {
+            // Pre-allocate the nodes of the heaps of all stack sizes, such
+            // that recycling a thread does not allocate memory regardless of
+            // its stack size. Only threads with the default stack size are
+            // created up front, though, as threads with other stack sizes
+            // would tie up memory which might never be used.
             thread_heap_small_.reserve(parameters_.init_threads_count_);
             thread_heap_medium_.reserve(parameters_.init_threads_count_);
             thread_heap_large_.reserve(parameters_.init_threads_count_);
             thread_heap_huge_.reserve(parameters_.init_threads_count_);
+            thread_heap_nostack_.reserve(parameters_.init_threads_count_);
+            thread_heap_reduced_.reserve(parameters_.init_threads_count_);
 
             // Pre-allocate init_threads_count threads, with accompanying stack,
             // with the default stack size
@@ -1131,7 +1290,6 @@ namespace hpx { namespace threads { namespace policies {
                 "fails you've most likely changed the default without changing "
                 "the code here.");
 
-            std::lock_guard<mutex_type> lk(mtx_);
             for (std::int64_t i = 0; i < parameters_.init_threads_count_; ++i)
             {
                 // We don't care about the init parameters since this thread
@@ -1149,7 +1307,10 @@ namespace hpx { namespace threads { namespace policies {
                 p->init();
 
                 // Finally, store the thread for later use
-                thread_heap_small_.emplace_back(p);
+                if (!thread_heap_small_.push(p))
+                {
+                    deallocate(p);
+                }
             }
         }
         void on_stop_thread(std::size_t /* num_thread */) {}
@@ -1190,11 +1351,19 @@ namespace hpx { namespace threads { namespace policies {
         std::atomic<std::int64_t> new_tasks_wait_count_;
 #endif
 
-        thread_heap_type thread_heap_small_;
-        thread_heap_type thread_heap_medium_;
-        thread_heap_type thread_heap_large_;
-        thread_heap_type thread_heap_huge_;
-        thread_heap_type thread_heap_nostack_;
+        // lock-free heaps of recycled thread objects, one per stack size
+        thread_heap thread_heap_small_;
+        thread_heap thread_heap_medium_;
+        thread_heap thread_heap_large_;
+        thread_heap thread_heap_huge_;
+        thread_heap thread_heap_nostack_;
+        thread_heap thread_heap_reduced_;
+
+        // global pool receiving the thread objects which overflow the heaps
+        thread_heap_overflow_pool& overflow_pool_;
+
+        // protects the heaps only if lock-free recycling is disabled
+        mutable mutex_type thread_heap_mtx_;
 
 #ifdef HPX_HAVE_THREAD_CREATION_AND_CLEANUP_RATES
         std::uint64_t add_new_time_;
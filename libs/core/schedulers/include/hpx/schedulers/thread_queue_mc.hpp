@@ -20,6 +20,7 @@
 #include <hpx/schedulers/queue_holder_thread.hpp>
 #include <hpx/schedulers/thread_queue.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/threading_base/detail/wait_time_samples.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
 #include <hpx/timing/high_resolution_clock.hpp>
@@ -277,6 +278,8 @@ namespace hpx { namespace threads { namespace policies {
                     debug::dec<4>(new_tasks_count_.data_), "w",
                     debug::dec<4>(work_items_count_.data_),
                     debug::threadinfo<threads::thread_id_ref_type*>(&thrd));
+                threads::detail::record_queued_time(
+                    get_thread_id_data(thrd), other_end);
                 return true;
             }
             if (check_new && add_new(32, this, false) > 0)
@@ -291,6 +294,8 @@ namespace hpx { namespace threads { namespace policies {
         /// Schedule the passed thread (put it on the ready work queue)
         void schedule_work(threads::thread_id_ref_type thrd, bool other_end)
         {
+            threads::detail::sample_queued_time_start(get_thread_id_data(thrd));
+
             ++work_items_count_.data_;
             tqmc_deb.debug(debug::str<>("schedule_work"), "stealing", other_end,
                 "D", debug::dec<2>(holder_->domain_index_), "Q",
@@ -0,0 +1,17 @@
+//  Copyright (c) 2007-2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/schedulers/thread_heap.hpp>
+
+namespace hpx { namespace threads { namespace policies {
+
+    thread_heap_overflow_pool& thread_heap_overflow_pool::get() noexcept
+    {
+        static thread_heap_overflow_pool pool;
+        return pool;
+    }
+}}}    // namespace hpx::threads::policies
@@ -0,0 +1,86 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies the starvation protection of the per-worker LIFO slot.
+// Two threads keep readying each other, which places each of them into the
+// LIFO slot of the worker thread in turn. A task queued behind them must
+// nevertheless run long before the chain runs out of iterations.
+
+#include <hpx/local/condition_variable.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/mutex.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+constexpr std::size_t max_iterations = 100000;
+
+void test_lifo_slot_starvation()
+{
+    hpx::mutex mtx;
+    hpx::condition_variable cond;
+    int turn = 0;
+    std::size_t iterations = 0;
+    bool queued_task_ran = false;
+    std::size_t iterations_before_queued_task = max_iterations;
+
+    auto continuation_chain = [&](int self) {
+        std::unique_lock<hpx::mutex> l(mtx);
+        while (!queued_task_ran && iterations != max_iterations)
+        {
+            if (turn == self)
+            {
+                // make the other thread ready, this places it into the LIFO
+                // slot of the current worker thread
+                turn = 1 - self;
+                ++iterations;
+                cond.notify_all();
+            }
+            cond.wait(l);
+        }
+        cond.notify_all();
+    };
+
+    hpx::future<void> f1 = hpx::async(continuation_chain, 0);
+    hpx::future<void> f2 = hpx::async(continuation_chain, 1);
+
+    hpx::future<void> f3 = hpx::async([&]() {
+        std::lock_guard<hpx::mutex> l(mtx);
+        queued_task_ran = true;
+        iterations_before_queued_task = iterations;
+        cond.notify_all();
+    });
+
+    hpx::wait_all(f1, f2, f3);
+
+    HPX_TEST(queued_task_ran);
+    HPX_TEST_LT(iterations_before_queued_task, max_iterations);
+}
+
+int hpx_main()
+{
+    test_lifo_slot_starvation();
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const max_lifo_slot_runs = {"0", "1", "3"};
+    for (auto const& max_runs : max_lifo_slot_runs)
+    {
+        hpx::local::init_params init_args;
+        init_args.cfg = {"hpx.os_threads=1",
+            "hpx.thread_queue.max_lifo_slot_runs=" + max_runs};
+
+        HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    }
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,166 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/synchronization/adaptive_mutex.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/lock_registration/detail/register_locks.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace hpx::experimental {
+
+    /// Contention statistics of a single \a adaptive_mutex.
+    struct adaptive_mutex_statistics
+    {
+        // number of times the mutex was acquired
+        std::atomic<std::int64_t> acquisitions{0};
+
+        // number of times the mutex was held by another thread when a thread
+        // tried to acquire it
+        std::atomic<std::int64_t> contended{0};
+
+        // accumulated time spent spinning on the mutex [ns]
+        std::atomic<std::int64_t> spin_time{0};
+
+        // number of times a thread was suspended waiting for the mutex
+        std::atomic<std::int64_t> suspensions{0};
+    };
+
+    /// A mutex which spins for a while before suspending the calling HPX
+    /// thread if the mutex is held by another thread. The spinning time is
+    /// proportional to the average time the mutex was held so far (an
+    /// exponentially weighted moving average over a sample of the
+    /// acquisitions), threads waiting for a mutex that is typically held for
+    /// a long time are suspended right away.
+    ///
+    /// All adaptive mutexes collect contention statistics which are exposed
+    /// through the /locks performance counters.
+    class adaptive_mutex
+    {
+    public:
+        HPX_CORE_EXPORT explicit adaptive_mutex(
+            char const* const description = "");
+
+        adaptive_mutex(adaptive_mutex const&) = delete;
+        adaptive_mutex(adaptive_mutex&&) = delete;
+        adaptive_mutex& operator=(adaptive_mutex const&) = delete;
+        adaptive_mutex& operator=(adaptive_mutex&&) = delete;
+
+        HPX_CORE_EXPORT ~adaptive_mutex();
+
+        void lock()
+        {
+            int expected = unlocked;
+            if (!state_.compare_exchange_strong(
+                    expected, locked, std::memory_order_acquire))
+            {
+                lock_contended();
+            }
+            acquired();
+            util::register_lock(this);
+        }
+
+        bool try_lock() noexcept(
+            noexcept(util::register_lock(std::declval<adaptive_mutex*>())))
+        {
+            int expected = unlocked;
+            if (!state_.compare_exchange_strong(
+                    expected, locked, std::memory_order_acquire))
+            {
+                return false;
+            }
+            acquired();
+            util::register_lock(this);
+            return true;
+        }
+
+        void unlock() noexcept(
+            noexcept(util::unregister_lock(std::declval<adaptive_mutex*>())))
+        {
+            util::unregister_lock(this);
+            released();
+            if (state_.exchange(unlocked, std::memory_order_release) ==
+                locked_with_waiters)
+            {
+                notify_waiter();
+            }
+        }
+
+        /// Return the current estimate of the time this mutex is held [ns]
+        std::int64_t average_hold_time() const noexcept
+        {
+            return average_hold_time_.load(std::memory_order_relaxed);
+        }
+
+        /// Return the contention statistics collected for this mutex
+        adaptive_mutex_statistics const& statistics() const noexcept
+        {
+            return statistics_;
+        }
+
+    private:
+        friend struct adaptive_mutex_registry;
+
+        // Measure the hold time for every n-th acquisition only, reading the
+        // clock is not free.
+        static constexpr std::int64_t hold_time_sample_rate = 8;
+
+        void acquired() noexcept
+        {
+            std::int64_t const count = statistics_.acquisitions.fetch_add(
+                1, std::memory_order_relaxed);
+            acquired_at_ = count % hold_time_sample_rate == 0 ?
+                static_cast<std::int64_t>(
+                    hpx::chrono::high_resolution_clock::now()) :
+                0;
+        }
+
+        void released() noexcept
+        {
+            if (acquired_at_ != 0)
+            {
+                auto const released_at = static_cast<std::int64_t>(
+                    hpx::chrono::high_resolution_clock::now());
+                update_hold_time(released_at - acquired_at_);
+            }
+        }
+
+        HPX_CORE_EXPORT void lock_contended();
+        HPX_CORE_EXPORT void notify_waiter() noexcept;
+        HPX_CORE_EXPORT void update_hold_time(std::int64_t hold_time) noexcept;
+
+        static constexpr int unlocked = 0;
+        static constexpr int locked = 1;
+        static constexpr int locked_with_waiters = 2;
+
+        std::atomic<int> state_{unlocked};
+
+        // written by the owner of the mutex only
+        std::atomic<std::int64_t> average_hold_time_{0};
+        std::int64_t acquired_at_ = 0;
+
+        adaptive_mutex_statistics statistics_;
+
+        // all adaptive mutexes are linked to allow collecting statistics
+        adaptive_mutex* prev_ = nullptr;
+        adaptive_mutex* next_ = nullptr;
+    };
+}    // namespace hpx::experimental
+
+namespace hpx::lcos::local::detail {
+
+    // Performance counter data, accumulated over all adaptive mutexes
+    HPX_CORE_EXPORT std::int64_t get_adaptive_mutex_acquisitions(bool reset);
+    HPX_CORE_EXPORT std::int64_t get_adaptive_mutex_contended(bool reset);
+    HPX_CORE_EXPORT std::int64_t get_adaptive_mutex_spin_time(bool reset);
+    HPX_CORE_EXPORT std::int64_t get_adaptive_mutex_suspensions(bool reset);
+}    // namespace hpx::lcos::local::detail
@@ -0,0 +1,76 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/synchronization/atomic_wait.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/synchronization/detail/parking_lot.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <atomic>
+
+namespace hpx::experimental {
+
+    /// Blocks the calling thread until the value of \a a is different from
+    /// \a old and the thread was notified by \a atomic_notify_one or
+    /// \a atomic_notify_all, or the thread was unblocked spuriously. Returns
+    /// immediately if the value of \a a is different from \a old.
+    ///
+    /// Unlike std::atomic<T>::wait, this suspends HPX threads instead of
+    /// blocking the underlying operating system thread. The waiting threads
+    /// are held in a global table keyed by the address of \a a, the atomic
+    /// object itself does not carry any additional state.
+    template <typename T>
+    void atomic_wait(std::atomic<T> const& a, T old,
+        std::memory_order order = std::memory_order_seq_cst)
+    {
+        while (a.load(order) == old)
+        {
+            hpx::lcos::local::detail::park(
+                &a,
+                [&]() { return a.load(std::memory_order_relaxed) == old; },
+                "hpx::experimental::atomic_wait");
+        }
+    }
+
+    /// Same as \a atomic_wait, but returns false if \a abs_time was reached
+    /// while the value of \a a was still equal to \a old.
+    template <typename T>
+    bool atomic_wait_until(std::atomic<T> const& a, T old,
+        hpx::chrono::steady_time_point const& abs_time,
+        std::memory_order order = std::memory_order_seq_cst)
+    {
+        while (a.load(order) == old)
+        {
+            if (!hpx::lcos::local::detail::park_until(
+                    &a,
+                    [&]() { return a.load(std::memory_order_relaxed) == old; },
+                    abs_time, "hpx::experimental::atomic_wait_until"))
+            {
+                return a.load(order) != old;
+            }
+        }
+        return true;
+    }
+
+    /// Unblocks at least one thread blocked in \a atomic_wait on \a a, if
+    /// any. This is a single atomic load if no thread is waiting.
+    template <typename T>
+    void atomic_notify_one(std::atomic<T> const& a)
+    {
+        hpx::lcos::local::detail::unpark_one(&a);
+    }
+
+    /// Unblocks all threads blocked in \a atomic_wait on \a a. This is a
+    /// single atomic load if no thread is waiting.
+    template <typename T>
+    void atomic_notify_all(std::atomic<T> const& a)
+    {
+        hpx::lcos::local::detail::unpark_all(&a);
+    }
+}    // namespace hpx::experimental
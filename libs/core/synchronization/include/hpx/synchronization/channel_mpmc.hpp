@@ -13,9 +13,12 @@
 #include <hpx/modules/concurrency.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/thread_support.hpp>
+#include <hpx/synchronization/eventcount.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <utility>
@@ -204,6 +207,261 @@ namespace hpx { namespace lcos { namespace local {
         bool closed_;
     };
 
+    ////////////////////////////////////////////////////////////////////////////
+    // A lock-free implementation of a bounded channel supporting multiple
+    // producers and multiple consumers. The data is stored in a ring-buffer
+    // where each slot carries a sequence number that tells producers and
+    // consumers whether the slot may be written or read (see Dmitry Vyukov's
+    // bounded MPMC queue). Producers and consumers contend only on the
+    // respective position counters, not on a lock.
+    //
+    // In addition to the non-blocking get and set operations, this channel
+    // provides wait_get and wait_set, which suspend the calling HPX thread
+    // while the channel is empty or full.
+    template <typename T>
+    class bounded_lockfree_channel
+    {
+    private:
+        struct cell
+        {
+            std::atomic<std::size_t> sequence_;
+            T data_;
+        };
+
+        static std::size_t buffer_size(std::size_t size) noexcept
+        {
+            // the size of the buffer has to be a power of two
+            std::size_t result = 1;
+            while (result < size)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+    public:
+        // The capacity of the channel is the given size rounded up to the
+        // next power of two.
+        explicit bounded_lockfree_channel(std::size_t size)
+          : mask_(buffer_size(size) - 1)
+          , buffer_(new cell[mask_ + 1])
+          , closed_(false)
+        {
+            HPX_ASSERT(size != 0);
+
+            for (std::size_t i = 0; i != mask_ + 1; ++i)
+            {
+                buffer_[i].sequence_.store(i, std::memory_order_relaxed);
+            }
+
+            head_.data_.store(0, std::memory_order_relaxed);
+            tail_.data_.store(0, std::memory_order_relaxed);
+        }
+
+        bounded_lockfree_channel(bounded_lockfree_channel const&) = delete;
+        bounded_lockfree_channel(bounded_lockfree_channel&&) = delete;
+        bounded_lockfree_channel& operator=(
+            bounded_lockfree_channel const&) = delete;
+        bounded_lockfree_channel& operator=(
+            bounded_lockfree_channel&&) = delete;
+
+        ~bounded_lockfree_channel()
+        {
+            if (!closed_.load(std::memory_order_relaxed))
+            {
+                close();
+            }
+        }
+
+        // Retrieve the next value from the channel. Returns false if the
+        // channel is empty or was closed. If val is nullptr, this only checks
+        // whether a value is available.
+        bool get(T* val = nullptr) const
+        {
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            std::size_t pos = head_.data_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                cell& c = buffer_[pos & mask_];
+                std::size_t const seq =
+                    c.sequence_.load(std::memory_order_acquire);
+                std::intptr_t const diff = static_cast<std::intptr_t>(seq) -
+                    static_cast<std::intptr_t>(pos + 1);
+
+                if (diff == 0)
+                {
+                    if (val == nullptr)
+                    {
+                        return true;
+                    }
+
+                    if (head_.data_.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        *val = HPX_MOVE(c.data_);
+                        c.sequence_.store(
+                            pos + mask_ + 1, std::memory_order_release);
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;    // the channel is empty
+                }
+                else
+                {
+                    pos = head_.data_.load(std::memory_order_relaxed);
+                }
+            }
+
+            not_full_.notify_one();
+            return true;
+        }
+
+        // Store a value in the channel. Returns false if the channel is full
+        // or was closed.
+        bool set(T&& t)
+        {
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            std::size_t pos = tail_.data_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                cell& c = buffer_[pos & mask_];
+                std::size_t const seq =
+                    c.sequence_.load(std::memory_order_acquire);
+                std::intptr_t const diff = static_cast<std::intptr_t>(seq) -
+                    static_cast<std::intptr_t>(pos);
+
+                if (diff == 0)
+                {
+                    if (tail_.data_.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        c.data_ = HPX_MOVE(t);
+                        c.sequence_.store(pos + 1, std::memory_order_release);
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;    // the channel is full
+                }
+                else
+                {
+                    pos = tail_.data_.load(std::memory_order_relaxed);
+                }
+            }
+
+            not_empty_.notify_one();
+            return true;
+        }
+
+        // Retrieve the next value from the channel, suspending the calling
+        // thread while the channel is empty. Returns false if the channel was
+        // closed.
+        bool wait_get(T* val) const
+        {
+            HPX_ASSERT(val != nullptr);
+            while (!get(val))
+            {
+                if (closed_.load(std::memory_order_relaxed))
+                {
+                    return false;
+                }
+
+                // prepare_wait() orders the registration of this thread as a
+                // waiter before re-checking the channel, thus either the
+                // producer sees the waiter or we see the new value
+                auto const key = not_empty_.prepare_wait();
+                if (get(val))
+                {
+                    not_empty_.cancel_wait();
+                    break;
+                }
+                if (closed_.load(std::memory_order_relaxed))
+                {
+                    not_empty_.cancel_wait();
+                    return false;
+                }
+                not_empty_.wait(key, "bounded_lockfree_channel::wait_get");
+            }
+            return true;
+        }
+
+        // Store a value in the channel, suspending the calling thread while
+        // the channel is full. Returns false if the channel was closed.
+        bool wait_set(T&& t)
+        {
+            while (!set(HPX_MOVE(t)))
+            {
+                if (closed_.load(std::memory_order_relaxed))
+                {
+                    return false;
+                }
+
+                auto const key = not_full_.prepare_wait();
+                if (set(HPX_MOVE(t)))
+                {
+                    not_full_.cancel_wait();
+                    break;
+                }
+                if (closed_.load(std::memory_order_relaxed))
+                {
+                    not_full_.cancel_wait();
+                    return false;
+                }
+                not_full_.wait(key, "bounded_lockfree_channel::wait_set");
+            }
+            return true;
+        }
+
+        std::size_t close()
+        {
+            bool expected = false;
+            if (!closed_.compare_exchange_strong(expected, true))
+            {
+                HPX_THROW_EXCEPTION(hpx::invalid_status,
+                    "hpx::lcos::local::bounded_lockfree_channel::close",
+                    "attempting to close an already closed channel");
+            }
+
+            // release all threads waiting for the channel
+            not_empty_.notify_all();
+            not_full_.notify_all();
+            return 0;
+        }
+
+        std::size_t capacity() const noexcept
+        {
+            return mask_ + 1;
+        }
+
+    private:
+        // keep the head and the tail position in separate cache lines
+        mutable hpx::util::cache_aligned_data<std::atomic<std::size_t>> head_;
+        hpx::util::cache_aligned_data<std::atomic<std::size_t>> tail_;
+
+        std::size_t mask_;
+
+        // channel buffer
+        std::unique_ptr<cell[]> buffer_;
+
+        // this channel was closed, i.e. no further operations are possible
+        std::atomic<bool> closed_;
+
+        // threads waiting for the channel to become non-empty or non-full
+        mutable hpx::experimental::eventcount not_empty_;
+        mutable hpx::experimental::eventcount not_full_;
+    };
+
     ////////////////////////////////////////////////////////////////////////////
     // For use with HPX threads, the channel_mpmc defined here is the fastest
     // (even faster than the channel_spsc). Using hpx::util::spinlock as the
@@ -213,4 +471,9 @@ namespace hpx { namespace lcos { namespace local {
     template <typename T>
     using channel_mpmc = bounded_channel<T, hpx::spinlock>;
 
+    // The lock-free channel scales better than channel_mpmc if many producers
+    // or consumers access the channel concurrently.
+    template <typename T>
+    using channel_mpmc_lockfree = bounded_lockfree_channel<T>;
+
 }}}    // namespace hpx::lcos::local
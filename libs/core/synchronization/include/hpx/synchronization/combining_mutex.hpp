@@ -0,0 +1,257 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/synchronization/combining_mutex.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/functional/function_ref.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/synchronization/atomic_wait.hpp>
+#include <hpx/synchronization/detail/parking_lot.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::experimental {
+
+    /// A flat combining lock. Instead of acquiring the lock and executing the
+    /// critical section itself, a thread publishes the critical section as
+    /// an operation and suspends. Whichever thread holds the lock (the
+    /// combiner) executes all published operations in a batch before
+    /// releasing it. The data protected by the lock stays in the cache of
+    /// the combiner instead of moving between cores with each acquisition.
+    ///
+    /// Operations executed by the combiner run on the combiner's HPX thread,
+    /// they should be short and should not suspend. Exceptions thrown by an
+    /// operation are rethrown in the thread that published it.
+    class combining_mutex
+    {
+    private:
+        enum class request_state
+        {
+            pending,
+            done,
+            combine    // the lock was handed over to the publishing thread
+        };
+
+        // An operation published by a waiting thread, lives on the stack of
+        // the publishing thread until its state is changed.
+        struct request
+        {
+            explicit request(hpx::function_ref<void()> op) noexcept
+              : op_(op)
+            {
+            }
+
+            void invoke() noexcept
+            {
+                try
+                {
+                    op_();
+                }
+                catch (...)
+                {
+                    exception_ = std::current_exception();
+                }
+            }
+
+            hpx::function_ref<void()> op_;
+            std::exception_ptr exception_;
+            request* next_ = nullptr;
+            std::atomic<request_state> state_{request_state::pending};
+        };
+
+    public:
+        /// Construct a combining lock. A combiner hands the lock over to
+        /// one of the waiting threads after \a max_passes passes over the
+        /// list of published operations to bound the time it spends
+        /// executing operations of other threads.
+        explicit combining_mutex(std::size_t max_passes = 16) noexcept
+          : max_passes_(max_passes != 0 ? max_passes : 1)
+        {
+        }
+
+        combining_mutex(combining_mutex const&) = delete;
+        combining_mutex(combining_mutex&&) = delete;
+        combining_mutex& operator=(combining_mutex const&) = delete;
+        combining_mutex& operator=(combining_mutex&&) = delete;
+
+        ~combining_mutex()
+        {
+            HPX_ASSERT(head_.load(std::memory_order_relaxed) == nullptr);
+            HPX_ASSERT(pending_ == nullptr);
+            HPX_ASSERT(!locked_.load(std::memory_order_relaxed));
+        }
+
+        /// Invoke \a f with exclusive access to the data protected by this
+        /// lock and return its result. \a f is invoked either by the calling
+        /// thread or by the thread currently holding the lock.
+        template <typename F>
+        hpx::util::invoke_result_t<F> execute(F&& f)
+        {
+            using result_type = hpx::util::invoke_result_t<F>;
+            if constexpr (std::is_void_v<result_type>)
+            {
+                execute_impl([&]() { HPX_INVOKE(f); });
+            }
+            else
+            {
+                hpx::optional<result_type> result;
+                execute_impl([&]() { result.emplace(HPX_INVOKE(f)); });
+                return HPX_MOVE(*result);
+            }
+        }
+
+    private:
+        void execute_impl(hpx::function_ref<void()> op)
+        {
+            request r(op);
+
+            // publish the operation
+            request* head = head_.load(std::memory_order_relaxed);
+            do
+            {
+                r.next_ = head;
+            } while (!head_.compare_exchange_weak(
+                head, &r, std::memory_order_seq_cst));
+
+            for (;;)
+            {
+                request_state const state =
+                    r.state_.load(std::memory_order_acquire);
+                if (state == request_state::done)
+                {
+                    break;
+                }
+
+                if (state == request_state::combine)
+                {
+                    // the previous combiner has removed the request from the
+                    // list and passed the lock on to this thread
+                    r.invoke();
+                    combine();
+                    unlock();
+                    break;
+                }
+
+                if (try_lock())
+                {
+                    combine();
+                    unlock();
+                }
+                else
+                {
+                    // the current combiner (or the next one) will execute the
+                    // operation or hand over the lock, see unlock
+                    hpx::experimental::atomic_wait(r.state_,
+                        request_state::pending, std::memory_order_acquire);
+                }
+            }
+
+            if (r.exception_)
+            {
+                std::rethrow_exception(HPX_MOVE(r.exception_));
+            }
+        }
+
+        bool try_lock() noexcept
+        {
+            return !locked_.load(std::memory_order_relaxed) &&
+                !locked_.exchange(true, std::memory_order_seq_cst);
+        }
+
+        void unlock() noexcept
+        {
+            for (;;)
+            {
+                HPX_ASSERT(pending_ == nullptr);
+
+                // hand the lock over to a thread that has published an
+                // operation the combiner did not get to
+                request* list =
+                    head_.exchange(nullptr, std::memory_order_acquire);
+                if (list != nullptr)
+                {
+                    pending_ = list->next_;
+                    notify(list, request_state::combine);
+                    return;
+                }
+
+                locked_.store(false, std::memory_order_seq_cst);
+
+                // An operation published after the exchange above whose
+                // publisher failed to acquire the lock would otherwise never
+                // be executed.
+                if (head_.load(std::memory_order_seq_cst) == nullptr ||
+                    !try_lock())
+                {
+                    return;
+                }
+            }
+        }
+
+        void combine() noexcept
+        {
+            for (std::size_t pass = 0; pass != max_passes_; ++pass)
+            {
+                request* list = pending_;
+                pending_ = nullptr;
+                if (list == nullptr)
+                {
+                    list = head_.exchange(nullptr, std::memory_order_acquire);
+                    if (list == nullptr)
+                    {
+                        return;
+                    }
+                }
+
+                // the list is in reverse order of publication
+                request* prev = nullptr;
+                while (list != nullptr)
+                {
+                    request* next = list->next_;
+                    list->next_ = prev;
+                    prev = list;
+                    list = next;
+                }
+
+                while (prev != nullptr)
+                {
+                    request* next = prev->next_;
+                    prev->invoke();
+                    notify(prev, request_state::done);
+                    prev = next;
+                }
+            }
+        }
+
+        static void notify(request* r, request_state state) noexcept
+        {
+            // The request may go out of scope as soon as its state has
+            // changed. The parking lot uses the address only as a key, it is
+            // safe to notify after the request was destroyed.
+            void const* addr = &r->state_;
+            r->state_.store(state, std::memory_order_release);
+            hpx::lcos::local::detail::unpark_one(addr);
+        }
+
+        std::size_t const max_passes_;
+        std::atomic<request*> head_{nullptr};
+        std::atomic<bool> locked_{false};
+
+        // requests taken from head_ by the previous combiner, protected by
+        // the lock
+        request* pending_ = nullptr;
+    };
+}    // namespace hpx::experimental
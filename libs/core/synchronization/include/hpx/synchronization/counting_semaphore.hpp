@@ -8,10 +8,13 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/synchronization/atomic_wait.hpp>
 #include <hpx/synchronization/detail/counting_semaphore.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <mutex>
@@ -57,8 +60,15 @@ namespace hpx {
     // releases the semaphore. If a thread tries to acquire the semaphore when
     // the counter is zero, the thread will block until another thread
     // increments the counter by releasing the semaphore.
+    //
+    // The semaphore consists of the counter only. Threads blocked on the
+    // semaphore are suspended in the global parking lot (see
+    // hpx::experimental::atomic_wait), releasing the semaphore without any
+    // waiting threads is a single atomic operation.
     namespace detail {
 
+        // The Mutex template parameter is not used anymore, it is kept for
+        // compatibility only.
         template <std::ptrdiff_t LeastMaxValue = PTRDIFF_MAX,
             typename Mutex = hpx::spinlock>
         class counting_semaphore
@@ -69,9 +79,6 @@ namespace hpx {
             counting_semaphore(counting_semaphore&&) = delete;
             counting_semaphore& operator=(counting_semaphore&&) = delete;
 
-        protected:
-            using mutex_type = Mutex;
-
         public:
             // Returns The maximum value of counter. This value is greater than or
             // equal to LeastMaxValue.
@@ -93,7 +100,7 @@ namespace hpx {
             //  Effects         Initializes counter with desired.
             //  Throws          Nothing.
             explicit counting_semaphore(std::ptrdiff_t value)
-              : sem_(value)
+              : counter_(value)
             {
             }
 
@@ -112,8 +119,17 @@ namespace hpx {
             //                  types ([thread.mutex.requirements.mutex]).
             void release(std::ptrdiff_t update = 1)
             {
-                std::unique_lock<mutex_type> l(mtx_);
-                sem_.signal(HPX_MOVE(l), update);
+                HPX_ASSERT(update >= 0);
+
+                counter_.fetch_add(update, std::memory_order_release);
+                if (update == 1)
+                {
+                    hpx::experimental::atomic_notify_one(counter_);
+                }
+                else if (update != 0)
+                {
+                    hpx::experimental::atomic_notify_all(counter_);
+                }
             }
 
             // Effects:         Attempts to atomically decrement counter if it is
@@ -130,8 +146,8 @@ namespace hpx {
             // Returns:         true if counter was decremented, otherwise false.
             bool try_acquire() noexcept
             {
-                std::unique_lock<mutex_type> l(mtx_);
-                return sem_.try_acquire(l);
+                std::ptrdiff_t value = counter_.load(std::memory_order_relaxed);
+                return try_acquire(value);
             }
 
             // Effects:         Repeatedly performs the following steps, in order:
@@ -145,8 +161,13 @@ namespace hpx {
             //                  types ([thread.mutex.requirements.mutex]).
             void acquire()
             {
-                std::unique_lock<mutex_type> l(mtx_);
-                sem_.wait(l, 1);
+                std::ptrdiff_t value = counter_.load(std::memory_order_relaxed);
+                while (!try_acquire(value))
+                {
+                    hpx::experimental::atomic_wait(
+                        counter_, value, std::memory_order_relaxed);
+                    value = counter_.load(std::memory_order_relaxed);
+                }
             }
 
             // Effects:         Repeatedly performs the following steps, in order:
@@ -168,8 +189,18 @@ namespace hpx {
             bool try_acquire_until(
                 hpx::chrono::steady_time_point const& abs_time)
             {
-                std::unique_lock<mutex_type> l(mtx_);
-                return sem_.wait_until(l, abs_time, 1);
+                std::ptrdiff_t value = counter_.load(std::memory_order_relaxed);
+                while (!try_acquire(value))
+                {
+                    if (!hpx::experimental::atomic_wait_until(counter_, value,
+                            abs_time, std::memory_order_relaxed))
+                    {
+                        // unblocked by the timeout expiring
+                        return false;
+                    }
+                    value = counter_.load(std::memory_order_relaxed);
+                }
+                return true;
             }
 
             bool try_acquire_for(hpx::chrono::steady_duration const& rel_time)
@@ -177,9 +208,24 @@ namespace hpx {
                 return try_acquire_until(rel_time.from_now());
             }
 
-        protected:
-            mutable mutex_type mtx_;
-            hpx::lcos::local::detail::counting_semaphore sem_;
+        private:
+            // Decrement the counter if it is positive, value is updated with
+            // the current value of the counter on failure.
+            bool try_acquire(std::ptrdiff_t& value) noexcept
+            {
+                while (value > 0)
+                {
+                    if (counter_.compare_exchange_weak(value, value - 1,
+                            std::memory_order_acquire,
+                            std::memory_order_relaxed))
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            std::atomic<std::ptrdiff_t> counter_;
         };
     }    // namespace detail
 
@@ -214,7 +260,6 @@ namespace hpx {
     ///////////////////////////////////////////////////////////////////////////
     template <typename Mutex = hpx::spinlock, int N = 0>
     class counting_semaphore_var
-      : detail::counting_semaphore<PTRDIFF_MAX, Mutex>
     {
     private:
         using mutex_type = Mutex;
@@ -233,7 +278,7 @@ namespace hpx {
         //  Effects         Initializes counter with desired.
         //  Throws          Nothing.
         explicit counting_semaphore_var(std::ptrdiff_t value = N)
-          : detail::counting_semaphore<PTRDIFF_MAX, Mutex>(value)
+          : sem_(value)
         {
         }
 
@@ -249,8 +294,8 @@ namespace hpx {
         //                 yielded.
         void wait(std::ptrdiff_t count = 1)
         {
-            std::unique_lock<mutex_type> l(this->mtx_);
-            this->sem_.wait(l, count);
+            std::unique_lock<mutex_type> l(mtx_);
+            sem_.wait(l, count);
         }
 
         // \brief Try to wait for the semaphore to be signaled
@@ -266,22 +311,26 @@ namespace hpx {
         //                 are available at this point in time.
         bool try_wait(std::ptrdiff_t count = 1)
         {
-            std::unique_lock<mutex_type> l(this->mtx_);
-            return this->sem_.try_wait(l, count);
+            std::unique_lock<mutex_type> l(mtx_);
+            return sem_.try_wait(l, count);
         }
 
         /// \brief Signal the semaphore
         void signal(std::ptrdiff_t count = 1)
         {
-            std::unique_lock<mutex_type> l(this->mtx_);
-            this->sem_.signal(HPX_MOVE(l), count);
+            std::unique_lock<mutex_type> l(mtx_);
+            sem_.signal(HPX_MOVE(l), count);
         }
 
         std::ptrdiff_t signal_all()
         {
-            std::unique_lock<mutex_type> l(this->mtx_);
-            return this->sem_.signal_all(HPX_MOVE(l));
+            std::unique_lock<mutex_type> l(mtx_);
+            return sem_.signal_all(HPX_MOVE(l));
         }
+
+    private:
+        mutable mutex_type mtx_;
+        hpx::lcos::local::detail::counting_semaphore sem_;
     };
 }    // namespace hpx
 
@@ -0,0 +1,45 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/function_ref.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace lcos { namespace local { namespace detail {
+
+    // The parking lot is a global hash table of wait queues keyed by the
+    // address of the object the threads are waiting on. This allows to
+    // suspend HPX threads waiting on arbitrary memory locations without
+    // embedding a wait queue (and a lock protecting it) into every
+    // synchronization object.
+
+    // Suspend the calling thread on the given address if should_park returns
+    // true. The predicate is evaluated while the wait queue for the address
+    // is locked, a notification for the address issued after a change that
+    // makes the predicate return false is guaranteed to be observed.
+    HPX_CORE_EXPORT void park(void const* addr,
+        hpx::function_ref<bool()> should_park,
+        char const* description = "hpx::lcos::local::detail::park");
+
+    // Same as park, but returns false if the thread was woken up because
+    // abs_time was reached.
+    HPX_CORE_EXPORT bool park_until(void const* addr,
+        hpx::function_ref<bool()> should_park,
+        hpx::chrono::steady_time_point const& abs_time,
+        char const* description = "hpx::lcos::local::detail::park_until");
+
+    // Resume one (or all) of the threads parked on the given address. This
+    // is a single atomic load if no threads are parked on any address that
+    // maps onto the same wait queue.
+    HPX_CORE_EXPORT void unpark_one(void const* addr);
+    HPX_CORE_EXPORT void unpark_all(void const* addr);
+
+    // Forcefully abort all threads parked on the given address.
+    HPX_CORE_EXPORT void abort_all_parked(void const* addr);
+}}}}    // namespace hpx::lcos::local::detail
@@ -8,13 +8,9 @@
 #pragma once
 
 #include <hpx/config.hpp>
-#include <hpx/assert.hpp>
-#include <hpx/synchronization/condition_variable.hpp>
-#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/synchronization/atomic_wait.hpp>
 
 #include <atomic>
-#include <mutex>
-#include <utility>
 
 ////////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace lcos { namespace local {
@@ -23,15 +19,10 @@ namespace hpx { namespace lcos { namespace local {
     /// waiting for the event are woken up.
     class event
     {
-    private:
-        typedef hpx::spinlock mutex_type;
-
     public:
         /// \brief Construct a new event semaphore
         event()
-          : mtx_()
-          , cond_()
-          , event_(false)
+          : event_(false)
         {
         }
 
@@ -44,20 +35,18 @@ namespace hpx { namespace lcos { namespace local {
         /// \brief Wait for the event to occur.
         void wait()
         {
-            if (event_.load(std::memory_order_acquire))
-                return;
-
-            std::unique_lock<mutex_type> l(mtx_);
-            wait_locked(l);
+            while (!event_.load(std::memory_order_acquire))
+            {
+                hpx::experimental::atomic_wait(
+                    event_, false, std::memory_order_acquire);
+            }
         }
 
         /// \brief Release all threads waiting on this semaphore.
         void set()
         {
             event_.store(true, std::memory_order_release);
-
-            std::unique_lock<mutex_type> l(mtx_);
-            set_locked(HPX_MOVE(l));
+            hpx::experimental::atomic_notify_all(event_);
         }
 
         /// \brief Reset the event
@@ -67,27 +56,6 @@ namespace hpx { namespace lcos { namespace local {
         }
 
     private:
-        void wait_locked(std::unique_lock<mutex_type>& l)
-        {
-            HPX_ASSERT(l.owns_lock());
-
-            while (!event_.load(std::memory_order_acquire))
-            {
-                cond_.wait(l, "event::wait_locked");
-            }
-        }
-
-        void set_locked(std::unique_lock<mutex_type> l)
-        {
-            HPX_ASSERT(l.owns_lock());
-
-            // release the threads
-            cond_.notify_all(HPX_MOVE(l));
-        }
-
-        mutex_type mtx_;    ///< This mutex protects the queue.
-        local::detail::condition_variable cond_;
-
         std::atomic<bool> event_;
     };
 }}}    // namespace hpx::lcos::local
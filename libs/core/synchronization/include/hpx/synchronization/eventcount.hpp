@@ -0,0 +1,106 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/synchronization/eventcount.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/synchronization/detail/parking_lot.hpp>
+
+#include <atomic>
+#include <cstddef>
+
+namespace hpx::experimental {
+
+    /// An eventcount allows to turn a non-blocking condition into a blocking
+    /// one without adding any synchronization to the code paths that do not
+    /// have to wait. A waiting thread announces its intent to wait by calling
+    /// prepare_wait(), re-checks the condition, and then either calls
+    /// cancel_wait() (if the condition became true) or wait(). Notifying is a
+    /// single atomic load as long as there are no waiting threads.
+    ///
+    /// The waiting threads are suspended in the global parking lot, the
+    /// eventcount itself consists of two counters only.
+    class eventcount
+    {
+    public:
+        using key_type = std::size_t;
+
+        eventcount() noexcept
+          : epoch_(0)
+          , waiters_(0)
+        {
+        }
+
+        eventcount(eventcount const&) = delete;
+        eventcount(eventcount&&) = delete;
+        eventcount& operator=(eventcount const&) = delete;
+        eventcount& operator=(eventcount&&) = delete;
+
+        key_type prepare_wait() noexcept
+        {
+            waiters_.fetch_add(1, std::memory_order_seq_cst);
+
+            // pairs with the fence in has_waiters(): either the notifying
+            // thread sees this waiter or this thread sees the state change
+            // which is re-checked after prepare_wait()
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            return epoch_.load(std::memory_order_seq_cst);
+        }
+
+        void cancel_wait() noexcept
+        {
+            waiters_.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        /// Suspend the calling thread until a notification was issued after
+        /// the corresponding call to prepare_wait().
+        void wait(key_type key,
+            char const* description = "hpx::experimental::eventcount::wait")
+        {
+            while (epoch_.load(std::memory_order_acquire) == key)
+            {
+                hpx::lcos::local::detail::park(
+                    &epoch_,
+                    [&]() {
+                        return epoch_.load(std::memory_order_relaxed) == key;
+                    },
+                    description);
+            }
+            waiters_.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        void notify_one()
+        {
+            if (has_waiters())
+            {
+                epoch_.fetch_add(1, std::memory_order_seq_cst);
+                hpx::lcos::local::detail::unpark_one(&epoch_);
+            }
+        }
+
+        void notify_all()
+        {
+            if (has_waiters())
+            {
+                epoch_.fetch_add(1, std::memory_order_seq_cst);
+                hpx::lcos::local::detail::unpark_all(&epoch_);
+            }
+        }
+
+    private:
+        bool has_waiters() const noexcept
+        {
+            // pairs with the increment of waiters_ in prepare_wait()
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            return waiters_.load(std::memory_order_relaxed) != 0;
+        }
+
+        std::atomic<key_type> epoch_;
+        std::atomic<std::size_t> waiters_;
+    };
+}    // namespace hpx::experimental
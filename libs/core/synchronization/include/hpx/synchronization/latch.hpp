@@ -9,17 +9,14 @@
 #pragma once
 
 #include <hpx/assert.hpp>
-#include <hpx/concurrency/cache_line_data.hpp>
-#include <hpx/synchronization/detail/condition_variable.hpp>
-#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/synchronization/atomic_wait.hpp>
+#include <hpx/synchronization/detail/parking_lot.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
-#include <mutex>
-#include <utility>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx {
@@ -28,14 +25,15 @@ namespace hpx {
     /// threads to block until an operation is completed. An individual latch
     /// is a singleuse object; once the operation has been completed, the latch
     /// cannot be reused.
+    ///
+    /// Threads blocked on a latch are suspended in the global parking lot
+    /// (see \a hpx::experimental::atomic_wait), the latch itself consists of
+    /// the counter only.
     class latch
     {
     public:
         HPX_NON_COPYABLE(latch);
 
-    protected:
-        using mutex_type = hpx::spinlock;
-
     public:
         /// Initialize the latch
         ///
@@ -44,10 +42,7 @@ namespace hpx {
         /// Postconditions: counter_ == count.
         ///
         explicit latch(std::ptrdiff_t count)
-          : mtx_()
-          , cond_()
-          , counter_(count)
-          , notified_(count == 0)
+          : counter_(count)
         {
         }
 
@@ -90,24 +85,13 @@ namespace hpx {
         {
             HPX_ASSERT(update >= 0);
 
-            std::ptrdiff_t new_count = (counter_ -= update);
+            std::ptrdiff_t const new_count =
+                counter_.fetch_sub(update, std::memory_order_acq_rel) - update;
             HPX_ASSERT(new_count >= 0);
 
             if (new_count == 0)
             {
-                std::unique_lock l(mtx_.data_);
-                notified_ = true;
-
-                // Note: we use notify_one repeatedly instead of notify_all as we
-                // know that our implementation of condition_variable::notify_one
-                // relinquishes the lock before resuming the waiting thread
-                // which avoids suspension of this thread when it tries to
-                // re-lock the mutex while exiting from condition_variable::wait
-                while (cond_.data_.notify_one(
-                    HPX_MOVE(l), threads::thread_priority::boost))
-                {
-                    l = std::unique_lock(mtx_.data_);
-                }
+                hpx::experimental::atomic_notify_all(counter_);
             }
         }
 
@@ -126,13 +110,12 @@ namespace hpx {
         ///
         void wait() const
         {
-            std::unique_lock l(mtx_.data_);
-            if (counter_.load(std::memory_order_relaxed) > 0 || !notified_)
+            std::ptrdiff_t count = counter_.load(std::memory_order_acquire);
+            while (count != 0)
             {
-                cond_.data_.wait(l, "hpx::latch::wait");
-
-                HPX_ASSERT(counter_.load(std::memory_order_relaxed) == 0);
-                HPX_ASSERT(notified_);
+                hpx::experimental::atomic_wait(
+                    counter_, count, std::memory_order_acquire);
+                count = counter_.load(std::memory_order_acquire);
             }
         }
 
@@ -143,43 +126,22 @@ namespace hpx {
         {
             HPX_ASSERT(update >= 0);
 
-            std::unique_lock l(mtx_.data_);
-
-            std::ptrdiff_t old_count =
-                counter_.fetch_sub(update, std::memory_order_relaxed);
+            std::ptrdiff_t const old_count =
+                counter_.fetch_sub(update, std::memory_order_acq_rel);
             HPX_ASSERT(old_count >= update);
 
             if (old_count > update)
             {
-                cond_.data_.wait(l, "hpx::latch::arrive_and_wait");
-
-                HPX_ASSERT(counter_.load(std::memory_order_relaxed) == 0);
-                HPX_ASSERT(notified_);
+                wait();
             }
             else
             {
-                notified_ = true;
-
-                // Note: we use notify_one repeatedly instead of notify_all as we
-                // know that our implementation of condition_variable::notify_one
-                // relinquishes the lock before resuming the waiting thread
-                // which avoids suspension of this thread when it tries to
-                // re-lock the mutex while exiting from condition_variable::wait
-                while (cond_.data_.notify_one(
-                    HPX_MOVE(l), threads::thread_priority::boost))
-                {
-                    l = std::unique_lock(mtx_.data_);
-                }
+                hpx::experimental::atomic_notify_all(counter_);
             }
         }
 
     protected:
-        mutable util::cache_line_data<mutex_type> mtx_;
-        mutable util::cache_line_data<
-            hpx::lcos::local::detail::condition_variable>
-            cond_;
         std::atomic<std::ptrdiff_t> counter_;
-        bool notified_;
     };
 }    // namespace hpx
 
@@ -260,8 +222,7 @@ namespace hpx::lcos::local {
 
         void abort_all()
         {
-            std::unique_lock l(mtx_.data_);
-            cond_.data_.abort_all(HPX_MOVE(l));
+            hpx::lcos::local::detail::abort_all_parked(&counter_);
         }
 
         /// Increments counter_ by n. Does not block.
@@ -283,7 +244,15 @@ namespace hpx::lcos::local {
 
         /// Reset counter_ to n. Does not block.
         ///
-        /// Requires:  n >= 0.
+        /// Requires:  n >= 0, counter_ == 0, and every thread that called
+        ///            wait(), count_down_and_wait(), or arrive_and_wait() has
+        ///            returned from it.
+        ///
+        /// \note Releasing the waiting threads only makes them runnable. A
+        ///       thread that has been released but has not yet returned
+        ///       re-checks counter_ and blocks again if it was reset in the
+        ///       meantime. Waiting for counter_ == 0 (e.g. using is_ready())
+        ///       is not sufficient to satisfy this precondition.
         ///
         /// \throws Nothing.
         void reset(std::ptrdiff_t n)
@@ -295,15 +264,13 @@ namespace hpx::lcos::local {
 
             HPX_ASSERT(old_count == 0);
             HPX_UNUSED(old_count);
-
-            std::scoped_lock l(mtx_.data_);
-            notified_ = false;
         }
 
         /// Effects: Equivalent to:
         ///             if (is_ready())
         ///                 reset(count);
         ///             count_up(n);
+        /// Requires: the same as reset() if the latch is ready.
         /// Returns: true if the latch was reset
         bool reset_if_needed_and_count_up(
             std::ptrdiff_t n, std::ptrdiff_t count)
@@ -311,28 +278,15 @@ namespace hpx::lcos::local {
             HPX_ASSERT(n >= 0);
             HPX_ASSERT(count >= 0);
 
-            std::unique_lock l(mtx_.data_);
-
-            if (notified_)
+            std::ptrdiff_t old_count =
+                counter_.load(std::memory_order_acquire);
+            while (!counter_.compare_exchange_weak(old_count,
+                old_count == 0 ? n + count : old_count + n,
+                std::memory_order_acq_rel))
             {
-                notified_ = false;
-
-                std::ptrdiff_t old_count =
-                    counter_.fetch_add(n + count, std::memory_order_relaxed);
-
-                HPX_ASSERT(old_count == 0);
-                HPX_UNUSED(old_count);
-
-                return true;
             }
 
-            std::ptrdiff_t old_count =
-                counter_.fetch_add(n, std::memory_order_relaxed);
-
-            HPX_ASSERT(old_count > 0);
-            HPX_UNUSED(old_count);
-
-            return false;
+            return old_count == 0;
         }
     };
 }    // namespace hpx::lcos::local
@@ -0,0 +1,261 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/synchronization/reader_biased_shared_mutex.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/synchronization/eventcount.hpp>
+#include <hpx/synchronization/shared_mutex.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace hpx::experimental {
+
+    /// A shared mutex optimized for read-mostly data, based on BRAVO (Biased
+    /// Locking for Reader-Writer Locks, Dice and Kogan, 2019). Each worker
+    /// thread has its own reader indicator in a separate cache line. While
+    /// the mutex is reader biased, lock_shared and unlock_shared touch only
+    /// the indicator of the worker thread they are executed on. Readers
+    /// therefore do not contend with each other and scale with the number of
+    /// cores.
+    ///
+    /// A writer acquires the underlying shared mutex exclusively, revokes the
+    /// reader bias, and suspends until all reader indicators have drained.
+    /// While the bias is revoked, readers acquire the underlying shared mutex
+    /// before announcing themselves in their indicator. Revoking the bias is
+    /// linear in the number of reader indicators, thus the bias is restored
+    /// by a reader only after an inhibit window proportional to the time the
+    /// last revocation took. This bounds the overhead caused by writers on
+    /// mixed workloads.
+    ///
+    /// HPX threads may migrate between worker threads while holding the
+    /// mutex in shared mode, unlock_shared may decrement a different
+    /// indicator than the one incremented by lock_shared. Only the sum of
+    /// all indicators is meaningful.
+    template <typename SharedMutex = hpx::shared_mutex>
+    class reader_biased_shared_mutex
+    {
+    private:
+        using mutex_type = SharedMutex;
+        using indicator_type =
+            hpx::util::cache_aligned_data<std::atomic<std::ptrdiff_t>>;
+
+        // The reader bias is restored only after this many times the
+        // duration of the last revocation has passed.
+        static constexpr std::uint64_t inhibit_multiplier = 9;
+
+    public:
+        /// Construct a shared mutex with the given number of reader
+        /// indicators. This should be equal to the number of worker threads.
+        explicit reader_biased_shared_mutex(
+            std::size_t num_indicators = hpx::threads::hardware_concurrency())
+          : num_indicators_(num_indicators != 0 ? num_indicators : 1)
+          , readers_(new indicator_type[num_indicators_])
+          , reader_bias_(true)
+          , inhibit_until_(0)
+        {
+            for (std::size_t i = 0; i != num_indicators_; ++i)
+            {
+                readers_[i].data_.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        reader_biased_shared_mutex(reader_biased_shared_mutex const&) = delete;
+        reader_biased_shared_mutex(reader_biased_shared_mutex&&) = delete;
+        reader_biased_shared_mutex& operator=(
+            reader_biased_shared_mutex const&) = delete;
+        reader_biased_shared_mutex& operator=(
+            reader_biased_shared_mutex&&) = delete;
+
+        ~reader_biased_shared_mutex()
+        {
+            HPX_ASSERT(!readers_active());
+        }
+
+        void lock_shared()
+        {
+            if (try_lock_shared_biased())
+            {
+                return;
+            }
+
+            // the bias is revoked, wait for the writer (if any) to finish
+            mtx_.lock_shared();
+            lock_shared_slow();
+        }
+
+        bool try_lock_shared()
+        {
+            if (try_lock_shared_biased())
+            {
+                return true;
+            }
+
+            if (!mtx_.try_lock_shared())
+            {
+                return false;
+            }
+            lock_shared_slow();
+            return true;
+        }
+
+        void unlock_shared()
+        {
+            local_indicator().fetch_sub(1, std::memory_order_seq_cst);
+
+            // a writer may be waiting for the readers to drain only if the
+            // bias was revoked
+            if (!reader_bias_.load(std::memory_order_seq_cst))
+            {
+                drained_.notify_one();
+            }
+        }
+
+        void lock()
+        {
+            mtx_.lock();
+
+            // no reader can restore the bias while we hold the underlying
+            // mutex exclusively
+            bool const biased = reader_bias_.load(std::memory_order_relaxed);
+            std::uint64_t const start =
+                biased ? hpx::chrono::high_resolution_clock::now() : 0;
+
+            reader_bias_.store(false, std::memory_order_seq_cst);
+            wait_for_readers();
+
+            // start the inhibit window if the bias was revoked
+            if (biased)
+            {
+                std::uint64_t const now =
+                    hpx::chrono::high_resolution_clock::now();
+                inhibit_until_.store(now + inhibit_multiplier * (now - start),
+                    std::memory_order_relaxed);
+            }
+        }
+
+        bool try_lock()
+        {
+            if (!mtx_.try_lock())
+            {
+                return false;
+            }
+
+            bool const biased = reader_bias_.load(std::memory_order_relaxed);
+            reader_bias_.store(false, std::memory_order_seq_cst);
+            if (!readers_active())
+            {
+                return true;
+            }
+
+            // no reader can acquire the underlying mutex while we hold it,
+            // thus the previous state can be restored safely
+            reader_bias_.store(biased, std::memory_order_release);
+            mtx_.unlock();
+            return false;
+        }
+
+        void unlock()
+        {
+            mtx_.unlock();
+        }
+
+    private:
+        std::atomic<std::ptrdiff_t>& local_indicator() const noexcept
+        {
+            // threads that are not HPX worker threads share one indicator
+            return readers_[hpx::get_worker_thread_num() % num_indicators_]
+                .data_;
+        }
+
+        bool readers_active() const noexcept
+        {
+            std::ptrdiff_t readers = 0;
+            for (std::size_t i = 0; i != num_indicators_; ++i)
+            {
+                readers += readers_[i].data_.load(std::memory_order_seq_cst);
+            }
+            return readers != 0;
+        }
+
+        bool try_lock_shared_biased()
+        {
+            if (!reader_bias_.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+
+            std::atomic<std::ptrdiff_t>& indicator = local_indicator();
+            indicator.fetch_add(1, std::memory_order_seq_cst);
+            if (reader_bias_.load(std::memory_order_seq_cst))
+            {
+                return true;
+            }
+
+            // the bias was revoked concurrently, back off
+            indicator.fetch_sub(1, std::memory_order_seq_cst);
+            drained_.notify_one();
+            return false;
+        }
+
+        // Announce a reader holding the underlying mutex in shared mode. The
+        // underlying mutex is needed only to exclude writers while doing so.
+        void lock_shared_slow()
+        {
+            local_indicator().fetch_add(1, std::memory_order_seq_cst);
+
+            // no writer is active, restore the bias once the inhibit window
+            // has passed
+            if (!reader_bias_.load(std::memory_order_relaxed) &&
+                hpx::chrono::high_resolution_clock::now() >=
+                    inhibit_until_.load(std::memory_order_relaxed))
+            {
+                reader_bias_.store(true, std::memory_order_release);
+            }
+
+            mtx_.unlock_shared();
+        }
+
+        // Suspend until the active readers have left.
+        void wait_for_readers()
+        {
+            while (readers_active())
+            {
+                auto const key = drained_.prepare_wait();
+                if (!readers_active())
+                {
+                    drained_.cancel_wait();
+                    break;
+                }
+                drained_.wait(key,
+                    "hpx::experimental::reader_biased_shared_mutex::lock");
+            }
+        }
+
+        std::size_t const num_indicators_;
+        std::unique_ptr<indicator_type[]> readers_;
+
+        // the bias is read by all readers, but written only rarely
+        std::atomic<bool> reader_bias_;
+        std::atomic<std::uint64_t> inhibit_until_;
+
+        // writers wait for the readers to drain
+        hpx::experimental::eventcount drained_;
+
+        // serializes writers and excludes readers while the bias is revoked
+        mutex_type mtx_;
+    };
+}    // namespace hpx::experimental
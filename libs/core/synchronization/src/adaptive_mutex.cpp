@@ -0,0 +1,224 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/modules/itt_notify.hpp>
+#include <hpx/synchronization/adaptive_mutex.hpp>
+#include <hpx/synchronization/atomic_wait.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <mutex>
+
+namespace hpx::experimental {
+
+    namespace {
+
+        // Threads spin for (at most) this multiple of the average hold time
+        // before suspending.
+        constexpr std::int64_t spin_time_factor = 2;
+
+        // Upper limit for the spinning time [ns]
+        constexpr std::int64_t max_spin_time = 50000;
+
+        // Weight of a new sample in the moving average of the hold time is
+        // 1 / 2^hold_time_weight_shift
+        constexpr int hold_time_weight_shift = 3;
+
+        std::int64_t now() noexcept
+        {
+            return static_cast<std::int64_t>(
+                hpx::chrono::high_resolution_clock::now());
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    // All adaptive mutexes are registered here such that their statistics
+    // can be accumulated. The statistics of destroyed mutexes are kept
+    // separately.
+    struct adaptive_mutex_registry
+    {
+        using statistic_type = std::atomic<std::int64_t>
+            adaptive_mutex_statistics::*;
+
+        static adaptive_mutex_registry& get()
+        {
+            static adaptive_mutex_registry registry;
+            return registry;
+        }
+
+        void add(adaptive_mutex* m)
+        {
+            std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+            m->next_ = head_;
+            if (head_ != nullptr)
+            {
+                head_->prev_ = m;
+            }
+            head_ = m;
+        }
+
+        void remove(adaptive_mutex* m)
+        {
+            std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+            if (m->prev_ != nullptr)
+            {
+                m->prev_->next_ = m->next_;
+            }
+            else
+            {
+                HPX_ASSERT(head_ == m);
+                head_ = m->next_;
+            }
+            if (m->next_ != nullptr)
+            {
+                m->next_->prev_ = m->prev_;
+            }
+
+            for (statistic_type s : {&adaptive_mutex_statistics::acquisitions,
+                     &adaptive_mutex_statistics::contended,
+                     &adaptive_mutex_statistics::spin_time,
+                     &adaptive_mutex_statistics::suspensions})
+            {
+                (destroyed_.*s).fetch_add(
+                    (m->statistics_.*s).load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+            }
+        }
+
+        std::int64_t get_value(statistic_type s, bool reset)
+        {
+            std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+            std::int64_t result =
+                util::get_and_reset_value(destroyed_.*s, reset);
+            for (adaptive_mutex* m = head_; m != nullptr; m = m->next_)
+            {
+                result += util::get_and_reset_value(m->statistics_.*s, reset);
+            }
+            return result;
+        }
+
+        hpx::util::detail::spinlock mtx_;
+        adaptive_mutex* head_ = nullptr;
+        adaptive_mutex_statistics destroyed_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    adaptive_mutex::adaptive_mutex(char const* const description)
+    {
+        HPX_ITT_SYNC_CREATE(this, "hpx::experimental::adaptive_mutex",
+            description);
+        HPX_ITT_SYNC_RENAME(this, "hpx::experimental::adaptive_mutex");
+
+        adaptive_mutex_registry::get().add(this);
+    }
+
+    adaptive_mutex::~adaptive_mutex()
+    {
+        HPX_ASSERT(state_.load(std::memory_order_relaxed) == unlocked);
+
+        adaptive_mutex_registry::get().remove(this);
+
+        HPX_ITT_SYNC_DESTROY(this);
+    }
+
+    void adaptive_mutex::lock_contended()
+    {
+        statistics_.contended.fetch_add(1, std::memory_order_relaxed);
+
+        // Spin while the mutex is likely to be released soon. Nothing is
+        // gained by spinning if the mutex is typically held for longer than
+        // it takes to suspend and resume a thread.
+        std::int64_t const spin_limit =
+            (std::min)(spin_time_factor * average_hold_time(), max_spin_time);
+        if (spin_limit != 0)
+        {
+            std::int64_t const start = now();
+            std::int64_t spun = 0;
+            for (std::size_t k = 0; spun < spin_limit; ++k)
+            {
+                int expected = unlocked;
+                if (state_.load(std::memory_order_relaxed) == unlocked &&
+                    state_.compare_exchange_strong(
+                        expected, locked, std::memory_order_acquire))
+                {
+                    statistics_.spin_time.fetch_add(
+                        now() - start, std::memory_order_relaxed);
+                    return;
+                }
+
+                hpx::execution_base::this_thread::yield_k(
+                    k, "hpx::experimental::adaptive_mutex::lock");
+                spun = now() - start;
+            }
+            statistics_.spin_time.fetch_add(spun, std::memory_order_relaxed);
+        }
+
+        // Suspend until the mutex is released. A thread that acquires the
+        // mutex here can't tell whether other threads are still waiting,
+        // it has to assume they are.
+        while (state_.exchange(locked_with_waiters,
+                   std::memory_order_acquire) != unlocked)
+        {
+            statistics_.suspensions.fetch_add(1, std::memory_order_relaxed);
+            hpx::experimental::atomic_wait(
+                state_, locked_with_waiters, std::memory_order_relaxed);
+        }
+    }
+
+    void adaptive_mutex::notify_waiter() noexcept
+    {
+        hpx::experimental::atomic_notify_one(state_);
+    }
+
+    void adaptive_mutex::update_hold_time(std::int64_t hold_time) noexcept
+    {
+        // only the owner of the mutex updates the average
+        std::int64_t const average =
+            average_hold_time_.load(std::memory_order_relaxed);
+        average_hold_time_.store(average +
+                ((hold_time - average) >> hold_time_weight_shift),
+            std::memory_order_relaxed);
+    }
+}    // namespace hpx::experimental
+
+namespace hpx::lcos::local::detail {
+
+    using hpx::experimental::adaptive_mutex_registry;
+    using hpx::experimental::adaptive_mutex_statistics;
+
+    std::int64_t get_adaptive_mutex_acquisitions(bool reset)
+    {
+        return adaptive_mutex_registry::get().get_value(
+            &adaptive_mutex_statistics::acquisitions, reset);
+    }
+
+    std::int64_t get_adaptive_mutex_contended(bool reset)
+    {
+        return adaptive_mutex_registry::get().get_value(
+            &adaptive_mutex_statistics::contended, reset);
+    }
+
+    std::int64_t get_adaptive_mutex_spin_time(bool reset)
+    {
+        return adaptive_mutex_registry::get().get_value(
+            &adaptive_mutex_statistics::spin_time, reset);
+    }
+
+    std::int64_t get_adaptive_mutex_suspensions(bool reset)
+    {
+        return adaptive_mutex_registry::get().get_value(
+            &adaptive_mutex_statistics::suspensions, reset);
+    }
+}    // namespace hpx::lcos::local::detail
@@ -0,0 +1,270 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/execution_base/agent_ref.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/functional/function_ref.hpp>
+#include <hpx/lock_registration/detail/register_locks.hpp>
+#include <hpx/synchronization/detail/parking_lot.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/timing/steady_clock.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <boost/intrusive/list.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace hpx { namespace lcos { namespace local { namespace detail {
+
+    namespace {
+
+        struct parked_thread
+        {
+            using hook_type = boost::intrusive::list_member_hook<
+                boost::intrusive::link_mode<boost::intrusive::normal_link>>;
+
+            parked_thread(
+                hpx::execution_base::agent_ref ctx, void const* addr) noexcept
+              : ctx_(ctx)
+              , addr_(addr)
+            {
+            }
+
+            hpx::execution_base::agent_ref ctx_;
+            void const* addr_;
+            hook_type list_hook_;
+        };
+
+        using list_option_type = boost::intrusive::member_hook<parked_thread,
+            parked_thread::hook_type, &parked_thread::list_hook_>;
+
+        using queue_type = boost::intrusive::list<parked_thread,
+            list_option_type, boost::intrusive::constant_time_size<false>>;
+
+        using mutex_type = hpx::spinlock;
+
+        struct bucket
+        {
+            bucket() noexcept
+              : waiters_(0)
+            {
+            }
+
+            // number of threads that are parked (or about to be parked) on
+            // any of the addresses mapping onto this bucket
+            std::atomic<std::size_t> waiters_;
+            mutex_type mtx_;
+            queue_type queue_;
+        };
+
+        constexpr std::size_t num_buckets_log2 = 8;
+        constexpr std::size_t num_buckets = std::size_t(1) << num_buckets_log2;
+
+        bucket& get_bucket(void const* addr) noexcept
+        {
+            static util::cache_aligned_data<bucket> buckets[num_buckets];
+
+            // Fibonacci hashing distributes neighboring addresses well
+            auto const h = static_cast<std::uint64_t>(
+                               reinterpret_cast<std::uintptr_t>(addr)) *
+                11400714819323198485ull;
+            return buckets[h >> (64 - num_buckets_log2)].data_;
+        }
+
+        // remove the entry from the queue if it was not removed by a
+        // notifying thread (i.e. on timeout or if the thread was aborted)
+        struct reset_parked_thread
+        {
+            reset_parked_thread(parked_thread& t, queue_type& q) noexcept
+              : t_(t)
+              , q_(q)
+            {
+            }
+
+            ~reset_parked_thread()
+            {
+                if (t_.ctx_)
+                {
+                    q_.erase(q_.iterator_to(t_));
+                }
+            }
+
+            parked_thread& t_;
+            queue_type& q_;
+        };
+
+        struct decrement_waiters
+        {
+            explicit decrement_waiters(bucket& b) noexcept
+              : b_(b)
+            {
+                // announce the intent to wait before the predicate is
+                // evaluated, pairs with the fence in unpark_one/unpark_all
+                b_.waiters_.fetch_add(1, std::memory_order_seq_cst);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+
+            ~decrement_waiters()
+            {
+                b_.waiters_.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            bucket& b_;
+        };
+
+        template <typename Suspend>
+        bool park_impl(void const* addr, hpx::function_ref<bool()> should_park,
+            Suspend&& suspend)
+        {
+            bucket& b = get_bucket(addr);
+            decrement_waiters d(b);
+
+            std::unique_lock<mutex_type> l(b.mtx_);
+            if (!should_park())
+            {
+                return true;
+            }
+
+            auto this_ctx = hpx::execution_base::this_thread::agent();
+            parked_thread t(this_ctx, addr);
+            b.queue_.push_back(t);
+
+            reset_parked_thread r(t, b.queue_);
+            {
+                util::unlock_guard<std::unique_lock<mutex_type>> ul(l);
+                suspend(this_ctx);
+            }
+
+            // the entry was reset if the thread was notified
+            return !t.ctx_;
+        }
+
+        bool has_waiters(bucket& b) noexcept
+        {
+            // pairs with the fence in decrement_waiters
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            return b.waiters_.load(std::memory_order_relaxed) != 0;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void park(void const* addr, hpx::function_ref<bool()> should_park,
+        char const* description)
+    {
+        park_impl(addr, should_park,
+            [description](hpx::execution_base::agent_ref ctx) {
+                ctx.suspend(description);
+            });
+    }
+
+    bool park_until(void const* addr, hpx::function_ref<bool()> should_park,
+        hpx::chrono::steady_time_point const& abs_time,
+        char const* description)
+    {
+        return park_impl(addr, should_park,
+            [&](hpx::execution_base::agent_ref ctx) {
+                ctx.sleep_until(abs_time.value(), description);
+            });
+    }
+
+    void unpark_one(void const* addr)
+    {
+        bucket& b = get_bucket(addr);
+        if (!has_waiters(b))
+        {
+            return;
+        }
+
+        std::unique_lock<mutex_type> l(b.mtx_);
+        for (auto it = b.queue_.begin(); it != b.queue_.end(); ++it)
+        {
+            if (it->addr_ == addr)
+            {
+                auto ctx = it->ctx_;
+
+                // remove item from queue before resuming the thread
+                it->ctx_.reset();
+                b.queue_.erase(it);
+
+                l.unlock();
+                ctx.resume();
+                return;
+            }
+        }
+    }
+
+    void unpark_all(void const* addr)
+    {
+        bucket& b = get_bucket(addr);
+        if (!has_waiters(b))
+        {
+            return;
+        }
+
+        std::unique_lock<mutex_type> l(b.mtx_);
+        for (auto it = b.queue_.begin(); it != b.queue_.end();)
+        {
+            if (it->addr_ != addr)
+            {
+                ++it;
+                continue;
+            }
+
+            auto ctx = it->ctx_;
+
+            // remove item from queue before resuming the thread
+            it->ctx_.reset();
+            it = b.queue_.erase(it);
+
+            // resuming a thread does not suspend the current one
+            util::ignore_while_checking il(&l);
+            HPX_UNUSED(il);
+
+            ctx.resume();
+        }
+    }
+
+    void abort_all_parked(void const* addr)
+    {
+        bucket& b = get_bucket(addr);
+        if (!has_waiters(b))
+        {
+            return;
+        }
+
+        std::unique_lock<mutex_type> l(b.mtx_);
+        auto it = b.queue_.begin();
+        while (it != b.queue_.end())
+        {
+            if (it->addr_ != addr)
+            {
+                ++it;
+                continue;
+            }
+
+            auto ctx = it->ctx_;
+
+            // remove item from queue before aborting the thread
+            it->ctx_.reset();
+            b.queue_.erase(it);
+
+            {
+                // unlock while aborting thread as this can suspend
+                util::unlock_guard<std::unique_lock<mutex_type>> ul(l);
+                ctx.abort();
+            }
+
+            // the queue might have changed in the meantime
+            it = b.queue_.begin();
+        }
+    }
+}}}}    // namespace hpx::lcos::local::detail
@@ -0,0 +1,155 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the throughput of the lock based and the lock-free MPMC channels
+// if many producers and consumers access the same channel concurrently.
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/synchronization/channel_mpmc.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using hpx::program_options::options_description;
+using hpx::program_options::value;
+using hpx::program_options::variables_map;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void channel_get(hpx::lcos::local::channel_mpmc<T> const& c, T& result)
+{
+    while (!c.get(&result))
+    {
+        hpx::this_thread::yield();
+    }
+}
+
+template <typename T>
+void channel_set(hpx::lcos::local::channel_mpmc<T>& c, T val)
+{
+    while (!c.set(std::move(val)))    // NOLINT
+    {
+        hpx::this_thread::yield();
+    }
+}
+
+template <typename T>
+void channel_get(hpx::lcos::local::channel_mpmc_lockfree<T> const& c, T& result)
+{
+    c.wait_get(&result);
+}
+
+template <typename T>
+void channel_set(hpx::lcos::local::channel_mpmc_lockfree<T>& c, T val)
+{
+    c.wait_set(std::move(val));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Channel>
+double run(std::size_t capacity, int producers, int consumers,
+    std::uint64_t items)
+{
+    Channel c(capacity);
+
+    std::uint64_t const items_per_producer = items / producers;
+    std::uint64_t const items_per_consumer =
+        items_per_producer * producers / consumers;
+
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    std::vector<hpx::future<void>> threads;
+    threads.reserve(producers + consumers);
+    for (int i = 0; i != producers; ++i)
+    {
+        threads.push_back(hpx::async([&]() {
+            for (std::uint64_t j = 0; j != items_per_producer; ++j)
+            {
+                channel_set(c, j);
+            }
+        }));
+    }
+    for (int i = 0; i != consumers; ++i)
+    {
+        threads.push_back(hpx::async([&]() {
+            std::uint64_t val = 0;
+            for (std::uint64_t j = 0; j != items_per_consumer; ++j)
+            {
+                channel_get(c, val);
+            }
+        }));
+    }
+    hpx::wait_all(threads);
+
+    std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+
+    return static_cast<double>(end - start) / 1e9;
+}
+
+void print_throughput(
+    std::string const& name, std::uint64_t items, double elapsed)
+{
+    std::cout << name << " throughput: " << (items / elapsed) << " [op/s] ("
+              << (elapsed / items) << " [s/op])\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    std::size_t const capacity = vm["capacity"].as<std::size_t>();
+    int const producers = vm["producers"].as<int>();
+    int const consumers = vm["consumers"].as<int>();
+    std::uint64_t const items = vm["items"].as<std::uint64_t>();
+
+    // make sure all items produced are being consumed
+    std::uint64_t const total = items / producers * producers;
+    if (total % consumers != 0)
+    {
+        std::cout << "the number of items (" << total
+                  << ") has to be divisible by the number of consumers\n";
+        return hpx::local::finalize();
+    }
+
+    using channel_type = hpx::lcos::local::channel_mpmc<std::uint64_t>;
+    using lockfree_channel_type =
+        hpx::lcos::local::channel_mpmc_lockfree<std::uint64_t>;
+
+    print_throughput("channel_mpmc", total,
+        run<channel_type>(capacity, producers, consumers, total));
+    print_throughput("channel_mpmc_lockfree", total,
+        run<lockfree_channel_type>(capacity, producers, consumers, total));
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("capacity", value<std::size_t>()->default_value(1024),
+         "capacity of the channel")
+        ("producers", value<int>()->default_value(32),
+         "number of producer threads")
+        ("consumers", value<int>()->default_value(32),
+         "number of consumer threads")
+        ("items", value<std::uint64_t>()->default_value(10000000),
+         "total number of items to send through the channel");
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -0,0 +1,133 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the throughput of a queue protected by hpx::mutex, hpx::spinlock,
+// and the combining mutex.
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/mutex.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/synchronization/combining_mutex.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using hpx::program_options::options_description;
+using hpx::program_options::value;
+using hpx::program_options::variables_map;
+
+///////////////////////////////////////////////////////////////////////////////
+// the data protected by the mutex
+struct shared_queue
+{
+    std::deque<std::uint64_t> queue;
+    std::uint64_t operations = 0;
+
+    void operator()(std::uint64_t j)
+    {
+        ++operations;
+        if (j % 2 != 0 && !queue.empty())
+        {
+            queue.pop_front();
+        }
+        else
+        {
+            queue.push_back(j);
+        }
+    }
+};
+
+template <typename F>
+double run(std::size_t threads, std::uint64_t iterations, F&& f)
+{
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(threads);
+    for (std::size_t i = 0; i != threads; ++i)
+    {
+        futures.push_back(hpx::async([&]() {
+            for (std::uint64_t j = 0; j != iterations; ++j)
+            {
+                f(j);
+            }
+        }));
+    }
+    hpx::wait_all(futures);
+
+    std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+
+    return static_cast<double>(end - start) / 1e9;
+}
+
+template <typename Mutex>
+double run_locked(std::size_t threads, std::uint64_t iterations)
+{
+    Mutex mtx;
+    shared_queue data;
+    return run(threads, iterations, [&](std::uint64_t j) {
+        std::lock_guard<Mutex> l(mtx);
+        data(j);
+    });
+}
+
+double run_combining(std::size_t threads, std::uint64_t iterations)
+{
+    hpx::experimental::combining_mutex mtx;
+    shared_queue data;
+    return run(threads, iterations,
+        [&](std::uint64_t j) { mtx.execute([&]() { data(j); }); });
+}
+
+void print_throughput(
+    std::string const& name, std::uint64_t operations, double elapsed)
+{
+    std::cout << name << " throughput: " << (operations / elapsed)
+              << " [op/s] (" << (elapsed / operations) << " [s/op])\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    std::size_t const threads = vm["threads"].as<std::size_t>();
+    std::uint64_t const iterations = vm["iterations"].as<std::uint64_t>();
+    std::uint64_t const operations = threads * iterations;
+
+    print_throughput("hpx::mutex", operations,
+        run_locked<hpx::mutex>(threads, iterations));
+    print_throughput("hpx::spinlock", operations,
+        run_locked<hpx::spinlock>(threads, iterations));
+    print_throughput(
+        "combining_mutex", operations, run_combining(threads, iterations));
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("threads", value<std::size_t>()->default_value(64),
+         "number of HPX threads accessing the queue")
+        ("iterations", value<std::uint64_t>()->default_value(100000),
+         "number of operations per thread");
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -0,0 +1,119 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the throughput of hpx::shared_mutex and the reader biased shared
+// mutex for different ratios of read and write accesses.
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/synchronization/reader_biased_shared_mutex.hpp>
+#include <hpx/synchronization/shared_mutex.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+using hpx::program_options::options_description;
+using hpx::program_options::value;
+using hpx::program_options::variables_map;
+
+///////////////////////////////////////////////////////////////////////////////
+// the data protected by the mutex
+struct table
+{
+    std::uint64_t values[8] = {};
+};
+
+template <typename Mutex>
+double run(std::size_t threads, std::uint64_t iterations,
+    std::uint64_t write_permille)
+{
+    Mutex mtx;
+    table data;
+
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    std::vector<hpx::future<std::uint64_t>> futures;
+    futures.reserve(threads);
+    for (std::size_t i = 0; i != threads; ++i)
+    {
+        futures.push_back(hpx::async([&, i]() {
+            std::uint64_t sum = 0;
+            for (std::uint64_t j = 0; j != iterations; ++j)
+            {
+                if ((i * iterations + j) % 1000 < write_permille)
+                {
+                    std::unique_lock<Mutex> l(mtx);
+                    ++data.values[j % 8];
+                }
+                else
+                {
+                    std::shared_lock<Mutex> l(mtx);
+                    sum += data.values[j % 8];
+                }
+            }
+            return sum;
+        }));
+    }
+    hpx::wait_all(futures);
+
+    std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+
+    return static_cast<double>(end - start) / 1e9;
+}
+
+void print_throughput(std::string const& name, std::uint64_t write_permille,
+    std::uint64_t operations, double elapsed)
+{
+    std::cout << name << " (" << write_permille / 10.0
+              << "% writes) throughput: " << (operations / elapsed)
+              << " [op/s] (" << (elapsed / operations) << " [s/op])\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    std::size_t const threads = vm["threads"].as<std::size_t>();
+    std::uint64_t const iterations = vm["iterations"].as<std::uint64_t>();
+    std::uint64_t const operations = threads * iterations;
+
+    using biased_mutex_type = hpx::experimental::reader_biased_shared_mutex<>;
+
+    for (std::uint64_t write_permille : {0, 1, 10, 100, 500})
+    {
+        print_throughput("hpx::shared_mutex", write_permille, operations,
+            run<hpx::shared_mutex>(threads, iterations, write_permille));
+        print_throughput("reader_biased_shared_mutex", write_permille,
+            operations,
+            run<biased_mutex_type>(threads, iterations, write_permille));
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("threads", value<std::size_t>()->default_value(64),
+         "number of HPX threads accessing the mutex")
+        ("iterations", value<std::uint64_t>()->default_value(100000),
+         "number of lock acquisitions per thread");
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
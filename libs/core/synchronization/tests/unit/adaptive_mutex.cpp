@@ -0,0 +1,125 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/chrono.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/synchronization/adaptive_mutex.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+using hpx::experimental::adaptive_mutex;
+
+constexpr int NUM_THREADS = 64;
+constexpr int NUM_ITERATIONS = 1000;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_try_lock()
+{
+    adaptive_mutex mtx;
+
+    HPX_TEST(mtx.try_lock());
+    HPX_TEST(!mtx.try_lock());
+    mtx.unlock();
+
+    HPX_TEST(mtx.try_lock());
+    mtx.unlock();
+
+    HPX_TEST_EQ(mtx.statistics().acquisitions.load(), std::int64_t(2));
+    HPX_TEST_EQ(mtx.statistics().contended.load(), std::int64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_mutual_exclusion(bool yield_while_locked)
+{
+    std::int64_t const acquisitions_before =
+        hpx::lcos::local::detail::get_adaptive_mutex_acquisitions(false);
+
+    std::size_t counter = 0;
+    {
+        adaptive_mutex mtx;
+        std::atomic<bool> inside(false);
+
+        std::vector<hpx::future<void>> threads;
+        for (int i = 0; i != NUM_THREADS; ++i)
+        {
+            threads.push_back(hpx::async([&]() {
+                for (int j = 0; j != NUM_ITERATIONS; ++j)
+                {
+                    std::lock_guard<adaptive_mutex> l(mtx);
+
+                    HPX_TEST(!inside.exchange(true));
+                    ++counter;
+                    if (yield_while_locked && j % 16 == 0)
+                    {
+                        hpx::this_thread::yield();
+                    }
+                    inside.store(false);
+                }
+            }));
+        }
+        hpx::wait_all(threads);
+
+        HPX_TEST_EQ(mtx.statistics().acquisitions.load(),
+            std::int64_t(NUM_THREADS * NUM_ITERATIONS));
+        HPX_TEST(mtx.average_hold_time() >= 0);
+    }
+
+    HPX_TEST_EQ(counter, std::size_t(NUM_THREADS * NUM_ITERATIONS));
+
+    // the statistics of destroyed mutexes are retained
+    HPX_TEST(hpx::lcos::local::detail::get_adaptive_mutex_acquisitions(false) >=
+        acquisitions_before + NUM_THREADS * NUM_ITERATIONS);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_hold_time()
+{
+    adaptive_mutex mtx;
+    for (int i = 0; i != 64; ++i)
+    {
+        std::lock_guard<adaptive_mutex> l(mtx);
+        hpx::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    // the mutex has been held for at least 100us each time
+    HPX_TEST(mtx.average_hold_time() > 50000);
+
+    // threads waiting for the mutex are suspended
+    hpx::future<void> f;
+    {
+        std::lock_guard<adaptive_mutex> l(mtx);
+        f = hpx::async([&]() { std::lock_guard<adaptive_mutex> l(mtx); });
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    f.get();
+
+    HPX_TEST_EQ(mtx.statistics().contended.load(), std::int64_t(1));
+    HPX_TEST(mtx.statistics().suspensions.load() >= 1);
+}
+
+int hpx_main()
+{
+    test_try_lock();
+    test_mutual_exclusion(false);
+    test_mutual_exclusion(true);
+    test_hold_time();
+
+    hpx::local::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    return hpx::local::init(hpx_main, argc, argv);
+}
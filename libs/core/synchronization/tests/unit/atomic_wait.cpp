@@ -0,0 +1,150 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/synchronization/atomic_wait.hpp>
+#include <hpx/synchronization/eventcount.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+constexpr int NUM_THREADS = 100;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_atomic_wait()
+{
+    std::atomic<int> flag(0);
+    std::atomic<int> woken(0);
+
+    std::vector<hpx::future<void>> waiters;
+    for (int i = 0; i != NUM_THREADS; ++i)
+    {
+        waiters.push_back(hpx::async([&]() {
+            hpx::experimental::atomic_wait(flag, 0);
+            HPX_TEST_NEQ(flag.load(), 0);
+            ++woken;
+        }));
+    }
+
+    hpx::this_thread::yield();
+    HPX_TEST_EQ(woken.load(), 0);
+
+    flag.store(1);
+    hpx::experimental::atomic_notify_all(flag);
+
+    hpx::wait_all(waiters);
+    HPX_TEST_EQ(woken.load(), NUM_THREADS);
+
+    // waiting for a value different from the current one returns immediately
+    hpx::experimental::atomic_wait(flag, 0);
+}
+
+void test_atomic_notify_one()
+{
+    std::atomic<int> counter(0);
+    std::atomic<int> consumed(0);
+
+    // each waiter consumes one unit of the counter
+    std::vector<hpx::future<void>> waiters;
+    for (int i = 0; i != NUM_THREADS; ++i)
+    {
+        waiters.push_back(hpx::async([&]() {
+            int value = counter.load();
+            for (;;)
+            {
+                if (value > 0)
+                {
+                    if (counter.compare_exchange_weak(value, value - 1))
+                    {
+                        break;
+                    }
+                    continue;
+                }
+                hpx::experimental::atomic_wait(counter, value);
+                value = counter.load();
+            }
+            ++consumed;
+        }));
+    }
+
+    for (int i = 0; i != NUM_THREADS; ++i)
+    {
+        ++counter;
+        hpx::experimental::atomic_notify_one(counter);
+    }
+
+    hpx::wait_all(waiters);
+    HPX_TEST_EQ(consumed.load(), NUM_THREADS);
+    HPX_TEST_EQ(counter.load(), 0);
+}
+
+void test_atomic_wait_until()
+{
+    std::atomic<int> flag(0);
+
+    HPX_TEST(!hpx::experimental::atomic_wait_until(flag, 0,
+        hpx::chrono::steady_clock::now() + std::chrono::milliseconds(10)));
+
+    flag.store(1);
+    HPX_TEST(hpx::experimental::atomic_wait_until(flag, 0,
+        hpx::chrono::steady_clock::now() + std::chrono::milliseconds(10)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_eventcount()
+{
+    hpx::experimental::eventcount ec;
+    std::atomic<bool> ready(false);
+
+    std::vector<hpx::future<void>> waiters;
+    for (int i = 0; i != NUM_THREADS; ++i)
+    {
+        waiters.push_back(hpx::async([&]() {
+            while (!ready.load())
+            {
+                auto key = ec.prepare_wait();
+                if (ready.load())
+                {
+                    ec.cancel_wait();
+                    break;
+                }
+                ec.wait(key);
+            }
+        }));
+    }
+
+    hpx::this_thread::yield();
+
+    ready.store(true);
+    ec.notify_all();
+
+    hpx::wait_all(waiters);
+
+    // notifying without any waiting threads has no effect
+    ec.notify_one();
+    ec.notify_all();
+}
+
+int hpx_main()
+{
+    test_atomic_wait();
+    test_atomic_notify_one();
+    test_atomic_wait_until();
+    test_eventcount();
+
+    hpx::local::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    return hpx::local::init(hpx_main, argc, argv);
+}
@@ -0,0 +1,215 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/synchronization/channel_mpmc.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using channel_type = hpx::lcos::local::channel_mpmc_lockfree<int>;
+
+constexpr int NUM_WORKERS = 1000;
+constexpr int NUM_PRODUCERS = 16;
+constexpr int NUM_CONSUMERS = 16;
+constexpr int NUM_VALUES = 10000;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_non_blocking()
+{
+    channel_type c(3);
+    HPX_TEST_EQ(c.capacity(), std::size_t(4));
+
+    HPX_TEST(!c.get());
+    for (int i = 0; i != 4; ++i)
+    {
+        HPX_TEST(c.set(int(i)));
+    }
+    HPX_TEST(!c.set(42));
+
+    HPX_TEST(c.get());
+    for (int i = 0; i != 4; ++i)
+    {
+        int val = -1;
+        HPX_TEST(c.get(&val));
+        HPX_TEST_EQ(val, i);
+    }
+    HPX_TEST(!c.get());
+
+    c.close();
+    HPX_TEST(!c.set(42));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int thread_func(int i, channel_type& channel, channel_type& next)
+{
+    HPX_TEST(channel.wait_set(int(i)));
+
+    int result = -1;
+    HPX_TEST(next.wait_get(&result));
+    return result;
+}
+
+void test_shift()
+{
+    std::vector<std::unique_ptr<channel_type>> channels;
+    channels.reserve(NUM_WORKERS);
+
+    std::vector<hpx::future<int>> workers;
+    workers.reserve(NUM_WORKERS);
+
+    for (int i = 0; i != NUM_WORKERS; ++i)
+    {
+        channels.push_back(std::make_unique<channel_type>(std::size_t(1)));
+    }
+
+    for (int i = 0; i != NUM_WORKERS; ++i)
+    {
+        workers.push_back(hpx::async(&thread_func, i, std::ref(*channels[i]),
+            std::ref(*channels[(i + 1) % NUM_WORKERS])));
+    }
+
+    hpx::wait_all(workers);
+
+    for (int i = 0; i != NUM_WORKERS; ++i)
+    {
+        HPX_TEST_EQ((i + 1) % NUM_WORKERS, workers[i].get());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_producers_consumers()
+{
+    // a small capacity forces producers and consumers to suspend
+    channel_type c(8);
+
+    std::vector<hpx::future<void>> producers;
+    producers.reserve(NUM_PRODUCERS);
+    for (int p = 0; p != NUM_PRODUCERS; ++p)
+    {
+        producers.push_back(hpx::async([&c]() {
+            for (int i = 1; i <= NUM_VALUES; ++i)
+            {
+                HPX_TEST(c.wait_set(int(i)));
+            }
+        }));
+    }
+
+    std::vector<hpx::future<std::size_t>> consumers;
+    consumers.reserve(NUM_CONSUMERS);
+    for (int p = 0; p != NUM_CONSUMERS; ++p)
+    {
+        consumers.push_back(hpx::async([&c]() {
+            std::size_t sum = 0;
+            for (int i = 0; i != NUM_VALUES * NUM_PRODUCERS / NUM_CONSUMERS;
+                 ++i)
+            {
+                int val = 0;
+                HPX_TEST(c.wait_get(&val));
+                sum += val;
+            }
+            return sum;
+        }));
+    }
+
+    hpx::wait_all(producers);
+
+    std::size_t sum = 0;
+    for (auto& f : consumers)
+    {
+        sum += f.get();
+    }
+
+    HPX_TEST_EQ(sum,
+        std::size_t(NUM_PRODUCERS) * NUM_VALUES * (NUM_VALUES + 1) / 2);
+    HPX_TEST(!c.get());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Two threads keep handing a value back and forth, each of them suspending on
+// every round. A lost wake-up makes this test hang.
+void test_ping_pong()
+{
+    channel_type ping(1);
+    channel_type pong(1);
+
+    hpx::future<void> f = hpx::async([&]() {
+        for (int i = 0; i != NUM_VALUES; ++i)
+        {
+            int val = -1;
+            HPX_TEST(ping.wait_get(&val));
+            HPX_TEST(pong.wait_set(val + 1));
+        }
+    });
+
+    int val = 0;
+    for (int i = 0; i != NUM_VALUES; ++i)
+    {
+        HPX_TEST(ping.wait_set(int(val)));
+        HPX_TEST(pong.wait_get(&val));
+    }
+    f.get();
+
+    HPX_TEST_EQ(val, NUM_VALUES);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_close()
+{
+    channel_type c(1);
+
+    // closing the channel releases all suspended consumers
+    std::vector<hpx::future<bool>> consumers;
+    for (int i = 0; i != 10; ++i)
+    {
+        consumers.push_back(hpx::async([&c]() {
+            int val = 0;
+            return c.wait_get(&val);
+        }));
+    }
+
+    hpx::this_thread::yield();
+    c.close();
+
+    for (auto& f : consumers)
+    {
+        HPX_TEST(!f.get());
+    }
+
+    bool caught_exception = false;
+    try
+    {
+        c.close();
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+int hpx_main()
+{
+    test_non_blocking();
+    test_shift();
+    test_producers_consumers();
+    test_ping_pong();
+    test_close();
+
+    hpx::local::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    return hpx::local::init(hpx_main, argc, argv);
+}
@@ -0,0 +1,128 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/synchronization/combining_mutex.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+constexpr int NUM_THREADS = 64;
+constexpr int NUM_ITERATIONS = 1000;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_execute()
+{
+    hpx::experimental::combining_mutex mtx;
+
+    int value = 0;
+    mtx.execute([&]() { ++value; });
+    HPX_TEST_EQ(value, 1);
+
+    HPX_TEST_EQ(mtx.execute([&]() { return ++value; }), 2);
+    HPX_TEST_EQ(mtx.execute([]() { return std::string("42"); }),
+        std::string("42"));
+}
+
+void test_exception()
+{
+    hpx::experimental::combining_mutex mtx;
+
+    bool caught_exception = false;
+    try
+    {
+        mtx.execute([]() { throw std::runtime_error("test"); });
+        HPX_TEST(false);
+    }
+    catch (std::runtime_error const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    // the lock is usable after an exception
+    HPX_TEST_EQ(mtx.execute([]() { return 42; }), 42);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_execute(std::size_t max_passes)
+{
+    hpx::experimental::combining_mutex mtx(max_passes);
+
+    // the operations are not synchronized otherwise
+    std::size_t counter = 0;
+    std::deque<int> queue;
+    std::atomic<bool> inside(false);
+
+    std::vector<hpx::future<std::size_t>> threads;
+    for (int i = 0; i != NUM_THREADS; ++i)
+    {
+        threads.push_back(hpx::async([&, i]() {
+            std::size_t popped = 0;
+            for (int j = 0; j != NUM_ITERATIONS; ++j)
+            {
+                bool const pop = (i + j) % 2 != 0;
+                popped += mtx.execute([&]() {
+                    HPX_TEST(!inside.exchange(true));
+                    ++counter;
+
+                    std::size_t result = 0;
+                    if (pop && !queue.empty())
+                    {
+                        queue.pop_front();
+                        result = 1;
+                    }
+                    else
+                    {
+                        queue.push_back(j);
+                    }
+
+                    inside.store(false);
+                    return result;
+                });
+
+                if (j % 64 == 0)
+                {
+                    hpx::this_thread::yield();
+                }
+            }
+            return popped;
+        }));
+    }
+
+    std::size_t popped = 0;
+    for (auto& f : threads)
+    {
+        popped += f.get();
+    }
+
+    HPX_TEST_EQ(counter, std::size_t(NUM_THREADS * NUM_ITERATIONS));
+    HPX_TEST_EQ(queue.size() + 2 * popped, counter);
+}
+
+int hpx_main()
+{
+    test_execute();
+    test_exception();
+
+    test_concurrent_execute(16);
+    test_concurrent_execute(1);
+
+    hpx::local::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    return hpx::local::init(hpx_main, argc, argv);
+}
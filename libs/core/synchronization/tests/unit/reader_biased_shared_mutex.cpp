@@ -0,0 +1,144 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/synchronization/reader_biased_shared_mutex.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+using mutex_type = hpx::experimental::reader_biased_shared_mutex<>;
+
+constexpr int NUM_THREADS = 64;
+constexpr int NUM_ITERATIONS = 1000;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_try_lock()
+{
+    mutex_type mtx;
+
+    HPX_TEST(mtx.try_lock_shared());
+    HPX_TEST(mtx.try_lock_shared());
+    HPX_TEST(!mtx.try_lock());
+    mtx.unlock_shared();
+    mtx.unlock_shared();
+
+    HPX_TEST(mtx.try_lock());
+    HPX_TEST(!mtx.try_lock());
+    HPX_TEST(!mtx.try_lock_shared());
+    mtx.unlock();
+
+    HPX_TEST(mtx.try_lock_shared());
+    mtx.unlock_shared();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_writer_waits_for_readers()
+{
+    mutex_type mtx;
+    std::atomic<bool> writer_done(false);
+
+    for (int i = 0; i != 10; ++i)
+    {
+        // the writer suspends until the reader has left
+        mtx.lock_shared();
+        hpx::future<void> writer = hpx::async([&]() {
+            std::lock_guard<mutex_type> l(mtx);
+            writer_done.store(true);
+        });
+
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+        HPX_TEST(!writer_done.load());
+
+        mtx.unlock_shared();
+        writer.get();
+        HPX_TEST(writer_done.exchange(false));
+
+        // readers are admitted while the bias is revoked
+        mtx.lock_shared();
+        HPX_TEST(!mtx.try_lock());
+        mtx.unlock_shared();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_readers_and_writers()
+{
+    mutex_type mtx;
+
+    // the writers keep both values equal, the readers verify this
+    std::size_t value1 = 0;
+    std::size_t value2 = 0;
+    std::atomic<std::size_t> active_readers(0);
+    std::atomic<bool> writer_active(false);
+
+    std::vector<hpx::future<void>> threads;
+    for (int i = 0; i != NUM_THREADS; ++i)
+    {
+        if (i % 8 == 0)
+        {
+            threads.push_back(hpx::async([&]() {
+                for (int j = 0; j != NUM_ITERATIONS; ++j)
+                {
+                    std::unique_lock<mutex_type> l(mtx);
+
+                    HPX_TEST(!writer_active.exchange(true));
+                    HPX_TEST_EQ(active_readers.load(), std::size_t(0));
+
+                    ++value1;
+                    hpx::this_thread::yield();
+                    ++value2;
+
+                    writer_active.store(false);
+                }
+            }));
+        }
+        else
+        {
+            threads.push_back(hpx::async([&]() {
+                for (int j = 0; j != NUM_ITERATIONS; ++j)
+                {
+                    std::shared_lock<mutex_type> l(mtx);
+
+                    ++active_readers;
+                    HPX_TEST(!writer_active.load());
+                    HPX_TEST_EQ(value1, value2);
+
+                    // readers may migrate while holding the lock
+                    hpx::this_thread::yield();
+                    --active_readers;
+                }
+            }));
+        }
+    }
+
+    hpx::wait_all(threads);
+
+    HPX_TEST_EQ(value1, std::size_t(NUM_THREADS / 8 * NUM_ITERATIONS));
+    HPX_TEST_EQ(value2, value1);
+}
+
+int hpx_main()
+{
+    test_try_lock();
+    test_writer_waits_for_readers();
+    test_readers_and_writers();
+
+    hpx::local::finalize();
+    return hpx::util::report_errors();
+}
+
+int main(int argc, char* argv[])
+{
+    return hpx::local::init(hpx_main, argc, argv);
+}
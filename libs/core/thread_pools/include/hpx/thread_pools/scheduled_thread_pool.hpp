@@ -76,6 +76,8 @@ namespace hpx { namespace threads { namespace detail {
 
         thread_id_ref_type create_work(
             thread_init_data& data, error_code& ec) override;
+        void create_work_batch(thread_init_data* data, std::size_t count,
+            error_code& ec) override;
 
         thread_state set_state(thread_id_type const& id,
             thread_schedule_state new_state, thread_restart_state new_state_ex,
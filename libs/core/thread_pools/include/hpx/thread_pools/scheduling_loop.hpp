@@ -13,6 +13,8 @@
 #include <hpx/hardware/timestamp.hpp>
 #include <hpx/modules/itt_notify.hpp>
 #include <hpx/modules/logging.hpp>
+#include <hpx/threading_base/detail/lifo_slot.hpp>
+#include <hpx/threading_base/detail/wait_time_samples.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -619,12 +621,50 @@ namespace hpx { namespace threads { namespace detail {
             context_storage =
                 hpx::execution_base::this_thread::detail::get_agent_storage();
 
+        // threads made ready by threads running on this worker are placed
+        // into the LIFO slot and run next, but not more than
+        // max_lifo_slot_runs times in a row to avoid starving the queues
+        std::int64_t const max_lifo_slot_runs =
+            scheduler.SchedulingPolicy::get_max_lifo_slot_runs();
+        std::int64_t lifo_slot_runs = 0;
+
+        lifo_slot slot{max_lifo_slot_runs > 0 ? &scheduler : nullptr,
+            num_thread, thread_id_ref_type()};
+        lifo_slot_scope slot_scope(slot);
+
         std::size_t added = std::size_t(-1);
         thread_id_ref_type next_thrd;
         while (true)
         {
             thread_id_ref_type thrd = HPX_MOVE(next_thrd);
 
+            // wake the threads waiting for expired timers of this worker
+            scheduler.SchedulingPolicy::expire_timers(num_thread);
+
+            if (!thrd)
+            {
+                if (!slot.thrd)
+                {
+                    lifo_slot_runs = 0;
+                }
+                else if (lifo_slot_runs < max_lifo_slot_runs)
+                {
+                    thrd = HPX_MOVE(slot.thrd);
+                    ++lifo_slot_runs;
+                }
+                else
+                {
+                    auto const priority =
+                        get_thread_id_data(slot.thrd)->get_priority();
+                    scheduler.SchedulingPolicy::schedule_thread(
+                        HPX_MOVE(slot.thrd),
+                        threads::thread_schedule_hint(
+                            static_cast<std::int16_t>(num_thread)),
+                        true, priority);
+                    lifo_slot_runs = 0;
+                }
+            }
+
             // Get the next HPX thread from the queue
             bool running = this_state.load(std::memory_order_relaxed) <
                 hpx::state::pre_sleep;
@@ -682,6 +722,18 @@ namespace hpx { namespace threads { namespace detail {
                                 thrd_stat.get_previous(),
                                 thread_schedule_state::active);
 
+                            // sample the time it took for the thread to run
+                            // for the first time
+                            if (std::uint64_t const creation_time =
+                                    get_thread_id_data(thrd)
+                                        ->get_creation_time();
+                                HPX_UNLIKELY(creation_time != 0))
+                            {
+                                record_wait_time(wait_time_kind::first_run,
+                                    creation_time);
+                                get_thread_id_data(thrd)->set_creation_time(0);
+                            }
+
                             tfunc_time_wrapper tfunc_time_collector(idle_rate);
 
                             // thread returns new required state
@@ -883,6 +935,13 @@ namespace hpx { namespace threads { namespace detail {
             {
                 ++idle_loop_count;
 
+                // while idling, wake the threads waiting for expired timers
+                // of other (possibly busy) worker threads as well
+                if (scheduler.SchedulingPolicy::expire_timers(num_thread, true))
+                {
+                    idle_loop_count = 0;
+                }
+
                 if (scheduler.SchedulingPolicy::wait_or_add_new(num_thread,
                         running, idle_loop_count, enable_stealing_staged,
                         added))
@@ -11,9 +11,17 @@
 #include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/threading_base_fwd.hpp>
 
+#include <cstddef>
+
 namespace hpx { namespace threads { namespace detail {
 
     HPX_CORE_EXPORT thread_id_ref_type create_work(
         policies::scheduler_base* scheduler, threads::thread_init_data& data,
         error_code& ec = throws);
+
+    // Create the given number of threads at once. All threads have to be
+    // created in the pending state, no ids are returned.
+    HPX_CORE_EXPORT void create_work_batch(policies::scheduler_base* scheduler,
+        threads::thread_init_data* data, std::size_t count,
+        error_code& ec = throws);
 }}}    // namespace hpx::threads::detail
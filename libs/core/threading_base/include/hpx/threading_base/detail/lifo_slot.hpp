@@ -0,0 +1,57 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <cstddef>
+
+namespace hpx { namespace threads { namespace detail {
+
+    // Every worker thread running a scheduling loop owns a slot holding the
+    // HPX thread most recently made ready by an HPX thread running on this
+    // worker. The scheduling loop runs the thread held by the slot before
+    // looking at the queues of the scheduler, which keeps the caches warm for
+    // continuations waiting on the data produced by the thread readying them.
+    struct lifo_slot
+    {
+        policies::scheduler_base* scheduler = nullptr;
+        std::size_t num_thread = std::size_t(-1);
+        thread_id_ref_type thrd;
+    };
+
+    // Install the given slot for the calling worker thread for the lifetime
+    // of this object. Any thread left in the slot on destruction is handed
+    // back to the scheduler.
+    class HPX_CORE_EXPORT lifo_slot_scope
+    {
+    public:
+        explicit lifo_slot_scope(lifo_slot& slot) noexcept;
+        ~lifo_slot_scope();
+
+        lifo_slot_scope(lifo_slot_scope const&) = delete;
+        lifo_slot_scope(lifo_slot_scope&&) = delete;
+        lifo_slot_scope& operator=(lifo_slot_scope const&) = delete;
+        lifo_slot_scope& operator=(lifo_slot_scope&&) = delete;
+
+    private:
+        lifo_slot& slot_;
+        lifo_slot* previous_;
+    };
+
+    // Try to place the given (pending) thread into the slot of the calling
+    // worker thread. This succeeds only if the calling worker thread runs the
+    // scheduling loop of the given scheduler, the thread has normal priority
+    // and the schedule hint does not refer to a different worker thread. The
+    // thread previously held by the slot (if any) is scheduled normally. As
+    // the thread held by the slot can't be stolen, an idle worker thread is
+    // woken if other work is queued on the calling worker thread.
+    HPX_CORE_EXPORT bool schedule_thread_lifo(
+        policies::scheduler_base* scheduler, thread_id_ref_type& thrd,
+        thread_schedule_hint schedulehint, thread_priority priority);
+}}}    // namespace hpx::threads::detail
@@ -0,0 +1,57 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace hpx { namespace threads { namespace detail {
+
+    // These flags control whether the stack usage of terminated threads is
+    // measured and whether the stack size of new threads is adapted based on
+    // the measurements for their description (annotation or action name).
+    HPX_CORE_EXPORT extern bool track_stack_usage;
+    HPX_CORE_EXPORT extern bool adapt_stack_size;
+
+    // Enable or disable the tracking of stack usage. This has to be called
+    // before any threads are created, as the stacks are painted when they
+    // are allocated.
+    HPX_CORE_EXPORT void set_stack_usage_tracking(
+        bool track, bool adaptive) noexcept;
+
+    // Return whether the stack usage of a new thread with the given
+    // description should be measured once it terminates. Scanning a stack
+    // is expensive, thus only the first 16 threads of each description and
+    // every 16th thread after that are measured.
+    HPX_CORE_EXPORT bool sample_stack_usage(
+        util::thread_description const& desc);
+
+    // Record the number of bytes of stack used by a terminated thread with
+    // the given description.
+    HPX_CORE_EXPORT void record_stack_usage(
+        util::thread_description const& desc, std::size_t usage);
+
+    // Return the smallest stack size class which comfortably fits the stack
+    // usage observed so far for threads with the given description, this
+    // may be thread_stacksize::reduced (smaller than the default stack
+    // size). Returns the given stack size class if not enough data is
+    // available or if it is not the default stack size.
+    HPX_CORE_EXPORT thread_stacksize get_adaptive_stack_size(
+        policies::scheduler_base const* scheduler,
+        util::thread_description const& desc, thread_stacksize stacksize);
+
+    // Performance counter data
+    HPX_CORE_EXPORT std::int64_t get_stack_usage_high_water_mark(bool reset);
+    HPX_CORE_EXPORT std::int64_t get_description_stack_usage_high_water_mark(
+        std::string const& description, bool reset);
+    HPX_CORE_EXPORT std::int64_t get_stack_size_adjustment_count(bool reset);
+}}}    // namespace hpx::threads::detail
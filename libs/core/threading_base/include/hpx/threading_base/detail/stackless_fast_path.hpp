@@ -0,0 +1,41 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/threading_base/traits/is_stackless_callable.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace hpx { namespace threads { namespace detail {
+
+    // Record that a thread is run without a stack of its own as its callable
+    // is known not to suspend.
+    HPX_CORE_EXPORT void count_stackless_fast_path() noexcept;
+
+    // Return the stack size to use for a thread running a callable of type
+    // F. Threads requesting the default stack size run stackless if the
+    // callable has opted in using traits::is_stackless_callable.
+    template <typename F>
+    thread_stacksize get_stacksize_for(thread_stacksize stacksize) noexcept
+    {
+        if constexpr (traits::is_stackless_callable_v<std::decay_t<F>>)
+        {
+            if (stacksize == thread_stacksize::default_)
+            {
+                count_stackless_fast_path();
+                return thread_stacksize::nostack;
+            }
+        }
+        return stacksize;
+    }
+
+    // Performance counter data
+    HPX_CORE_EXPORT std::int64_t get_stackless_fast_path_count(bool reset);
+}}}    // namespace hpx::threads::detail
@@ -0,0 +1,155 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace threads { namespace detail {
+
+    class timer_wheel;
+
+    // An entry of a timer wheel. Entries are owned by the code waiting for
+    // the timer to expire (usually they live on the stack of a suspended
+    // thread), the wheel only links them into its slots.
+    struct timer_wheel_entry
+    {
+        explicit timer_wheel_entry(thread_id_ref_type thrd,
+            thread_priority priority = thread_priority::normal) noexcept
+          : thrd_(HPX_MOVE(thrd))
+          , priority_(priority)
+        {
+        }
+
+        timer_wheel_entry(timer_wheel_entry const&) = delete;
+        timer_wheel_entry(timer_wheel_entry&&) = delete;
+        timer_wheel_entry& operator=(timer_wheel_entry const&) = delete;
+        timer_wheel_entry& operator=(timer_wheel_entry&&) = delete;
+
+    private:
+        friend class timer_wheel;
+
+        timer_wheel_entry* next_ = nullptr;
+        timer_wheel_entry** pprev_ = nullptr;
+        timer_wheel* wheel_ = nullptr;
+        std::uint64_t expiry_ = 0;    // in ticks
+        std::size_t level_ = 0;
+
+        // the thread to set to pending once the timer has expired
+        thread_id_ref_type thrd_;
+        thread_priority priority_;
+    };
+
+    // A hierarchical hashed timer wheel (see G. Varghese and T. Lauck,
+    // "Hashed and hierarchical timing wheels"). Adding and removing entries
+    // is O(1), expiring entries is amortized O(1) per entry and per tick.
+    //
+    // The wheel does not run on its own, it has to be advanced by calling
+    // expire() periodically. The threads of all expired entries are handed
+    // back to the caller, which is responsible for waking them. The
+    // scheduler advances the wheels whenever a scheduling loop iterates and
+    // whenever a new timer is added. Timers may thus expire late by up to
+    // the time a worker thread spends running a single HPX thread, unless
+    // another worker thread is idle (idle worker threads never sleep past
+    // the next expiry).
+    class HPX_CORE_EXPORT timer_wheel
+    {
+    public:
+        // one tick of the wheel is 2^16ns (~65us)
+        static constexpr std::uint64_t tick_shift = 16;
+
+        static constexpr std::size_t level_bits = 8;
+        static constexpr std::size_t num_slots = std::size_t(1)
+            << level_bits;
+        static constexpr std::size_t num_levels = 4;
+
+        static constexpr std::uint64_t no_expiry =
+            (std::numeric_limits<std::uint64_t>::max)();
+
+        using expired_entries_type =
+            std::vector<std::pair<thread_id_ref_type, thread_priority>>;
+
+        timer_wheel() noexcept;
+
+        // Create a wheel starting at the given tick.
+        explicit timer_wheel(std::uint64_t current) noexcept;
+
+        timer_wheel(timer_wheel const&) = delete;
+        timer_wheel(timer_wheel&&) = delete;
+        timer_wheel& operator=(timer_wheel const&) = delete;
+        timer_wheel& operator=(timer_wheel&&) = delete;
+
+        // Return the current time in ticks.
+        static std::uint64_t now() noexcept;
+
+        // Convert the given time point to ticks, rounded up such that timers
+        // never expire early.
+        static std::uint64_t to_ticks(
+            std::chrono::steady_clock::time_point abs_time) noexcept;
+
+        // Link the given entry into the wheel. Returns false if the given
+        // time has already passed, in which case the entry is not added.
+        bool add(timer_wheel_entry& entry,
+            std::chrono::steady_clock::time_point abs_time);
+
+        // Same as above, with the expiry and the current time given in
+        // ticks.
+        bool add_at(timer_wheel_entry& entry, std::uint64_t expiry,
+            std::uint64_t current);
+
+        // Unlink the given entry from the wheel. Returns false if the entry
+        // is not linked (anymore), i.e. if it has expired already.
+        static bool remove(timer_wheel_entry& entry);
+
+        // Advance the wheel to the current time and move the threads of all
+        // expired entries to the given vector. Returns false without doing
+        // anything if the wheel is advanced concurrently and try_lock is set.
+        bool expire(expired_entries_type& expired, bool try_lock = false);
+
+        // Same as above, advancing the wheel to the given tick.
+        bool expire_until(expired_entries_type& expired, std::uint64_t target,
+            bool try_lock = false);
+
+        // Return a lower bound for the tick at which the next entry expires
+        // (no_expiry if the wheel is empty).
+        std::uint64_t next_expiry() const noexcept
+        {
+            return next_expiry_.load(std::memory_order_relaxed);
+        }
+
+        std::size_t size() const noexcept
+        {
+            return count_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        void link(timer_wheel_entry& entry) noexcept;
+        void unlink(timer_wheel_entry& entry) noexcept;
+
+        void cascade(std::size_t level) noexcept;
+        void update_next_expiry() noexcept;
+
+        using mutex_type = hpx::util::detail::spinlock;
+
+        mutable mutex_type mtx_;
+        std::atomic<std::uint64_t> next_expiry_;
+        std::atomic<std::size_t> count_;
+
+        std::uint64_t current_;    // the last tick processed
+        std::size_t level_counts_[num_levels];
+        timer_wheel_entry* slots_[num_levels][num_slots];
+    };
+}}}    // namespace hpx::threads::detail
@@ -0,0 +1,89 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hpx { namespace threads { namespace detail {
+
+    enum class wait_time_kind : std::uint8_t
+    {
+        // time a thread spent in a pending queue before being picked up by
+        // the worker thread owning the queue
+        queue = 0,
+
+        // time a thread spent in a pending queue before being stolen by
+        // another worker thread
+        steal = 1,
+
+        // time from creating a thread until it runs for the first time
+        first_run = 2
+    };
+
+    inline constexpr std::size_t num_wait_time_kinds = 3;
+
+    // Only every Nth event on a worker thread is timed, zero disables the
+    // sampling altogether.
+    HPX_CORE_EXPORT extern std::uint32_t wait_time_sample_interval;
+
+    HPX_CORE_EXPORT void set_wait_time_sample_interval(
+        std::uint32_t interval) noexcept;
+
+    HPX_CORE_EXPORT std::uint64_t sample_wait_time_start_slow() noexcept;
+
+    // Return the current time (in nanoseconds) if the next event on the
+    // calling thread should be sampled, zero otherwise.
+    inline std::uint64_t sample_wait_time_start() noexcept
+    {
+        if (wait_time_sample_interval == 0)
+        {
+            return 0;
+        }
+        return sample_wait_time_start_slow();
+    }
+
+    // Record the time elapsed since the given start time (as returned from
+    // sample_wait_time_start) for the calling worker thread.
+    HPX_CORE_EXPORT void record_wait_time(
+        wait_time_kind kind, std::uint64_t start) noexcept;
+
+    // Start timing the stay of the given thread in a pending queue, if the
+    // next event on the calling thread should be sampled.
+    inline void sample_queued_time_start(thread_data* thrd) noexcept
+    {
+        if (std::uint64_t const now = sample_wait_time_start();
+            HPX_UNLIKELY(now != 0))
+        {
+            thrd->set_queued_time(now);
+        }
+    }
+
+    // Record the time the given thread has spent in a pending queue, if it
+    // was sampled when being queued.
+    inline void record_queued_time(thread_data* thrd, bool stolen) noexcept
+    {
+        if (std::uint64_t const queued_time = thrd->get_queued_time();
+            HPX_UNLIKELY(queued_time != 0))
+        {
+            record_wait_time(
+                stolen ? wait_time_kind::steal : wait_time_kind::queue,
+                queued_time);
+            thrd->set_queued_time(0);
+        }
+    }
+
+    // Performance counter data: return the wait times (in nanoseconds)
+    // recently sampled on the given worker thread (global thread number), or
+    // on all worker threads if num_thread is std::size_t(-1).
+    HPX_CORE_EXPORT std::vector<std::int64_t> get_wait_time_samples(
+        wait_time_kind kind, std::size_t num_thread, bool reset);
+}}}    // namespace hpx::threads::detail
@@ -0,0 +1,85 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#if !defined(__linux) && !defined(linux) && !defined(__linux__)
+#include <condition_variable>
+#include <mutex>
+#endif
+
+namespace hpx { namespace threads { namespace detail {
+
+    // A parking spot for idle worker threads. On Linux the parked workers
+    // block on a futex, elsewhere on a condition variable.
+    //
+    // A worker announces its intent to park (prepare_park) before checking
+    // for work a last time and blocking (park). Code making work available
+    // calls unpark_one afterwards, which is cheap if no worker is parked.
+    // This protocol guarantees that either the parking worker sees the new
+    // work or the waker sees the parked worker.
+    class HPX_CORE_EXPORT worker_parking
+    {
+    public:
+        worker_parking() noexcept
+          : epoch_(0)
+          , num_parked_(0)
+        {
+        }
+
+        worker_parking(worker_parking const&) = delete;
+        worker_parking(worker_parking&&) = delete;
+        worker_parking& operator=(worker_parking const&) = delete;
+        worker_parking& operator=(worker_parking&&) = delete;
+
+        // Announce the intent to park, the returned token has to be passed
+        // to park(). Call cancel_park() instead of park() if work was found.
+        std::uint32_t prepare_park() noexcept
+        {
+            num_parked_.fetch_add(1, std::memory_order_seq_cst);
+            return epoch_.load(std::memory_order_seq_cst);
+        }
+
+        // Withdraw the intent to park.
+        void cancel_park() noexcept
+        {
+            num_parked_.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        // Block the calling thread until it is woken by unpark_one or
+        // unpark_all or the given time has elapsed. Returns whether the
+        // thread was woken before the timeout expired.
+        bool park(std::uint32_t token, std::chrono::nanoseconds timeout);
+
+        // Wake one parked worker, returns false if no worker is parked.
+        bool unpark_one() noexcept;
+
+        // Wake all parked workers.
+        void unpark_all() noexcept;
+
+        std::uint32_t num_parked() const noexcept
+        {
+            return num_parked_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        void wake(bool all) noexcept;
+
+        std::atomic<std::uint32_t> epoch_;
+        std::atomic<std::uint32_t> num_parked_;
+
+#if !defined(__linux) && !defined(linux) && !defined(__linux__)
+        std::mutex mtx_;
+        std::condition_variable cond_;
+#endif
+    };
+}}}    // namespace hpx::threads::detail
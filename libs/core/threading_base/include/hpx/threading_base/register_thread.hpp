@@ -209,6 +209,33 @@ namespace hpx { namespace threads {
     {
         return register_work(data, detail::get_self_or_default_pool(), ec);
     }
+
+    /// \brief Create a batch of new work items using the given data.
+    ///
+    /// \param data       [in] The data to use for creating the threads. All
+    ///                   threads have to be created in the pending state.
+    /// \param count      [in] The number of threads to create.
+    /// \param pool       [in] The thread pool to use for launching the work.
+    /// \param ec         [in,out] This represents the error status on exit,
+    ///                   if this is pre-initialized to \a hpx#throws
+    ///                   the function will throw on error instead.
+    ///
+    /// \throws invalid_status if the runtime system has not been started yet.
+    ///
+    /// \note             The scheduler distributes the threads over its
+    ///                   queues, updates its counters, and wakes up worker
+    ///                   threads only once for the whole batch.
+    inline void register_work_batch(threads::thread_init_data* data,
+        std::size_t count, threads::thread_pool_base* pool,
+        error_code& ec = throws)
+    {
+        HPX_ASSERT(pool);
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            data[i].run_now = false;
+        }
+        pool->create_work_batch(data, count, ec);
+    }
 }}    // namespace hpx::threads
 
 /// \endcond
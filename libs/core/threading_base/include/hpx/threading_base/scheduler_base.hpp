@@ -12,6 +12,8 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+#include <hpx/threading_base/detail/worker_parking.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -24,6 +26,7 @@
 #endif
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
@@ -97,12 +100,29 @@ namespace hpx { namespace threads { namespace policies {
 
         /// This function gets called by the thread-manager whenever new work
         /// has been added, allowing the scheduler to reactivate one or more of
-        /// possibly idling OS threads
-        void do_some_work(std::size_t);
+        /// possibly idling OS threads. A parked thread in the NUMA domain of
+        /// the given thread is preferred. Returns false if no thread was
+        /// parked.
+        bool do_some_work(std::size_t num_thread);
 
         virtual void suspend(std::size_t num_thread);
         virtual void resume(std::size_t num_thread);
 
+        /// Register the given entry with the timer wheel of the calling
+        /// worker thread. The thread referenced by the entry will be set to
+        /// pending once the given point in time has been reached. Returns
+        /// false if the given point in time has passed already.
+        bool add_timer(threads::detail::timer_wheel_entry& entry,
+            std::chrono::steady_clock::time_point abs_time);
+
+        /// Cancel the given timer, returns false if it has expired already.
+        static bool remove_timer(threads::detail::timer_wheel_entry& entry);
+
+        /// Wake the threads of all expired timers of the given worker thread
+        /// (of all worker threads if steal is set). Returns whether any
+        /// thread has been woken.
+        bool expire_timers(std::size_t num_thread, bool steal = false);
+
         std::size_t select_active_pu(std::unique_lock<pu_mutex_type>& l,
             std::size_t num_thread, bool allow_fallback = false);
 
@@ -222,6 +242,12 @@ namespace hpx { namespace threads { namespace policies {
         virtual void create_thread(
             thread_init_data& data, thread_id_ref_type* id, error_code& ec) = 0;
 
+        // Create the given number of threads at once. The threads have to be
+        // created in the pending state. The default implementation creates
+        // the threads one by one.
+        virtual void create_thread_batch(
+            thread_init_data* data, std::size_t count, error_code& ec);
+
         virtual bool get_next_thread(std::size_t num_thread, bool running,
             threads::thread_id_ref_type& thrd, bool enable_stealing) = 0;
 
@@ -278,6 +304,9 @@ namespace hpx { namespace threads { namespace policies {
             case thread_stacksize::huge:
                 return thread_queue_init_.huge_stacksize_;
 
+            case thread_stacksize::reduced:
+                return thread_queue_init_.reduced_stacksize_;
+
             case thread_stacksize::nostack:
                 return (std::numeric_limits<std::ptrdiff_t>::max)();
 
@@ -290,6 +319,13 @@ namespace hpx { namespace threads { namespace policies {
             return thread_queue_init_.small_stacksize_;
         }
 
+        // Return the maximal number of consecutive threads a worker thread
+        // may run from its LIFO slot, zero if the LIFO slot is disabled.
+        std::int64_t get_max_lifo_slot_runs() const noexcept
+        {
+            return thread_queue_init_.max_lifo_slot_runs_;
+        }
+
         using polling_function_ptr = detail::polling_status (*)();
         using polling_work_count_function_ptr = std::size_t (*)();
 
@@ -370,13 +406,19 @@ namespace hpx { namespace threads { namespace policies {
         }
 
     protected:
+        // Wake all parked worker threads, used whenever the scheduler state
+        // or mode changes.
+        void unpark_all_workers() noexcept;
+
         // the scheduler mode, protected from false sharing
         util::cache_line_data<std::atomic<scheduler_mode>> mode_;
 
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        // support for suspension on idle queues
-        pu_mutex_type mtx_;
-        std::condition_variable cond_;
+        // support for parking worker threads on idle queues, there is one
+        // parking spot for each NUMA domain
+        std::vector<std::unique_ptr<threads::detail::worker_parking>>
+            parking_;
+        std::vector<std::atomic<std::size_t>> parking_domains_;
         struct idle_backoff_data
         {
             std::uint32_t wait_count_;
@@ -385,6 +427,10 @@ namespace hpx { namespace threads { namespace policies {
         std::vector<util::cache_line_data<idle_backoff_data>> wait_counts_;
 #endif
 
+        // timer wheels used for timed thread state changes, one per worker
+        std::vector<std::unique_ptr<threads::detail::timer_wheel>>
+            timer_wheels_;
+
         // support for suspension of pus
         std::vector<pu_mutex_type> suspend_mtxs_;
         std::vector<std::condition_variable> suspend_conds_;
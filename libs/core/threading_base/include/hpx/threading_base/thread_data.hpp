@@ -547,6 +547,33 @@ namespace hpx { namespace threads {
             return *static_cast<ThreadQueue*>(queue_);
         }
 
+        // Recycled thread objects may be handed over to a different queue
+        // before being rebound.
+        void set_queue(void* queue) noexcept
+        {
+            queue_ = queue;
+        }
+
+        // Time stamps used for sampling the wait times of this thread, zero
+        // if the thread is not being sampled.
+        std::uint64_t get_creation_time() const noexcept
+        {
+            return creation_time_;
+        }
+        void set_creation_time(std::uint64_t t) noexcept
+        {
+            creation_time_ = t;
+        }
+
+        std::uint64_t get_queued_time() const noexcept
+        {
+            return queued_time_;
+        }
+        void set_queued_time(std::uint64_t t) noexcept
+        {
+            queued_time_ = t;
+        }
+
         /// \brief Execute the thread function
         ///
         /// \returns        This function returns the thread state the thread
@@ -658,6 +685,9 @@ namespace hpx { namespace threads {
 
         void* queue_;
 
+        std::uint64_t creation_time_;
+        std::uint64_t queued_time_;
+
     public:
 #if defined(HPX_HAVE_APEX)
         std::shared_ptr<util::external_timer::task_wrapper> timer_data_;
@@ -14,6 +14,7 @@
 #include <hpx/coroutines/thread_id_type.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/detail/stack_usage.hpp>
 #include <hpx/threading_base/execution_agent.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
@@ -65,7 +66,25 @@ namespace hpx { namespace threads {
 
             hpx::execution_base::this_thread::reset_agent ctx(
                 agent_storage, agent_);
-            return coroutine_(set_state_ex(thread_restart_state::signaled));
+            coroutine_type::result_type result =
+                coroutine_(set_state_ex(thread_restart_state::signaled));
+
+            // measure the stack usage while not running on this stack
+            if (HPX_UNLIKELY(detail::track_stack_usage) &&
+                result.first == thread_schedule_state::terminated)
+            {
+                if (measure_stack_usage_)
+                {
+                    detail::record_stack_usage(this->get_description(),
+                        static_cast<std::size_t>(
+                            coroutine_.get_stack_usage()));
+                }
+                else
+                {
+                    stack_dirty_ = true;
+                }
+            }
+            return result;
         }
 
 #if defined(HPX_DEBUG)
@@ -134,6 +153,20 @@ namespace hpx { namespace threads {
         {
             this->thread_data::rebind_base(init_data);
 
+            if (HPX_UNLIKELY(detail::track_stack_usage))
+            {
+                measure_stack_usage_ =
+                    detail::sample_stack_usage(this->get_description());
+
+                // measuring repaints the stack, this discards the usage of
+                // earlier threads which have not been measured
+                if (measure_stack_usage_ && stack_dirty_)
+                {
+                    coroutine_.get_stack_usage();
+                    stack_dirty_ = false;
+                }
+            }
+
             coroutine_.rebind(HPX_MOVE(init_data.func), thread_id_type(this));
 
             HPX_ASSERT(coroutine_.is_ready());
@@ -147,6 +180,13 @@ namespace hpx { namespace threads {
           , agent_(coroutine_.impl())
         {
             HPX_ASSERT(coroutine_.is_ready());
+
+            // new stacks are painted as a whole
+            if (HPX_UNLIKELY(detail::track_stack_usage))
+            {
+                measure_stack_usage_ =
+                    detail::sample_stack_usage(this->get_description());
+            }
         }
 
         ~thread_data_stackful();
@@ -164,6 +204,12 @@ namespace hpx { namespace threads {
     private:
         coroutine_type coroutine_;
         execution_agent agent_;
+
+        // whether the stack usage of this thread is measured when it
+        // terminates, and whether the stack has been used since it was
+        // painted the last time
+        bool measure_stack_usage_ = false;
+        bool stack_dirty_ = false;
     };
 
     ////////////////////////////////////////////////////////////////////////////
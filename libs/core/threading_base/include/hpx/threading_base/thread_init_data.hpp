@@ -45,6 +45,7 @@ namespace hpx { namespace threads {
           , initial_state(thread_schedule_state::pending)
           , run_now(false)
           , scheduler_base(nullptr)
+          , creation_time(0)
         {
             if (initial_state == thread_schedule_state::staged)
             {
@@ -63,6 +64,7 @@ namespace hpx { namespace threads {
             initial_state = rhs.initial_state;
             run_now = rhs.run_now;
             scheduler_base = rhs.scheduler_base;
+            creation_time = rhs.creation_time;
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
             description = HPX_MOVE(rhs.description);
 #endif
@@ -101,6 +103,7 @@ namespace hpx { namespace threads {
           , initial_state(rhs.initial_state)
           , run_now(rhs.run_now)
           , scheduler_base(rhs.scheduler_base)
+          , creation_time(rhs.creation_time)
         {
         }
 
@@ -134,6 +137,7 @@ namespace hpx { namespace threads {
           , initial_state(initial_state_)
           , run_now(run_now_)
           , scheduler_base(scheduler_base_)
+          , creation_time(0)
         {
             HPX_UNUSED(desc);
 
@@ -168,5 +172,9 @@ namespace hpx { namespace threads {
         bool run_now;
 
         policies::scheduler_base* scheduler_base;
+
+        // time stamp used for sampling the time until the thread runs for the
+        // first time, zero if the thread is not sampled
+        std::uint64_t creation_time;
     };
 }}    // namespace hpx::threads
@@ -188,6 +188,8 @@ namespace hpx { namespace threads {
             thread_init_data& data, thread_id_ref_type& id, error_code& ec) = 0;
         virtual thread_id_ref_type create_work(
             thread_init_data& data, error_code& ec) = 0;
+        virtual void create_work_batch(
+            thread_init_data* data, std::size_t count, error_code& ec);
 
         virtual thread_state set_state(thread_id_type const& id,
             thread_schedule_state new_state, thread_restart_state new_state_ex,
@@ -220,6 +222,10 @@ namespace hpx { namespace threads {
         mask_type get_used_processing_units() const;
         hwloc_bitmap_ptr get_numa_domain_bitmap() const;
 
+        /// Return the number of the NUMA domain the given (local) worker
+        /// thread is bound to.
+        std::size_t get_numa_node_number(std::size_t thread_num) const;
+
         // performance counters
 #if defined(HPX_HAVE_THREAD_CUMULATIVE_COUNTS)
         virtual std::int64_t get_executed_threads(
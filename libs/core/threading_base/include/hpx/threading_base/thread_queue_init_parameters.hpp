@@ -39,7 +39,13 @@ namespace hpx { namespace threads { namespace policies {
             std::ptrdiff_t small_stacksize = HPX_SMALL_STACK_SIZE,
             std::ptrdiff_t medium_stacksize = HPX_MEDIUM_STACK_SIZE,
             std::ptrdiff_t large_stacksize = HPX_LARGE_STACK_SIZE,
-            std::ptrdiff_t huge_stacksize = HPX_HUGE_STACK_SIZE)
+            std::ptrdiff_t huge_stacksize = HPX_HUGE_STACK_SIZE,
+            std::ptrdiff_t reduced_stacksize = HPX_REDUCED_STACK_SIZE,
+            std::int64_t max_recycled_thread_count = std::int64_t(
+                HPX_THREAD_QUEUE_MAX_RECYCLED_THREAD_COUNT),
+            std::int64_t max_lifo_slot_runs = std::int64_t(
+                HPX_THREAD_QUEUE_MAX_LIFO_SLOT_RUNS),
+            bool lock_free_recycling = HPX_THREAD_QUEUE_LOCK_FREE_RECYCLING)
           : max_thread_count_(max_thread_count)
           , min_tasks_to_steal_pending_(min_tasks_to_steal_pending)
           , min_tasks_to_steal_staged_(min_tasks_to_steal_staged)
@@ -54,7 +60,11 @@ namespace hpx { namespace threads { namespace policies {
           , medium_stacksize_(medium_stacksize)
           , large_stacksize_(large_stacksize)
           , huge_stacksize_(huge_stacksize)
+          , reduced_stacksize_(reduced_stacksize)
           , nostack_stacksize_((std::numeric_limits<std::ptrdiff_t>::max)())
+          , max_recycled_thread_count_(max_recycled_thread_count)
+          , max_lifo_slot_runs_(max_lifo_slot_runs)
+          , lock_free_recycling_(lock_free_recycling)
         {
         }
 
@@ -72,6 +82,10 @@ namespace hpx { namespace threads { namespace policies {
         std::ptrdiff_t const medium_stacksize_;
         std::ptrdiff_t const large_stacksize_;
         std::ptrdiff_t const huge_stacksize_;
+        std::ptrdiff_t const reduced_stacksize_;
         std::ptrdiff_t const nostack_stacksize_;
+        std::int64_t max_recycled_thread_count_;
+        std::int64_t max_lifo_slot_runs_;
+        bool lock_free_recycling_;
     };
 }}}    // namespace hpx::threads::policies
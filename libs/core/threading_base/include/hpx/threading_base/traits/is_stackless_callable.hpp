@@ -0,0 +1,41 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/functional/deferred_call.hpp>
+
+#include <type_traits>
+
+namespace hpx { namespace traits {
+
+    // Specialize this for callable types which never suspend the thread
+    // running them (they never block on a synchronization primitive, never
+    // wait for a future which is not ready, and never yield). Threads
+    // running such callables which are launched with the default stack size
+    // (e.g. using hpx::apply) run directly on the stack of the worker thread,
+    // as if thread_stacksize::nostack was requested.
+    //
+    // A stackless thread which blocks nevertheless blocks the worker thread
+    // it runs on until it is woken up.
+    template <typename F, typename Enable = void>
+    struct is_stackless_callable : std::false_type
+    {
+    };
+
+    // A deferred call (as created by hpx::async) does not suspend if the
+    // wrapped callable does not.
+    template <typename F, typename Is, typename... Ts>
+    struct is_stackless_callable<util::detail::deferred<F, Is, Ts...>>
+      : is_stackless_callable<F>
+    {
+    };
+
+    template <typename F>
+    inline constexpr bool is_stackless_callable_v =
+        is_stackless_callable<F>::value;
+}}    // namespace hpx::traits
@@ -9,88 +9,123 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/threading_base/create_work.hpp>
+#include <hpx/threading_base/detail/stack_usage.hpp>
+#include <hpx/threading_base/detail/wait_time_samples.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 
+#include <cstddef>
+
 namespace hpx { namespace threads { namespace detail {
 
-    thread_id_ref_type create_work(policies::scheduler_base* scheduler,
-        threads::thread_init_data& data, error_code& ec)
-    {
-        // verify parameters
-        switch (data.initial_state)
-        {
-        case thread_schedule_state::pending:
-        case thread_schedule_state::pending_do_not_schedule:
-        case thread_schedule_state::pending_boost:
-        case thread_schedule_state::suspended:
-            break;
+    namespace {
 
-        default:
+        // Verify the given thread data and fill in everything which is
+        // derived from the calling thread or the scheduler. Returns false if
+        // the data is invalid.
+        bool prepare_work(policies::scheduler_base* scheduler,
+            threads::thread_init_data& data, thread_self* self,
+            error_code& ec)
         {
-            HPX_THROWS_IF(ec, bad_parameter, "thread::detail::create_work",
-                "invalid initial state: {}", data.initial_state);
-            return invalid_thread_id;
-        }
-        }
+            // verify parameters
+            switch (data.initial_state)
+            {
+            case thread_schedule_state::pending:
+            case thread_schedule_state::pending_do_not_schedule:
+            case thread_schedule_state::pending_boost:
+            case thread_schedule_state::suspended:
+                break;
+
+            default:
+            {
+                HPX_THROWS_IF(ec, bad_parameter, "thread::detail::create_work",
+                    "invalid initial state: {}", data.initial_state);
+                return false;
+            }
+            }
 
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
-        if (!data.description)
-        {
-            HPX_THROWS_IF(ec, bad_parameter, "thread::detail::create_work",
-                "description is nullptr");
-            return invalid_thread_id;
-        }
+            if (!data.description)
+            {
+                HPX_THROWS_IF(ec, bad_parameter, "thread::detail::create_work",
+                    "description is nullptr");
+                return false;
+            }
 #endif
 
-        LTM_(info)
-            .format("create_work: pool({}), scheduler({}), initial_state({}), "
-                    "thread_priority({})",
-                *scheduler->get_parent_pool(), *scheduler,
-                get_thread_state_name(data.initial_state),
-                get_thread_priority_name(data.priority))
+            LTM_(info)
+                .format("create_work: pool({}), scheduler({}), "
+                        "initial_state({}), thread_priority({})",
+                    *scheduler->get_parent_pool(), *scheduler,
+                    get_thread_state_name(data.initial_state),
+                    get_thread_priority_name(data.priority))
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
-            .format(", description({})", data.description)
+                .format(", description({})", data.description)
 #endif
-            ;
-
-        thread_self* self = get_self_ptr();
+                ;
 
 #ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
-        if (nullptr == data.parent_id)
-        {
-            if (self)
+            if (nullptr == data.parent_id)
             {
-                data.parent_id = get_thread_id_data(self->get_thread_id());
-                data.parent_phase = self->get_thread_phase();
+                if (self)
+                {
+                    data.parent_id = get_thread_id_data(self->get_thread_id());
+                    data.parent_phase = self->get_thread_phase();
+                }
             }
-        }
-        if (0 == data.parent_locality_id)
-            data.parent_locality_id = detail::get_locality_id(hpx::throws);
+            if (0 == data.parent_locality_id)
+                data.parent_locality_id = detail::get_locality_id(hpx::throws);
 #endif
 
-        if (nullptr == data.scheduler_base)
-            data.scheduler_base = scheduler;
+            if (nullptr == data.scheduler_base)
+                data.scheduler_base = scheduler;
 
-        // Pass critical priority from parent to child.
-        if (self)
-        {
-            if (data.priority == thread_priority::default_ &&
-                thread_priority::high_recursive ==
-                    get_thread_id_data(self->get_thread_id())->get_priority())
+            // Pass critical priority from parent to child.
+            if (self)
             {
-                data.priority = thread_priority::high_recursive;
+                if (data.priority == thread_priority::default_ &&
+                    thread_priority::high_recursive ==
+                        get_thread_id_data(self->get_thread_id())
+                            ->get_priority())
+                {
+                    data.priority = thread_priority::high_recursive;
+                }
             }
-        }
 
-        // create the new thread
-        if (data.priority == thread_priority::default_)
-            data.priority = thread_priority::normal;
+            // create the new thread
+            if (data.priority == thread_priority::default_)
+                data.priority = thread_priority::normal;
 
-        data.run_now = (thread_priority::high == data.priority ||
-            thread_priority::high_recursive == data.priority ||
-            thread_priority::boost == data.priority);
+            data.run_now = (thread_priority::high == data.priority ||
+                thread_priority::high_recursive == data.priority ||
+                thread_priority::boost == data.priority);
+
+#ifdef HPX_HAVE_THREAD_DESCRIPTION
+            // select the stack size based on the stack usage of earlier
+            // threads with the same description, unless a specific stack
+            // size was requested
+            if (detail::adapt_stack_size &&
+                data.stacksize == thread_stacksize::default_)
+            {
+                data.stacksize = detail::get_adaptive_stack_size(
+                    scheduler, data.description, data.stacksize);
+            }
+#endif
+
+            // sample the time until the new thread runs for the first time
+            data.creation_time = detail::sample_wait_time_start();
+            return true;
+        }
+    }    // namespace
+
+    thread_id_ref_type create_work(policies::scheduler_base* scheduler,
+        threads::thread_init_data& data, error_code& ec)
+    {
+        if (!prepare_work(scheduler, data, get_self_ptr(), ec))
+        {
+            return invalid_thread_id;
+        }
 
         thread_id_ref_type id = invalid_thread_id;
         scheduler->create_thread(data, data.run_now ? &id : nullptr, ec);
@@ -101,4 +136,56 @@ namespace hpx { namespace threads { namespace detail {
 
         return id;
     }
+
+    void create_work_batch(policies::scheduler_base* scheduler,
+        threads::thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        thread_self* self = get_self_ptr();
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            // the created threads are not referenced by anybody, thus they
+            // have to be scheduled right away
+            if (data[i].initial_state != thread_schedule_state::pending)
+            {
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "thread::detail::create_work_batch",
+                    "invalid initial state: {}", data[i].initial_state);
+                return;
+            }
+
+            if (!prepare_work(scheduler, data[i], self, ec))
+            {
+                return;
+            }
+        }
+
+        scheduler->create_thread_batch(data, count, ec);
+
+        // wake up a worker for each run of threads targeting the same worker
+        // thread and for each thread without a target, but stop as soon as
+        // no more workers are parked
+        thread_schedule_hint previous;
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            thread_schedule_hint const hint = data[i].schedulehint;
+            if (hint.mode != thread_schedule_hint_mode::none)
+            {
+                if (hint == previous)
+                {
+                    continue;
+                }
+                previous = hint;
+            }
+
+            if (!scheduler->do_some_work(hint.hint))
+            {
+                break;
+            }
+        }
+    }
 }}}    // namespace hpx::threads::detail
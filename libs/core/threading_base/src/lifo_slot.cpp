@@ -0,0 +1,99 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/detail/lifo_slot.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace hpx { namespace threads { namespace detail {
+
+    namespace {
+
+        lifo_slot*& get_lifo_slot() noexcept
+        {
+            static thread_local lifo_slot* slot = nullptr;
+            return slot;
+        }
+    }    // namespace
+
+    lifo_slot_scope::lifo_slot_scope(lifo_slot& slot) noexcept
+      : slot_(slot)
+      , previous_(get_lifo_slot())
+    {
+        get_lifo_slot() = &slot_;
+    }
+
+    lifo_slot_scope::~lifo_slot_scope()
+    {
+        get_lifo_slot() = previous_;
+
+        if (slot_.thrd)
+        {
+            auto const priority =
+                get_thread_id_data(slot_.thrd)->get_priority();
+            slot_.scheduler->schedule_thread(HPX_MOVE(slot_.thrd),
+                thread_schedule_hint(
+                    static_cast<std::int16_t>(slot_.num_thread)),
+                true, priority);
+        }
+    }
+
+    bool schedule_thread_lifo(policies::scheduler_base* scheduler,
+        thread_id_ref_type& thrd, thread_schedule_hint schedulehint,
+        thread_priority priority)
+    {
+        lifo_slot* slot = get_lifo_slot();
+        if (slot == nullptr || slot->scheduler != scheduler ||
+            (priority != thread_priority::normal &&
+                priority != thread_priority::default_))
+        {
+            return false;
+        }
+
+        if (schedulehint.mode == thread_schedule_hint_mode::numa ||
+            (schedulehint.mode == thread_schedule_hint_mode::thread &&
+                static_cast<std::size_t>(schedulehint.hint) !=
+                    slot->num_thread))
+        {
+            return false;
+        }
+
+        // a stackless thread blocking after readying the thread would block
+        // the worker thread and with it the thread held by the slot
+        thread_data const* self = get_self_id_data();
+        if (self != nullptr && self->is_stackless())
+        {
+            return false;
+        }
+
+        thread_id_ref_type previous = HPX_MOVE(slot->thrd);
+        slot->thrd = HPX_MOVE(thrd);
+
+        // the displaced thread goes to the back of our own queue, from where
+        // other worker threads can steal it
+        if (previous)
+        {
+            scheduler->schedule_thread(HPX_MOVE(previous),
+                thread_schedule_hint(
+                    static_cast<std::int16_t>(slot->num_thread)),
+                false, thread_priority::normal);
+        }
+
+        // the thread held by the slot can't be stolen, thus the work queued
+        // behind it has to wait for the current thread to finish as well;
+        // wake an idle worker thread to steal that work instead
+        if (previous || scheduler->get_queue_length(slot->num_thread) != 0)
+        {
+            scheduler->do_some_work(slot->num_thread);
+        }
+        return true;
+    }
+}}}    // namespace hpx::threads::detail
@@ -7,10 +7,15 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/execution_base/this_thread.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+#include <hpx/threading_base/detail/worker_parking.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/set_thread_state.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
 #include <hpx/coroutines/detail/tss.hpp>
@@ -62,10 +67,36 @@ namespace hpx { namespace threads { namespace policies {
             data.data_.wait_count_ = 0;
             data.data_.max_idle_backoff_time_ = max_time;
         }
+
+        std::size_t const num_domains =
+            (std::max)(create_topology().get_number_of_numa_nodes(),
+                std::size_t(1));
+
+        parking_.reserve(num_domains);
+        for (std::size_t i = 0; i != num_domains; ++i)
+        {
+            parking_.push_back(
+                std::make_unique<threads::detail::worker_parking>());
+        }
+
+        // the NUMA domain of a worker thread is determined once it parks
+        // for the first time
+        parking_domains_ = std::vector<std::atomic<std::size_t>>(num_threads);
+        for (auto& domain : parking_domains_)
+        {
+            domain.store(std::size_t(-1), std::memory_order_relaxed);
+        }
 #endif
 
         for (std::size_t i = 0; i != num_threads; ++i)
             states_[i].store(hpx::state::initialized);
+
+        timer_wheels_.reserve(num_threads);
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            timer_wheels_.push_back(
+                std::make_unique<threads::detail::timer_wheel>());
+        }
     }
 
     void scheduler_base::idle_callback(std::size_t num_thread)
@@ -74,25 +105,79 @@ namespace hpx { namespace threads { namespace policies {
         if (mode_.data_.load(std::memory_order_relaxed) &
             policies::scheduler_mode::enable_idle_backoff)
         {
-            // Put this thread to sleep for some time, additionally it gets
-            // woken up on new work.
+            // Park this thread for some time, it gets woken up on new work.
 
             idle_backoff_data& data = wait_counts_[num_thread].data_;
 
-            // Exponential back-off with a maximum sleep time.
+            // Exponential back-off with a maximum sleep time. This matters
+            // only for work which is not announced by calling do_some_work
+            // (e.g. background work), as parked threads are woken otherwise.
             double exponent = (std::min)(double(data.wait_count_),
                 double(std::numeric_limits<double>::max_exponent - 1));
 
-            std::chrono::milliseconds period(std::lround((std::min)(
-                data.max_idle_backoff_time_, std::pow(2.0, exponent))));
+            std::chrono::nanoseconds period =
+                std::chrono::milliseconds(std::lround((std::min)(
+                    data.max_idle_backoff_time_, std::pow(2.0, exponent))));
+
+            // don't sleep past the expiration of the next timer
+            std::uint64_t next_expiry = threads::detail::timer_wheel::no_expiry;
+            for (auto const& wheel : timer_wheels_)
+            {
+                next_expiry = (std::min)(next_expiry, wheel->next_expiry());
+            }
+            if (next_expiry != threads::detail::timer_wheel::no_expiry)
+            {
+                std::uint64_t const now = threads::detail::timer_wheel::now();
+                if (next_expiry <= now)
+                {
+                    return;
+                }
+
+                std::chrono::nanoseconds const until_expiry(
+                    (next_expiry - now)
+                    << threads::detail::timer_wheel::tick_shift);
+                period = (std::min)(period, until_expiry);
+            }
+
+            std::size_t domain =
+                parking_domains_[num_thread].load(std::memory_order_relaxed);
+            if (domain == std::size_t(-1))
+            {
+                domain = 0;
+                if (parent_pool_ != nullptr)
+                {
+                    domain = parent_pool_->get_numa_node_number(num_thread) %
+                        parking_.size();
+                }
+                parking_domains_[num_thread].store(
+                    domain, std::memory_order_relaxed);
+            }
+
+            threads::detail::worker_parking& parking = *parking_[domain];
+            std::uint32_t const token = parking.prepare_park();
+
+            // Check for work a last time after having announced the intent to
+            // park. Any work made available later on will unpark a thread.
+            if (get_queue_length() != 0 ||
+                states_[num_thread].load() > hpx::state::running)
+            {
+                parking.cancel_park();
+                return;
+            }
 
             ++data.wait_count_;
 
-            std::unique_lock<pu_mutex_type> l(mtx_);
-            if (cond_.wait_for(l, period) == std::cv_status::no_timeout)
+            if (parking.park(token, period))
             {
                 // reset counter if thread was woken up
                 data.wait_count_ = 0;
+
+                // if there is more work than this thread is going to pick up,
+                // wake up another one
+                if (get_queue_length() > 1)
+                {
+                    do_some_work(num_thread);
+                }
             }
         }
 #else
@@ -100,20 +185,129 @@ namespace hpx { namespace threads { namespace policies {
 #endif
     }
 
-    /// This function gets called by the thread-manager whenever new work
-    /// has been added, allowing the scheduler to reactivate one or more of
-    /// possibly idling OS threads
-    void scheduler_base::do_some_work(std::size_t)
+    bool scheduler_base::do_some_work(std::size_t num_thread)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        if (mode_.data_.load(std::memory_order_relaxed) &
-            policies::scheduler_mode::enable_idle_backoff)
+        // Wake one parked thread, preferably from the NUMA domain of the
+        // given thread. This is cheap if no thread is parked.
+        std::size_t const num_domains = parking_.size();
+        std::size_t first = 0;
+        if (num_thread < parking_domains_.size())
+        {
+            std::size_t const domain =
+                parking_domains_[num_thread].load(std::memory_order_relaxed);
+            if (domain < num_domains)
+            {
+                first = domain;
+            }
+        }
+
+        for (std::size_t i = 0; i != num_domains; ++i)
+        {
+            if (parking_[(first + i) % num_domains]->unpark_one())
+            {
+                return true;
+            }
+        }
+#else
+        (void) num_thread;
+#endif
+        return false;
+    }
+
+    void scheduler_base::unpark_all_workers() noexcept
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        for (auto const& parking : parking_)
         {
-            cond_.notify_all();
+            parking->unpark_all();
         }
 #endif
     }
 
+    void scheduler_base::create_thread_batch(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            create_thread(data[i], nullptr, ec);
+            if (ec)
+            {
+                return;
+            }
+        }
+    }
+
+    bool scheduler_base::add_timer(threads::detail::timer_wheel_entry& entry,
+        std::chrono::steady_clock::time_point abs_time)
+    {
+        std::size_t num_thread = threads::detail::get_local_thread_num_tss();
+        if (num_thread >= timer_wheels_.size())
+        {
+            num_thread = 0;
+        }
+
+        if (!timer_wheels_[num_thread]->add(entry, abs_time))
+        {
+            return false;
+        }
+
+        // advance the wheel, this wakes the threads of timers which have
+        // expired while this worker thread was busy
+        expire_timers(num_thread);
+
+        // idling worker threads have to take the new timer into account
+        do_some_work(std::size_t(-1));
+        return true;
+    }
+
+    bool scheduler_base::remove_timer(
+        threads::detail::timer_wheel_entry& entry)
+    {
+        return threads::detail::timer_wheel::remove(entry);
+    }
+
+    bool scheduler_base::expire_timers(std::size_t num_thread, bool steal)
+    {
+        // the expired entries are collected first, as waking the threads
+        // can't be done while holding the lock of a timer wheel
+        static thread_local threads::detail::timer_wheel::expired_entries_type
+            expired;
+
+        std::size_t const num_wheels = timer_wheels_.size();
+        if (num_thread < num_wheels)
+        {
+            timer_wheels_[num_thread]->expire(expired);
+        }
+
+        // expire the timers of other (possibly busy) worker threads as well
+        if (steal)
+        {
+            for (std::size_t i = 0; i != num_wheels; ++i)
+            {
+                if (i != num_thread)
+                {
+                    timer_wheels_[i]->expire(expired, true);
+                }
+            }
+        }
+
+        if (expired.empty())
+        {
+            return false;
+        }
+
+        for (auto& p : expired)
+        {
+            error_code ec(throwmode::lightweight);    // do not throw
+            threads::detail::set_thread_state(p.first.noref(),
+                thread_schedule_state::pending, thread_restart_state::timeout,
+                p.second, thread_schedule_hint(), true, ec);
+        }
+        expired.clear();
+        return true;
+    }
+
     void scheduler_base::suspend(std::size_t num_thread)
     {
         HPX_ASSERT(num_thread < suspend_conds_.size());
@@ -262,6 +456,7 @@ namespace hpx { namespace threads { namespace policies {
         {
             state.store(s);
         }
+        unpark_all_workers();
     }
 
     void scheduler_base::set_all_states_at_least(hpx::state s)
@@ -274,6 +469,7 @@ namespace hpx { namespace threads { namespace policies {
                 state.store(s);
             }
         }
+        unpark_all_workers();
     }
 
     // return whether all states are at least at the given one
@@ -321,7 +517,7 @@ namespace hpx { namespace threads { namespace policies {
     {
         // distribute the same value across all cores
         mode_.data_.store(mode, std::memory_order_release);
-        do_some_work(std::size_t(-1));
+        unpark_all_workers();
     }
 
     void scheduler_base::add_scheduler_mode(scheduler_mode mode)
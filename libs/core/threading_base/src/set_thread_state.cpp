@@ -12,6 +12,7 @@
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/threading_base/create_work.hpp>
+#include <hpx/threading_base/detail/lifo_slot.hpp>
 #include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/set_thread_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -263,11 +264,18 @@ namespace hpx { namespace threads { namespace detail {
 
             auto* thrd_data = get_thread_id_data(thrd);
             auto* scheduler = thrd_data->get_scheduler_base();
-            scheduler->schedule_thread(
-                thrd, schedulehint, false, thrd_data->get_priority());
-            // NOTE: Don't care if the hint is a NUMA hint, just want to wake up
-            // a thread.
-            scheduler->do_some_work(schedulehint.hint);
+
+            // run the thread next on the current worker thread, if possible
+            thread_id_ref_type thrd_ref(thrd);
+            if (!schedule_thread_lifo(scheduler, thrd_ref, schedulehint,
+                    thrd_data->get_priority()))
+            {
+                scheduler->schedule_thread(HPX_MOVE(thrd_ref), schedulehint,
+                    false, thrd_data->get_priority());
+                // NOTE: Don't care if the hint is a NUMA hint, just want to
+                // wake up a thread.
+                scheduler->do_some_work(schedulehint.hint);
+            }
         }
 
         if (&ec != &throws)
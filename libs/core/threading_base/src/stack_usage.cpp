@@ -0,0 +1,261 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#endif
+#include <hpx/thread_support/spinlock.hpp>
+#include <hpx/threading_base/detail/stack_usage.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace hpx { namespace threads { namespace detail {
+
+    bool track_stack_usage = false;
+    bool adapt_stack_size = false;
+
+    namespace {
+
+        // The adaptive policy kicks in only after the stack usage of this
+        // many threads with the same description has been measured. These
+        // are the first threads created for each description.
+        constexpr std::size_t min_stack_usage_samples = 16;
+
+        // After that, only every n-th thread with the same description has
+        // its stack usage measured.
+        constexpr std::size_t stack_usage_sample_interval = 16;
+
+        // The selected stack size class has to provide at least this
+        // multiple of the largest stack usage observed.
+        constexpr std::size_t stack_usage_safety_factor = 2;
+
+        constexpr std::size_t num_stack_usage_shards = 16;
+
+        struct stack_usage_data
+        {
+            std::size_t max_usage = 0;
+            std::size_t count = 0;
+
+            // number of threads created, used for sampling
+            std::size_t created = 0;
+
+            // largest usage since the last reset of the performance counter
+            std::size_t high_water_mark = 0;
+
+            // name of annotation or action, empty if the threads are
+            // identified by the address of their function only
+            std::string name;
+        };
+
+        struct stack_usage_shard
+        {
+            hpx::util::detail::spinlock mtx;
+            std::unordered_map<std::size_t, stack_usage_data> data;
+        };
+
+        stack_usage_shard stack_usage_shards[num_stack_usage_shards];
+
+        std::atomic<std::int64_t> stack_usage_high_water_mark(0);
+        std::atomic<std::int64_t> stack_size_adjustments(0);
+
+        // Threads are identified by their description, which is either the
+        // (static) name of an action or annotation or the address of the
+        // thread function.
+        std::size_t get_stack_usage_key(util::thread_description const& desc)
+        {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+            if (desc.kind() ==
+                util::thread_description::data_type_description)
+            {
+                return reinterpret_cast<std::size_t>(desc.get_description());
+            }
+            return desc.get_address();
+#else
+            HPX_UNUSED(desc);
+            return 0;
+#endif
+        }
+
+        stack_usage_shard& get_stack_usage_shard(std::size_t key) noexcept
+        {
+            // strip the low bits which are usually equal due to alignment
+            return stack_usage_shards[(key >> 4) % num_stack_usage_shards];
+        }
+    }    // namespace
+
+    void set_stack_usage_tracking(bool track, bool adaptive) noexcept
+    {
+        track_stack_usage = track;
+        adapt_stack_size = track && adaptive;
+
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+        coroutines::detail::posix::track_stack_usage = track;
+#endif
+    }
+
+    bool sample_stack_usage(util::thread_description const& desc)
+    {
+        std::size_t const key = get_stack_usage_key(desc);
+        stack_usage_shard& shard = get_stack_usage_shard(key);
+
+        std::lock_guard<hpx::util::detail::spinlock> l(shard.mtx);
+        std::size_t const created = shard.data[key].created++;
+        return created < min_stack_usage_samples ||
+            created % stack_usage_sample_interval == 0;
+    }
+
+    void record_stack_usage(
+        util::thread_description const& desc, std::size_t usage)
+    {
+        if (usage == 0)
+        {
+            return;
+        }
+
+        auto const bytes = static_cast<std::int64_t>(usage);
+        std::int64_t hwm =
+            stack_usage_high_water_mark.load(std::memory_order_relaxed);
+        while (hwm < bytes &&
+            !stack_usage_high_water_mark.compare_exchange_weak(
+                hwm, bytes, std::memory_order_relaxed))
+        {
+        }
+
+        std::size_t const key = get_stack_usage_key(desc);
+        stack_usage_shard& shard = get_stack_usage_shard(key);
+
+        std::lock_guard<hpx::util::detail::spinlock> l(shard.mtx);
+        stack_usage_data& data = shard.data[key];
+        if (data.max_usage < usage)
+        {
+            data.max_usage = usage;
+        }
+        if (data.high_water_mark < usage)
+        {
+            data.high_water_mark = usage;
+        }
+        ++data.count;
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+        if (data.name.empty() &&
+            desc.kind() == util::thread_description::data_type_description)
+        {
+            data.name = desc.get_description();
+        }
+#endif
+    }
+
+    thread_stacksize get_adaptive_stack_size(
+        policies::scheduler_base const* scheduler,
+        util::thread_description const& desc, thread_stacksize stacksize)
+    {
+        // explicitly requested stack sizes are left alone, this includes
+        // threads without a stack or inheriting the stack size of their
+        // parent
+        if (stacksize != thread_stacksize::default_)
+        {
+            return stacksize;
+        }
+
+        std::size_t max_usage = 0;
+        {
+            std::size_t const key = get_stack_usage_key(desc);
+            stack_usage_shard& shard = get_stack_usage_shard(key);
+
+            std::lock_guard<hpx::util::detail::spinlock> l(shard.mtx);
+            auto it = shard.data.find(key);
+            if (it == shard.data.end() ||
+                it->second.count < min_stack_usage_samples)
+            {
+                return stacksize;
+            }
+            max_usage = it->second.max_usage;
+        }
+
+        auto const required =
+            static_cast<std::ptrdiff_t>(max_usage * stack_usage_safety_factor);
+
+        // prefer the reduced stack size, if it is enabled (i.e. smaller than
+        // the default stack size)
+        std::ptrdiff_t const reduced =
+            scheduler->get_stack_size(thread_stacksize::reduced);
+        if (reduced < scheduler->get_stack_size(stacksize) &&
+            reduced >= required)
+        {
+            stack_size_adjustments.fetch_add(1, std::memory_order_relaxed);
+            return thread_stacksize::reduced;
+        }
+
+        for (auto s = thread_stacksize::minimal; s <= thread_stacksize::maximal;
+             s = static_cast<thread_stacksize>(static_cast<int>(s) + 1))
+        {
+            if (scheduler->get_stack_size(s) >= required)
+            {
+                if (s != stacksize)
+                {
+                    stack_size_adjustments.fetch_add(
+                        1, std::memory_order_relaxed);
+                }
+                return s;
+            }
+        }
+
+        // nothing is large enough, use the largest stack available
+        if (stacksize != thread_stacksize::maximal)
+        {
+            stack_size_adjustments.fetch_add(1, std::memory_order_relaxed);
+        }
+        return thread_stacksize::maximal;
+    }
+
+    std::int64_t get_stack_usage_high_water_mark(bool reset)
+    {
+        return util::get_and_reset_value(stack_usage_high_water_mark, reset);
+    }
+
+    std::int64_t get_description_stack_usage_high_water_mark(
+        std::string const& description, bool reset)
+    {
+        // the same name may be referred to by more than one key
+        std::size_t hwm = 0;
+        for (stack_usage_shard& shard : stack_usage_shards)
+        {
+            std::lock_guard<hpx::util::detail::spinlock> l(shard.mtx);
+            for (auto& entry : shard.data)
+            {
+                stack_usage_data& data = entry.second;
+                if (data.name == description)
+                {
+                    if (hwm < data.high_water_mark)
+                    {
+                        hwm = data.high_water_mark;
+                    }
+                    if (reset)
+                    {
+                        data.high_water_mark = 0;
+                    }
+                }
+            }
+        }
+        return static_cast<std::int64_t>(hwm);
+    }
+
+    std::int64_t get_stack_size_adjustment_count(bool reset)
+    {
+        return util::get_and_reset_value(stack_size_adjustments, reset);
+    }
+}}}    // namespace hpx::threads::detail
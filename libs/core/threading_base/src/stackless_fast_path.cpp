@@ -0,0 +1,30 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/detail/stackless_fast_path.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace hpx { namespace threads { namespace detail {
+
+    namespace {
+
+        std::atomic<std::int64_t> stackless_fast_path_count(0);
+    }    // namespace
+
+    void count_stackless_fast_path() noexcept
+    {
+        stackless_fast_path_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::int64_t get_stackless_fast_path_count(bool reset)
+    {
+        return util::get_and_reset_value(stackless_fast_path_count, reset);
+    }
+}}}    // namespace hpx::threads::detail
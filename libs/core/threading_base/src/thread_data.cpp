@@ -75,6 +75,8 @@ namespace hpx { namespace threads {
       , stacksize_(stacksize)
       , stacksize_enum_(init_data.stacksize)
       , queue_(queue)
+      , creation_time_(init_data.creation_time)
+      , queued_time_(0)
     {
         LTM_(debug).format(
             "thread::thread({}), description({})", this, get_description());
@@ -221,6 +223,8 @@ namespace hpx { namespace threads {
         exit_funcs_.clear();
         scheduler_base_ = init_data.scheduler_base;
         last_worker_thread_num_ = std::size_t(-1);
+        creation_time_ = init_data.creation_time;
+        queued_time_ = 0;
 
         // We explicitly set the logical stack size again as it can be different
         // from what the previous use required. However, the physical stack size
@@ -334,6 +338,13 @@ namespace hpx { namespace threads {
             thrd_data->get_stack_size_enum() :
             thread_stacksize::default_;
         HPX_ASSERT(stacksize != thread_stacksize::current);
+
+        // a reduced stack was selected for the function of this thread only,
+        // threads inheriting its stack size get the default one instead
+        if (stacksize == thread_stacksize::reduced)
+        {
+            return thread_stacksize::default_;
+        }
         return stacksize;
     }
 
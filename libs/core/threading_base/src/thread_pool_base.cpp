@@ -12,6 +12,7 @@
 #include <hpx/threading_base/callback_notifier.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 #include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/topology/topology.hpp>
@@ -64,6 +65,14 @@ namespace hpx { namespace threads {
         return topo.cpuset_to_nodeset(used_processing_units);
     }
 
+    std::size_t thread_pool_base::get_numa_node_number(
+        std::size_t thread_num) const
+    {
+        auto const& topo = create_topology();
+        return topo.get_numa_node_number(
+            affinity_data_.get_pu_num(thread_num + get_thread_offset()));
+    }
+
     std::size_t thread_pool_base::get_active_os_thread_count() const
     {
         std::size_t active_os_thread_count = 0;
@@ -81,6 +90,19 @@ namespace hpx { namespace threads {
         return active_os_thread_count;
     }
 
+    void thread_pool_base::create_work_batch(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            create_work(data[i], ec);
+            if (ec)
+            {
+                return;
+            }
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     void thread_pool_base::init_pool_time_scale()
     {
@@ -0,0 +1,330 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace hpx { namespace threads { namespace detail {
+
+    timer_wheel::timer_wheel() noexcept
+      : timer_wheel(now())
+    {
+    }
+
+    timer_wheel::timer_wheel(std::uint64_t current) noexcept
+      : next_expiry_(no_expiry)
+      , count_(0)
+      , current_(current)
+      , level_counts_()
+      , slots_()
+    {
+    }
+
+    std::uint64_t timer_wheel::now() noexcept
+    {
+        auto const ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+                            .count();
+        return static_cast<std::uint64_t>(ns) >> tick_shift;
+    }
+
+    std::uint64_t timer_wheel::to_ticks(
+        std::chrono::steady_clock::time_point abs_time) noexcept
+    {
+        auto const ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            abs_time.time_since_epoch())
+                            .count();
+        if (ns <= 0)
+        {
+            return 0;
+        }
+        std::uint64_t const tick = std::uint64_t(1) << tick_shift;
+        return (static_cast<std::uint64_t>(ns) + tick - 1) >> tick_shift;
+    }
+
+    bool timer_wheel::add(timer_wheel_entry& entry,
+        std::chrono::steady_clock::time_point abs_time)
+    {
+        return add_at(entry, to_ticks(abs_time), now());
+    }
+
+    bool timer_wheel::add_at(
+        timer_wheel_entry& entry, std::uint64_t expiry, std::uint64_t current)
+    {
+        HPX_ASSERT(entry.pprev_ == nullptr);
+
+        std::lock_guard<mutex_type> l(mtx_);
+
+        // an empty wheel can be moved to the current time right away
+        if (count_.load(std::memory_order_relaxed) == 0 && current_ < current)
+        {
+            current_ = current;
+        }
+
+        if (expiry <= current_)
+        {
+            return false;
+        }
+
+        entry.wheel_ = this;
+        entry.expiry_ = expiry;
+        link(entry);
+        count_.fetch_add(1, std::memory_order_relaxed);
+
+        if (expiry < next_expiry_.load(std::memory_order_relaxed))
+        {
+            next_expiry_.store(expiry, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    bool timer_wheel::remove(timer_wheel_entry& entry)
+    {
+        timer_wheel* wheel = entry.wheel_;
+        if (wheel == nullptr)
+        {
+            return false;
+        }
+
+        std::lock_guard<mutex_type> l(wheel->mtx_);
+        if (entry.pprev_ == nullptr)
+        {
+            return false;    // expired already
+        }
+
+        wheel->unlink(entry);
+        wheel->count_.fetch_sub(1, std::memory_order_relaxed);
+
+        // next_expiry_ stays valid as it is only a lower bound
+        return true;
+    }
+
+    bool timer_wheel::expire(expired_entries_type& expired, bool try_lock)
+    {
+        if (next_expiry_.load(std::memory_order_relaxed) == no_expiry)
+        {
+            return true;    // nothing to do
+        }
+        return expire_until(expired, now(), try_lock);
+    }
+
+    bool timer_wheel::expire_until(
+        expired_entries_type& expired, std::uint64_t target, bool try_lock)
+    {
+        std::uint64_t const earliest =
+            next_expiry_.load(std::memory_order_relaxed);
+        if (earliest == no_expiry)
+        {
+            return true;    // nothing to do
+        }
+
+        if (earliest > target)
+        {
+            return true;    // nothing to do yet
+        }
+
+        std::unique_lock<mutex_type> l(mtx_, std::defer_lock);
+        if (try_lock)
+        {
+            if (!l.try_lock())
+            {
+                return false;
+            }
+        }
+        else
+        {
+            l.lock();
+        }
+
+        while (current_ < target)
+        {
+            if (count_.load(std::memory_order_relaxed) == 0)
+            {
+                current_ = target;
+                break;
+            }
+
+            // skip all ticks which don't have anything to do, i.e. if no
+            // entries are in the first level, skip ahead to the next tick at
+            // which the lowest non-empty level needs to be cascaded
+            if (level_counts_[0] == 0)
+            {
+                std::size_t level = 1;
+                while (level_counts_[level] == 0)
+                {
+                    ++level;
+                }
+                HPX_ASSERT(level < num_levels);
+
+                std::size_t const shift = level * level_bits;
+                std::uint64_t const boundary = ((current_ >> shift) + 1)
+                    << shift;
+                if (boundary > target)
+                {
+                    current_ = target;
+                    break;
+                }
+                current_ = boundary - 1;
+            }
+
+            std::uint64_t const tick = ++current_;
+
+            // move the entries of the higher levels which are due within the
+            // range covered by the next lower level down
+            for (std::size_t level = num_levels - 1; level != 0; --level)
+            {
+                std::uint64_t const mask =
+                    (std::uint64_t(1) << (level * level_bits)) - 1;
+                if ((tick & mask) == 0 && level_counts_[level] != 0)
+                {
+                    cascade(level);
+                }
+            }
+
+            // all entries in the current slot of the first level are due
+            timer_wheel_entry*& slot = slots_[0][tick % num_slots];
+            timer_wheel_entry* entry = slot;
+            slot = nullptr;
+            while (entry != nullptr)
+            {
+                timer_wheel_entry* next_entry = entry->next_;
+                HPX_ASSERT(entry->expiry_ == tick);
+
+                expired.emplace_back(HPX_MOVE(entry->thrd_), entry->priority_);
+                entry->next_ = nullptr;
+                entry->pprev_ = nullptr;
+                --level_counts_[0];
+                count_.fetch_sub(1, std::memory_order_relaxed);
+
+                entry = next_entry;
+            }
+        }
+
+        update_next_expiry();
+        return true;
+    }
+
+    void timer_wheel::link(timer_wheel_entry& entry) noexcept
+    {
+        // entries which are due in the current tick go into the first level
+        // (this happens only while cascading)
+        HPX_ASSERT(entry.expiry_ >= current_);
+        std::uint64_t const delta = entry.expiry_ - current_;
+
+        std::size_t level = 0;
+        while (level != num_levels - 1 &&
+            delta >= (std::uint64_t(1) << ((level + 1) * level_bits)))
+        {
+            ++level;
+        }
+
+        // entries which are too far in the future for the last level are
+        // placed into its last slot, from where they will be cascaded into
+        // the last level again
+        std::uint64_t expiry = entry.expiry_;
+        std::uint64_t const max_delta = std::uint64_t(1)
+            << (num_levels * level_bits);
+        if (delta >= max_delta)
+        {
+            expiry = current_ + max_delta - 1;
+        }
+
+        timer_wheel_entry** head =
+            &slots_[level][(expiry >> (level * level_bits)) % num_slots];
+
+        entry.next_ = *head;
+        if (entry.next_ != nullptr)
+        {
+            entry.next_->pprev_ = &entry.next_;
+        }
+        entry.pprev_ = head;
+        *head = &entry;
+
+        entry.level_ = level;
+        ++level_counts_[level];
+    }
+
+    void timer_wheel::unlink(timer_wheel_entry& entry) noexcept
+    {
+        HPX_ASSERT(entry.pprev_ != nullptr);
+
+        *entry.pprev_ = entry.next_;
+        if (entry.next_ != nullptr)
+        {
+            entry.next_->pprev_ = entry.pprev_;
+        }
+        entry.next_ = nullptr;
+        entry.pprev_ = nullptr;
+
+        --level_counts_[entry.level_];
+    }
+
+    void timer_wheel::cascade(std::size_t level) noexcept
+    {
+        timer_wheel_entry*& slot =
+            slots_[level][(current_ >> (level * level_bits)) % num_slots];
+
+        // detach the whole slot first, as entries might be linked into the
+        // same slot again
+        timer_wheel_entry* entry = slot;
+        slot = nullptr;
+        while (entry != nullptr)
+        {
+            timer_wheel_entry* next = entry->next_;
+
+            entry->next_ = nullptr;
+            entry->pprev_ = nullptr;
+            --level_counts_[level];
+            link(*entry);
+
+            entry = next;
+        }
+    }
+
+    void timer_wheel::update_next_expiry() noexcept
+    {
+        std::uint64_t next = no_expiry;
+        if (count_.load(std::memory_order_relaxed) != 0)
+        {
+            if (level_counts_[0] != 0)
+            {
+                for (std::uint64_t tick = current_ + 1;
+                     tick != current_ + num_slots; ++tick)
+                {
+                    if (slots_[0][tick % num_slots] != nullptr)
+                    {
+                        next = tick;
+                        break;
+                    }
+                }
+            }
+
+            // entries on higher levels can't expire before the next time
+            // their level is cascaded
+            for (std::size_t level = 1; level != num_levels; ++level)
+            {
+                if (level_counts_[level] != 0)
+                {
+                    std::size_t const shift = level * level_bits;
+                    std::uint64_t const boundary = ((current_ >> shift) + 1)
+                        << shift;
+                    if (boundary < next)
+                    {
+                        next = boundary;
+                    }
+                    break;
+                }
+            }
+        }
+        next_expiry_.store(next, std::memory_order_relaxed);
+    }
+}}}    // namespace hpx::threads::detail
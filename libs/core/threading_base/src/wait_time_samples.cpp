@@ -0,0 +1,160 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+#include <hpx/threading_base/detail/wait_time_samples.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace hpx { namespace threads { namespace detail {
+
+    std::uint32_t wait_time_sample_interval = 0;
+
+    namespace {
+
+        // The most recent samples are kept in a fixed size ring buffer for
+        // each kind of wait time and each worker thread.
+        constexpr std::size_t max_wait_time_samples = 1024;
+
+        struct wait_time_data
+        {
+            explicit wait_time_data(std::size_t num_thread)
+              : num_thread(num_thread)
+            {
+                for (auto& s : samples)
+                {
+                    s.resize(max_wait_time_samples);
+                }
+            }
+
+            std::size_t const num_thread;
+
+            hpx::util::detail::spinlock mtx;
+            std::vector<std::int64_t> samples[num_wait_time_kinds];
+            std::size_t count[num_wait_time_kinds] = {};
+        };
+
+        struct wait_time_registry
+        {
+            hpx::util::detail::spinlock mtx;
+            std::vector<std::shared_ptr<wait_time_data>> data;
+        };
+
+        wait_time_registry& get_wait_time_registry()
+        {
+            static wait_time_registry registry;
+            return registry;
+        }
+
+        // Return the data for the calling worker thread, nullptr if this is
+        // not a worker thread.
+        wait_time_data* get_wait_time_data()
+        {
+            thread_local std::shared_ptr<wait_time_data> data;
+            if (!data)
+            {
+                std::size_t const num_thread = get_global_thread_num_tss();
+                if (num_thread == std::size_t(-1))
+                {
+                    return nullptr;
+                }
+
+                data = std::make_shared<wait_time_data>(num_thread);
+
+                wait_time_registry& registry = get_wait_time_registry();
+                std::lock_guard<hpx::util::detail::spinlock> l(registry.mtx);
+                registry.data.push_back(data);
+            }
+            return data.get();
+        }
+    }    // namespace
+
+    void set_wait_time_sample_interval(std::uint32_t interval) noexcept
+    {
+        wait_time_sample_interval = interval;
+    }
+
+    std::uint64_t sample_wait_time_start_slow() noexcept
+    {
+        thread_local std::uint32_t events = 0;
+        if (++events < wait_time_sample_interval)
+        {
+            return 0;
+        }
+
+        events = 0;
+        return hpx::chrono::high_resolution_clock::now();
+    }
+
+    void record_wait_time(wait_time_kind kind, std::uint64_t start) noexcept
+    {
+        std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+        if (now < start)
+        {
+            return;
+        }
+
+        wait_time_data* data = nullptr;
+        try
+        {
+            data = get_wait_time_data();
+        }
+        catch (...)
+        {
+            // sampling is best effort only
+        }
+
+        if (data == nullptr)
+        {
+            return;
+        }
+
+        auto const k = static_cast<std::size_t>(kind);
+
+        std::lock_guard<hpx::util::detail::spinlock> l(data->mtx);
+        data->samples[k][data->count[k]++ % max_wait_time_samples] =
+            static_cast<std::int64_t>(now - start);
+    }
+
+    std::vector<std::int64_t> get_wait_time_samples(
+        wait_time_kind kind, std::size_t num_thread, bool reset)
+    {
+        auto const k = static_cast<std::size_t>(kind);
+
+        std::vector<std::int64_t> result;
+
+        wait_time_registry& registry = get_wait_time_registry();
+        std::lock_guard<hpx::util::detail::spinlock> rl(registry.mtx);
+        for (auto const& data : registry.data)
+        {
+            if (num_thread != std::size_t(-1) && data->num_thread != num_thread)
+            {
+                continue;
+            }
+
+            std::lock_guard<hpx::util::detail::spinlock> l(data->mtx);
+
+            std::size_t const count =
+                (std::min)(data->count[k], max_wait_time_samples);
+            result.insert(result.end(), data->samples[k].begin(),
+                data->samples[k].begin() + count);
+
+            if (reset)
+            {
+                data->count[k] = 0;
+            }
+        }
+        return result;
+    }
+}}}    // namespace hpx::threads::detail
@@ -0,0 +1,132 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/detail/worker_parking.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <cerrno>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#else
+#include <condition_variable>
+#include <mutex>
+#endif
+
+namespace hpx { namespace threads { namespace detail {
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+    namespace {
+
+        static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(int),
+            "the epoch of a parking spot has to be usable as a futex");
+
+        // Returns false if the wait timed out.
+        bool futex_wait(std::atomic<std::uint32_t>* addr, std::uint32_t value,
+            std::chrono::nanoseconds timeout) noexcept
+        {
+            constexpr std::int64_t ns_per_s = 1000000000;
+
+            timespec ts;
+            ts.tv_sec = static_cast<time_t>(timeout.count() / ns_per_s);
+            ts.tv_nsec = static_cast<long>(timeout.count() % ns_per_s);
+
+            // spurious wake-ups and interruptions are handled by the caller
+            return syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(addr),
+                       FUTEX_WAIT_PRIVATE, value, &ts, nullptr, 0) == 0 ||
+                errno != ETIMEDOUT;
+        }
+
+        void futex_wake(std::atomic<std::uint32_t>* addr, int count) noexcept
+        {
+            syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(addr),
+                FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+        }
+    }    // namespace
+
+    bool worker_parking::park(
+        std::uint32_t token, std::chrono::nanoseconds timeout)
+    {
+        // a wake-up after the timeout has expired doesn't count
+        bool const timed_out =
+            timeout.count() > 0 && !futex_wait(&epoch_, token, timeout);
+
+        num_parked_.fetch_sub(1, std::memory_order_relaxed);
+        return !timed_out && epoch_.load(std::memory_order_acquire) != token;
+    }
+
+    void worker_parking::wake(bool all) noexcept
+    {
+        epoch_.fetch_add(1, std::memory_order_seq_cst);
+        futex_wake(&epoch_, all ? (std::numeric_limits<int>::max)() : 1);
+    }
+#else
+    bool worker_parking::park(
+        std::uint32_t token, std::chrono::nanoseconds timeout)
+    {
+        bool woken = false;
+        {
+            std::unique_lock<std::mutex> l(mtx_);
+            woken = cond_.wait_for(l, timeout, [&]() {
+                return epoch_.load(std::memory_order_relaxed) != token;
+            });
+        }
+
+        num_parked_.fetch_sub(1, std::memory_order_relaxed);
+        return woken;
+    }
+
+    void worker_parking::wake(bool all) noexcept
+    {
+        epoch_.fetch_add(1, std::memory_order_seq_cst);
+
+        // acquiring the mutex makes sure that the parked thread either has
+        // seen the new epoch or is blocked on the condition variable
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+        }
+
+        if (all)
+        {
+            cond_.notify_all();
+        }
+        else
+        {
+            cond_.notify_one();
+        }
+    }
+#endif
+
+    bool worker_parking::unpark_one() noexcept
+    {
+        // pairs with the atomic increment in prepare_park, the new work has
+        // to be visible before num_parked_ is read
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (num_parked_.load(std::memory_order_relaxed) == 0)
+        {
+            return false;
+        }
+
+        wake(false);
+        return true;
+    }
+
+    void worker_parking::unpark_all() noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (num_parked_.load(std::memory_order_relaxed) != 0)
+        {
+            wake(true);
+        }
+    }
+}}}    // namespace hpx::threads::detail
@@ -0,0 +1,110 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that threads created using register_work_batch are
+// accounted for at once, that all of them run, and that they run on the
+// worker thread given by their schedule hint.
+
+#include <hpx/local/init.hpp>
+#include <hpx/local/runtime.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+constexpr std::size_t num_threads = 1000;
+
+void test_register_work_batch()
+{
+    hpx::threads::thread_pool_base* pool =
+        hpx::threads::detail::get_self_or_default_pool();
+    std::size_t const num_workers = hpx::get_num_worker_threads();
+    std::size_t const self = hpx::get_worker_thread_num();
+
+    std::atomic<std::size_t> count(0);
+    std::vector<std::size_t> worker(num_threads, std::size_t(-1));
+
+    // all threads target the calling worker thread, which is busy running
+    // this thread, thus they stay queued until this thread yields
+    std::vector<hpx::threads::thread_init_data> data;
+    data.reserve(num_threads);
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        data.emplace_back(hpx::threads::make_thread_function_nullary(
+                              [&count, &worker, i]() {
+                                  worker[i] = hpx::get_worker_thread_num();
+                                  ++count;
+                              }),
+            "test_register_work_batch", hpx::threads::thread_priority::normal,
+            hpx::threads::thread_schedule_hint(
+                static_cast<std::int16_t>(self)));
+    }
+
+    std::int64_t const queue_length = pool->get_queue_length(self, false);
+    hpx::threads::register_work_batch(data.data(), data.size(), pool);
+    HPX_TEST_EQ(pool->get_queue_length(self, false) - queue_length,
+        static_cast<std::int64_t>(num_threads));
+
+    while (count.load() != num_threads)
+    {
+        hpx::this_thread::yield();
+    }
+
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        HPX_TEST_EQ(worker[i], self);
+    }
+
+    // threads targeting all worker threads
+    count = 0;
+    data.clear();
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        std::size_t const target = i % num_workers;
+        data.emplace_back(hpx::threads::make_thread_function_nullary(
+                              [&count, &worker, i]() {
+                                  worker[i] = hpx::get_worker_thread_num();
+                                  ++count;
+                              }),
+            "test_register_work_batch", hpx::threads::thread_priority::normal,
+            hpx::threads::thread_schedule_hint(
+                static_cast<std::int16_t>(target)));
+    }
+
+    hpx::threads::register_work_batch(data.data(), data.size(), pool);
+
+    while (count.load() != num_threads)
+    {
+        hpx::this_thread::yield();
+    }
+
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        HPX_TEST_EQ(worker[i], i % num_workers);
+    }
+}
+
+int hpx_main()
+{
+    // threads must not be stolen for their schedule hints to be respected
+    hpx::threads::remove_scheduler_mode(
+        hpx::threads::policies::scheduler_mode::enable_stealing |
+        hpx::threads::policies::scheduler_mode::enable_stealing_numa);
+
+    test_register_work_batch();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,116 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that the adaptive stack size policy runs threads which
+// use very little stack on reduced stacks, that threads using more stack
+// keep the default stack size, and that the stack usage is reported per
+// thread description.
+
+#include <hpx/local/init.hpp>
+#include <hpx/local/runtime.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/threading_base/detail/stack_usage.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+constexpr std::size_t num_threads = 64;
+constexpr std::size_t deep_usage = 0x6000;
+
+char const* const shallow_name = "test_stack_usage_shallow";
+char const* const deep_name = "test_stack_usage_deep";
+
+void use_stack(std::size_t bytes)
+{
+    volatile char buffer[deep_usage];
+    for (std::size_t i = 0; i < bytes; i += 64)
+    {
+        buffer[i] = static_cast<char>(i);
+    }
+}
+
+// run the threads one after the other, such that the stack usage of the
+// earlier ones is known when creating the later ones
+std::vector<std::ptrdiff_t> run_threads(char const* name, std::size_t bytes)
+{
+    std::vector<std::ptrdiff_t> stacksizes(num_threads, 0);
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        std::atomic<bool> done(false);
+        hpx::threads::thread_init_data data(
+            hpx::threads::make_thread_function_nullary(
+                [&stacksizes, &done, bytes, i]() {
+                    use_stack(bytes);
+                    stacksizes[i] = hpx::threads::get_self_stacksize();
+                    done = true;
+                }),
+            name);
+        hpx::threads::register_work(data);
+
+        while (!done.load())
+        {
+            hpx::this_thread::yield();
+        }
+    }
+    return stacksizes;
+}
+
+int hpx_main()
+{
+#if defined(HPX_HAVE_THREAD_DESCRIPTION) && defined(__linux__)
+    using hpx::threads::thread_stacksize;
+
+    std::ptrdiff_t const default_size =
+        hpx::threads::get_stack_size(thread_stacksize::default_);
+    std::ptrdiff_t const reduced_size =
+        hpx::threads::get_stack_size(thread_stacksize::reduced);
+    HPX_TEST_LT(reduced_size, default_size);
+
+    // the first threads of each description run on the default stack size,
+    // the later ones on the stack size selected based on their usage
+    std::vector<std::ptrdiff_t> shallow = run_threads(shallow_name, 0);
+    HPX_TEST_EQ(shallow.front(), default_size);
+    HPX_TEST_EQ(shallow.back(), reduced_size);
+
+    std::vector<std::ptrdiff_t> deep = run_threads(deep_name, deep_usage);
+    HPX_TEST_EQ(deep.front(), default_size);
+    HPX_TEST_EQ(deep.back(), default_size);
+
+    std::int64_t const shallow_hwm = hpx::threads::detail::
+        get_description_stack_usage_high_water_mark(shallow_name, false);
+    std::int64_t const deep_hwm = hpx::threads::detail::
+        get_description_stack_usage_high_water_mark(deep_name, true);
+
+    HPX_TEST_LT(std::int64_t(0), shallow_hwm);
+    HPX_TEST_LT(shallow_hwm, std::int64_t(reduced_size));
+    HPX_TEST_LTE(std::int64_t(deep_usage), deep_hwm);
+    HPX_TEST_LTE(deep_hwm,
+        hpx::threads::detail::get_stack_usage_high_water_mark(false));
+
+    // the value was reset by the previous query
+    HPX_TEST_EQ(hpx::threads::detail::
+                    get_description_stack_usage_high_water_mark(
+                        deep_name, false),
+        std::int64_t(0));
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.stacks.track_usage=1", "hpx.stacks.adaptive_size=1"};
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
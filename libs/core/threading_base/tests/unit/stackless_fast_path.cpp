@@ -0,0 +1,235 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that threads running callables which have opted in
+// using hpx::traits::is_stackless_callable are run without a stack, whether
+// they are launched using hpx::apply, hpx::async, as a continuation, or in
+// bulk, and that threads running any other callables (or which request an
+// explicit stack size) are run on a stack.
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/latch.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/async_local.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct stackless_function
+{
+    void operator()() const
+    {
+        HPX_TEST_EQ(hpx::threads::get_self_stacksize_enum(), stacksize);
+
+        ++count;
+        l->count_down(1);
+    }
+
+    hpx::threads::thread_stacksize stacksize;
+    std::atomic<std::size_t>& count;
+    hpx::latch* l;
+};
+
+namespace hpx::traits {
+
+    template <>
+    struct is_stackless_callable<stackless_function> : std::true_type
+    {
+    };
+}    // namespace hpx::traits
+
+struct stackless_continuation
+{
+    void operator()(hpx::future<void> f) const
+    {
+        HPX_TEST(f.is_ready());
+        HPX_TEST_EQ(hpx::threads::get_self_stacksize_enum(),
+            hpx::threads::thread_stacksize::nostack);
+        ++count;
+    }
+
+    std::atomic<std::size_t>& count;
+};
+
+struct stackless_bulk_function
+{
+    void operator()(std::size_t) const
+    {
+        if (hpx::threads::get_self_stacksize_enum() ==
+            hpx::threads::thread_stacksize::nostack)
+        {
+            ++count;
+        }
+    }
+
+    std::atomic<std::size_t>& count;
+};
+
+namespace hpx::traits {
+
+    template <>
+    struct is_stackless_callable<stackless_continuation> : std::true_type
+    {
+    };
+
+    template <>
+    struct is_stackless_callable<stackless_bulk_function> : std::true_type
+    {
+    };
+}    // namespace hpx::traits
+
+struct stackful_function
+{
+    void operator()() const
+    {
+        HPX_TEST_NEQ(hpx::threads::get_self_stacksize_enum(),
+            hpx::threads::thread_stacksize::nostack);
+
+        // suspend only once all other threads have run without suspending
+        if (suspend)
+        {
+            hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+            hpx::this_thread::yield();
+        }
+
+        ++count;
+        l->count_down(1);
+    }
+
+    bool suspend;
+    std::atomic<std::size_t>& count;
+    hpx::latch* l;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t num_threads = 100;
+
+void test_stackless_callable()
+{
+    std::atomic<std::size_t> count(0);
+    hpx::latch l(num_threads + 1);
+
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        hpx::apply(stackless_function{
+            hpx::threads::thread_stacksize::nostack, count, &l});
+    }
+
+    l.arrive_and_wait();
+    HPX_TEST_EQ(count.load(), num_threads);
+}
+
+void test_stackless_async()
+{
+    std::atomic<std::size_t> count(0);
+    hpx::latch l(num_threads);
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_threads);
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        futures.push_back(hpx::async(stackless_function{
+            hpx::threads::thread_stacksize::nostack, count, &l}));
+    }
+
+    hpx::wait_all(futures);
+    HPX_TEST_EQ(count.load(), num_threads);
+}
+
+void test_stackless_continuation()
+{
+    std::atomic<std::size_t> count(0);
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_threads);
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        futures.push_back(hpx::make_ready_future().then(
+            hpx::launch::async, stackless_continuation{count}));
+    }
+
+    hpx::wait_all(futures);
+    HPX_TEST_EQ(count.load(), num_threads);
+}
+
+void test_stackless_bulk()
+{
+    std::atomic<std::size_t> count(0);
+
+    hpx::execution::parallel_executor exec;
+    hpx::parallel::execution::bulk_async_execute(
+        exec, stackless_bulk_function{count}, num_threads)
+        .get();
+
+    // the last element of the last chunk is run directly by the thread
+    // spawning the others
+    HPX_TEST_LTE(num_threads - 1, count.load());
+}
+
+void test_stackful_callable()
+{
+    std::atomic<std::size_t> count(0);
+    hpx::latch l(num_threads + 2);
+
+    // run many threads which don't suspend, followed by one which does
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        hpx::apply(stackful_function{false, count, &l});
+    }
+
+    // wait for the non-suspending threads to finish
+    while (count.load() != num_threads)
+    {
+        hpx::this_thread::yield();
+    }
+
+    hpx::apply(stackful_function{true, count, &l});
+
+    l.arrive_and_wait();
+    HPX_TEST_EQ(count.load(), num_threads + 1);
+}
+
+void test_explicit_stacksize()
+{
+    std::atomic<std::size_t> count(0);
+    hpx::latch l(2);
+
+    // an explicitly requested stack size is never changed
+    hpx::execution::parallel_executor exec(
+        hpx::threads::thread_stacksize::medium);
+    hpx::apply(exec,
+        stackless_function{
+            hpx::threads::thread_stacksize::medium, count, &l});
+
+    l.arrive_and_wait();
+    HPX_TEST_EQ(count.load(), std::size_t(1));
+}
+
+int hpx_main()
+{
+    test_stackless_callable();
+    test_stackless_async();
+    test_stackless_continuation();
+    test_stackless_bulk();
+    test_stackful_callable();
+    test_explicit_stacksize();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
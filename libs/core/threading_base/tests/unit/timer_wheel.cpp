@@ -0,0 +1,175 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test drives a timer wheel using explicit ticks, which allows to verify
+// that every entry expires exactly at its tick, regardless of the level it
+// was placed on.
+
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using hpx::threads::detail::timer_wheel;
+using hpx::threads::detail::timer_wheel_entry;
+
+std::size_t expire_until(timer_wheel& wheel, std::uint64_t target)
+{
+    timer_wheel::expired_entries_type expired;
+    HPX_TEST(wheel.expire_until(expired, target));
+    return expired.size();
+}
+
+std::unique_ptr<timer_wheel_entry> make_entry()
+{
+    return std::make_unique<timer_wheel_entry>(
+        hpx::threads::invalid_thread_id);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_insert_cancel()
+{
+    std::uint64_t const start = 0x1234;
+    timer_wheel wheel(start);
+
+    auto e1 = make_entry();
+    auto e2 = make_entry();
+    auto e3 = make_entry();
+
+    // timers which have expired already are not added
+    HPX_TEST(!wheel.add_at(*e3, start, start));
+    HPX_TEST_EQ(wheel.size(), std::size_t(0));
+
+    HPX_TEST(wheel.add_at(*e1, start + 10, start));
+    HPX_TEST(wheel.add_at(*e2, start + 20, start));
+    HPX_TEST_EQ(wheel.size(), std::size_t(2));
+    HPX_TEST_EQ(wheel.next_expiry(), start + 10);
+
+    // cancel the second timer
+    HPX_TEST(timer_wheel::remove(*e2));
+    HPX_TEST(!timer_wheel::remove(*e2));
+    HPX_TEST_EQ(wheel.size(), std::size_t(1));
+
+    HPX_TEST_EQ(expire_until(wheel, start + 9), std::size_t(0));
+    HPX_TEST_EQ(expire_until(wheel, start + 10), std::size_t(1));
+    HPX_TEST_EQ(expire_until(wheel, start + 100), std::size_t(0));
+
+    // expired timers can't be canceled anymore
+    HPX_TEST(!timer_wheel::remove(*e1));
+    HPX_TEST_EQ(wheel.size(), std::size_t(0));
+    HPX_TEST_EQ(wheel.next_expiry(), timer_wheel::no_expiry);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_cascade()
+{
+    std::uint64_t const start = 0x1234;
+    timer_wheel wheel(start);
+
+    // one entry per level
+    std::uint64_t const deltas[] = {
+        100, 300, 70000, std::uint64_t(1) << 25};
+
+    std::vector<std::unique_ptr<timer_wheel_entry>> entries;
+    for (std::uint64_t delta : deltas)
+    {
+        entries.push_back(make_entry());
+        HPX_TEST(wheel.add_at(*entries.back(), start + delta, start));
+    }
+    HPX_TEST_EQ(wheel.size(), std::size_t(4));
+
+    std::size_t remaining = 4;
+    for (std::uint64_t delta : deltas)
+    {
+        HPX_TEST_EQ(expire_until(wheel, start + delta - 1), std::size_t(0));
+        HPX_TEST_EQ(wheel.size(), remaining);
+
+        HPX_TEST_EQ(expire_until(wheel, start + delta), std::size_t(1));
+        HPX_TEST_EQ(wheel.size(), --remaining);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_wrap_around()
+{
+    // start just before the slot index of the first level wraps around
+    std::uint64_t const start = 0x10000 - 5;
+    timer_wheel wheel(start);
+
+    // the entries expire over several rotations of the first two levels
+    constexpr std::size_t num_entries = 64;
+    constexpr std::uint64_t step = 37;
+
+    std::vector<std::unique_ptr<timer_wheel_entry>> entries;
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        entries.push_back(make_entry());
+        HPX_TEST(
+            wheel.add_at(*entries.back(), start + 1 + i * step, start));
+    }
+
+    // advance the wheel tick by tick
+    std::size_t expired = 0;
+    for (std::uint64_t tick = start + 1; tick <= start + num_entries * step;
+         ++tick)
+    {
+        std::size_t const expected = (tick - start - 1) % step == 0 ? 1 : 0;
+        HPX_TEST_EQ(expire_until(wheel, tick), expected);
+        expired += expected;
+    }
+
+    HPX_TEST_EQ(expired, num_entries);
+    HPX_TEST_EQ(wheel.size(), std::size_t(0));
+
+    // add entries relative to the advanced wheel, these wrap around as well
+    std::uint64_t const current = start + num_entries * step;
+    auto e = make_entry();
+    HPX_TEST(wheel.add_at(*e, current + 255, current));
+    HPX_TEST_EQ(expire_until(wheel, current + 254), std::size_t(0));
+    HPX_TEST_EQ(expire_until(wheel, current + 255), std::size_t(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_expiry_past_top_level()
+{
+    std::uint64_t const start = 0x1234;
+    timer_wheel wheel(start);
+
+    // the range covered by all levels
+    std::uint64_t const max_delta = std::uint64_t(1)
+        << (timer_wheel::num_levels * timer_wheel::level_bits);
+
+    auto e1 = make_entry();
+    auto e2 = make_entry();
+    HPX_TEST(wheel.add_at(*e1, start + max_delta + 1000, start));
+    HPX_TEST(wheel.add_at(*e2, start + 3 * max_delta, start));
+    HPX_TEST_EQ(wheel.size(), std::size_t(2));
+
+    HPX_TEST_EQ(expire_until(wheel, start + max_delta - 1), std::size_t(0));
+    HPX_TEST_EQ(
+        expire_until(wheel, start + max_delta + 999), std::size_t(0));
+    HPX_TEST_EQ(wheel.size(), std::size_t(2));
+
+    HPX_TEST_EQ(
+        expire_until(wheel, start + max_delta + 1000), std::size_t(1));
+    HPX_TEST_EQ(
+        expire_until(wheel, start + 3 * max_delta - 1), std::size_t(0));
+    HPX_TEST_EQ(expire_until(wheel, start + 3 * max_delta), std::size_t(1));
+    HPX_TEST_EQ(wheel.size(), std::size_t(0));
+}
+
+int main()
+{
+    test_insert_cancel();
+    test_cascade();
+    test_wrap_around();
+    test_expiry_past_top_level();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,107 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that work posted to an idle thread pool is picked up
+// promptly. Idle worker threads park with a back-off timeout which is made
+// much larger than the bound checked here, thus a missed wake-up (e.g. a
+// worker parking concurrently with the work being posted) makes the test
+// fail instead of being hidden by the timeout.
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+constexpr std::size_t num_rounds = 50;
+constexpr std::size_t num_racing_rounds = 10000;
+
+constexpr std::chrono::seconds bound(1);
+
+bool post_and_wait(std::size_t num_tasks)
+{
+    std::vector<std::promise<void>> promises(num_tasks);
+    std::vector<std::future<void>> futures;
+    futures.reserve(num_tasks);
+    for (auto& p : promises)
+    {
+        futures.push_back(p.get_future());
+        hpx::apply([&p]() { p.set_value(); });
+    }
+
+    auto const deadline = std::chrono::steady_clock::now() + bound;
+    for (auto& f : futures)
+    {
+        if (f.wait_until(deadline) != std::future_status::ready)
+        {
+            // the remaining tasks still refer to the promises, wait for them
+            // to run eventually before destroying the promises
+            for (auto& g : futures)
+            {
+                g.wait();
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
+void test_worker_parking(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {
+        "hpx.os_threads=" +
+            std::to_string((std::min)(std::size_t(4),
+                std::size_t(hpx::threads::hardware_concurrency()))),
+        "hpx.max_idle_loop_count=100", "hpx.max_idle_backoff_time=10000"};
+
+    hpx::local::start(nullptr, argc, argv, init_args);
+
+    std::size_t const num_workers = hpx::get_num_worker_threads();
+
+    // let all worker threads park before posting a single task
+    bool ok = true;
+    for (std::size_t i = 0; ok && i != num_rounds; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        ok = post_and_wait(1);
+    }
+    HPX_TEST(ok);
+
+    // let all worker threads park before posting a task for each of them
+    for (std::size_t i = 0; ok && i != num_rounds; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        ok = post_and_wait(2 * num_workers);
+    }
+    HPX_TEST(ok);
+
+    // post work while worker threads are about to park
+    for (std::size_t i = 0; ok && i != num_racing_rounds; ++i)
+    {
+        ok = post_and_wait(1);
+    }
+    HPX_TEST(ok);
+
+    hpx::apply([]() { hpx::local::finalize(); });
+
+    HPX_TEST_EQ(hpx::local::stop(), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    test_worker_parking(argc, argv);
+
+    return hpx::util::report_errors();
+}
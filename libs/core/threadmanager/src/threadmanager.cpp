@@ -141,6 +141,17 @@ namespace hpx { namespace threads {
             hpx::util::get_entry_as<std::int64_t>(rtcfg_,
                 "hpx.thread_queue.init_threads_count",
                 HPX_THREAD_QUEUE_INIT_THREADS_COUNT);
+        std::int64_t const max_recycled_thread_count =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.thread_queue.max_recycled_thread_count",
+                HPX_THREAD_QUEUE_MAX_RECYCLED_THREAD_COUNT);
+        bool const lock_free_recycling = hpx::util::get_entry_as<int>(rtcfg_,
+            "hpx.thread_queue.lock_free_recycling",
+            HPX_THREAD_QUEUE_LOCK_FREE_RECYCLING) != 0;
+        std::int64_t const max_lifo_slot_runs =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.thread_queue.max_lifo_slot_runs",
+                HPX_THREAD_QUEUE_MAX_LIFO_SLOT_RUNS);
         double const max_idle_backoff_time = hpx::util::get_entry_as<double>(
             rtcfg_, "hpx.max_idle_backoff_time", HPX_IDLE_BACKOFF_TIME_MAX);
 
@@ -152,13 +163,17 @@ namespace hpx { namespace threads {
             rtcfg_.get_stack_size(thread_stacksize::large);
         std::ptrdiff_t huge_stacksize =
             rtcfg_.get_stack_size(thread_stacksize::huge);
+        std::ptrdiff_t reduced_stacksize =
+            rtcfg_.get_stack_size(thread_stacksize::reduced);
 
         policies::thread_queue_init_parameters thread_queue_init(
             max_thread_count, min_tasks_to_steal_pending,
             min_tasks_to_steal_staged, min_add_new_count, max_add_new_count,
             min_delete_count, max_delete_count, max_terminated_threads,
             init_threads_count, max_idle_backoff_time, small_stacksize,
-            medium_stacksize, large_stacksize, huge_stacksize);
+            medium_stacksize, large_stacksize, huge_stacksize,
+            reduced_stacksize, max_recycled_thread_count, max_lifo_slot_runs,
+            lock_free_recycling);
 
         if (!rtcfg_.enable_networking())
         {
@@ -515,6 +530,44 @@ namespace hpx { namespace threads {
                 pools_.push_back(HPX_MOVE(pool));
                 break;
             }
+
+            case resource::local_workstealing:
+            {
+                // set parameters for scheduler and pool instantiation and
+                // perform compatibility checks
+                std::size_t num_high_priority_queues =
+                    hpx::util::get_entry_as<std::size_t>(rtcfg_,
+                        "hpx.thread_queue.high_priority_queues",
+                        thread_pool_init.num_threads_);
+                detail::check_num_high_priority_queues(
+                    thread_pool_init.num_threads_, num_high_priority_queues);
+
+                // instantiate the scheduler
+                using local_sched_type =
+                    hpx::threads::policies::local_workstealing_scheduler<>;
+
+                local_sched_type::init_parameter_type init(
+                    thread_pool_init.num_threads_,
+                    thread_pool_init.affinity_data_, num_high_priority_queues,
+                    thread_queue_init, "core-local_workstealing_scheduler");
+
+                std::unique_ptr<local_sched_type> sched(
+                    new local_sched_type(init));
+
+                // set the default scheduler flags
+                sched->set_scheduler_mode(thread_pool_init.mode_);
+                // conditionally set/unset this flag
+                sched->update_scheduler_mode(
+                    policies::scheduler_mode::enable_stealing_numa,
+                    !numa_sensitive);
+
+                // instantiate the pool
+                std::unique_ptr<thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<
+                        local_sched_type>(HPX_MOVE(sched), thread_pool_init));
+                pools_.push_back(HPX_MOVE(pool));
+                break;
+            }
             }
 
             // update the thread_offset for the next pool
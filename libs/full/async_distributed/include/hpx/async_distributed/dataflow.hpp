@@ -9,7 +9,7 @@
 #include <hpx/config.hpp>
 #include <hpx/actions_base/basic_action_fwd.hpp>
 #include <hpx/actions_base/traits/extract_action.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_base/traits/is_launch_policy.hpp>
 #include <hpx/async_local/dataflow.hpp>
@@ -131,12 +131,12 @@ namespace hpx {
             typename std::enable_if<traits::is_action<Action>::value>::type>
     HPX_FORCEINLINE auto dataflow(T0&& t0, Ts&&... ts)
         -> decltype(lcos::detail::dataflow_action_dispatch<Action, T0>::call(
-            hpx::util::internal_allocator<>{}, HPX_FORWARD(T0, t0),
-            HPX_FORWARD(Ts, ts)...))
+            hpx::util::thread_local_caching_allocator<>{},
+            HPX_FORWARD(T0, t0), HPX_FORWARD(Ts, ts)...))
     {
         return lcos::detail::dataflow_action_dispatch<Action, T0>::call(
-            hpx::util::internal_allocator<>{}, HPX_FORWARD(T0, t0),
-            HPX_FORWARD(Ts, ts)...);
+            hpx::util::thread_local_caching_allocator<>{},
+            HPX_FORWARD(T0, t0), HPX_FORWARD(Ts, ts)...);
     }
 
     template <typename Action, typename Allocator, typename T0, typename... Ts,
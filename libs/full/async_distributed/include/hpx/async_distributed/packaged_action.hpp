@@ -11,7 +11,7 @@
 #include <hpx/actions_base/traits/action_priority.hpp>
 #include <hpx/actions_base/traits/action_was_object_migrated.hpp>
 #include <hpx/actions_base/traits/extract_action.hpp>
-#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_distributed/applier/apply.hpp>
 #include <hpx/async_distributed/applier/apply_callback.hpp>
@@ -279,7 +279,8 @@ namespace hpx { namespace lcos {
         // use this instance its member function \a apply needs to be directly
         // called.
         packaged_action()
-          : base_type(std::allocator_arg, hpx::util::internal_allocator<>{})
+          : base_type(std::allocator_arg,
+                hpx::util::thread_local_caching_allocator<>{})
         {
         }
 
@@ -421,8 +422,8 @@ namespace hpx { namespace lcos {
         /// use this instance its member function \a apply needs to be directly
         /// called.
         packaged_action()
-          : packaged_action<Action, Result, false>(
-                std::allocator_arg, hpx::util::internal_allocator<>{})
+          : packaged_action<Action, Result, false>(std::allocator_arg,
+                hpx::util::thread_local_caching_allocator<>{})
         {
         }
 
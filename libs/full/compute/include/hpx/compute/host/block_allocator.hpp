@@ -16,7 +16,7 @@
 #include <hpx/compute/host/block_executor.hpp>
 #include <hpx/compute/host/target.hpp>
 #include <hpx/datastructures/tuple.hpp>
-#include <hpx/execution/executors/static_chunk_size.hpp>
+#include <hpx/execution/executors/numa_affine_chunks.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/executors/restricted_thread_pool_executor.hpp>
 #include <hpx/functional/invoke_fused.hpp>
@@ -234,7 +234,10 @@ namespace hpx { namespace compute { namespace host {
 
     /// The block_allocator allocates blocks of memory evenly divided onto the
     /// passed vector of targets. This is done by using first touch memory
-    /// placement.
+    /// placement. The memory is touched using the \a numa_affine_chunks
+    /// executor parameters, loops using a \a block_executor on the same
+    /// targets with the same parameters access the memory local to the
+    /// executing worker thread.
     ///
     /// This allocator can be used to write NUMA aware algorithms:
     ///
@@ -251,11 +254,11 @@ namespace hpx { namespace compute { namespace host {
     struct block_allocator
       : public detail::policy_allocator<T,
             hpx::execution::parallel_policy_shim<block_executor<Executor>,
-                typename block_executor<Executor>::executor_parameters_type>>
+                hpx::execution::experimental::numa_affine_chunks>>
     {
         using executor_type = block_executor<Executor>;
         using executor_parameters_type =
-            typename executor_type::executor_parameters_type;
+            hpx::execution::experimental::numa_affine_chunks;
         using policy_type = hpx::execution::parallel_policy_shim<executor_type,
             executor_parameters_type>;
         using base_type = detail::policy_allocator<T, policy_type>;
@@ -11,7 +11,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
 #include <hpx/execution/executors/execution_information.hpp>
-#include <hpx/execution/executors/static_chunk_size.hpp>
+#include <hpx/execution/executors/numa_affine_chunks.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/parallel/algorithms/for_each.hpp>
@@ -90,19 +90,22 @@ namespace hpx { namespace parallel { namespace util {
             pointer p =
                 reinterpret_cast<pointer>(topo_.allocate(cnt * sizeof(T)));
 
-            // first touch policy, distribute evenly onto executors
-            std::size_t part_size = cnt / executors_.size();
+            // first touch policy, distribute evenly onto executors; the
+            // boundaries (i * cnt) / num_executors differ from those of
+            // numa_affine_chunks by less than one element per preceding chunk
+            std::size_t const num_executors = executors_.size();
             std::vector<hpx::future<void>> first_touch;
             first_touch.reserve(executors_.size());
 
-            for (std::size_t i = 0; i != executors_.size(); ++i)
+            for (std::size_t i = 0; i != num_executors; ++i)
             {
-                pointer begin = p + i * part_size;
-                pointer end = begin + part_size;
+                pointer begin = p + (i * cnt) / num_executors;
+                pointer end = p + ((i + 1) * cnt) / num_executors;
                 first_touch.push_back(hpx::for_each(
                     hpx::execution::par(hpx::execution::task)
                         .on(executors_[i])
-                        .with(hpx::execution::static_chunk_size()),
+                        .with(hpx::execution::experimental::
+                                numa_affine_chunks()),
                     begin, end,
 #if defined(HPX_DEBUG)
                     [this, i]
@@ -50,6 +50,8 @@
 #include <hpx/string_util/split.hpp>
 #include <hpx/threading/thread.hpp>
 #include <hpx/threading_base/detail/get_default_timer_service.hpp>
+#include <hpx/threading_base/detail/stack_usage.hpp>
+#include <hpx/threading_base/detail/wait_time_samples.hpp>
 #include <hpx/type_support/pack.hpp>
 #include <hpx/type_support/unused.hpp>
 #include <hpx/util/from_string.hpp>
@@ -340,7 +342,15 @@ namespace hpx {
     defined(__FreeBSD__)
             threads::coroutines::detail::posix::use_guard_pages =
                 cmdline.rtcfg_.use_stack_guard_pages();
+            threads::coroutines::detail::posix::stack_pool::get().configure(
+                cmdline.rtcfg_.get_stack_pool_watermark(),
+                cmdline.rtcfg_.get_stack_pool_max_size());
 #endif
+            threads::detail::set_stack_usage_tracking(
+                cmdline.rtcfg_.track_stack_usage(),
+                cmdline.rtcfg_.adapt_stack_size());
+            threads::detail::set_wait_time_sample_interval(
+                cmdline.rtcfg_.get_wait_time_sample_interval());
 #ifdef HPX_HAVE_VERIFY_LOCKS
             if (cmdline.rtcfg_.enable_lock_detection())
             {
@@ -10,6 +10,10 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+#include <hpx/coroutines/detail/stack_pool.hpp>
+#endif
+#include <hpx/execution/executors/adaptive_chunk_size.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/modules/errors.hpp>
@@ -18,12 +22,25 @@
 #include <hpx/performance_counters/counters.hpp>
 #include <hpx/performance_counters/manage_counter_type.hpp>
 #include <hpx/performance_counters/threadmanager_counter_types.hpp>
+#include <hpx/runtime_local/get_os_thread_count.hpp>
 #include <hpx/runtime_local/thread_pool_helpers.hpp>
+#include <hpx/threading_base/detail/stack_usage.hpp>
+#include <hpx/threading_base/detail/stackless_fast_path.hpp>
+#include <hpx/threading_base/detail/wait_time_samples.hpp>
 #include <hpx/schedulers/maintain_queue_wait_times.hpp>
+#include <hpx/statistics/histogram.hpp>
+#include <hpx/string_util/classification.hpp>
+#include <hpx/string_util/split.hpp>
+#include <hpx/synchronization/adaptive_mutex.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <boost/accumulators/accumulators.hpp>
 
 #include <cstddef>
 #include <cstdint>
+#include <string>
 #include <utility>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace performance_counters { namespace detail {
@@ -430,6 +447,361 @@ namespace hpx { namespace performance_counters { namespace detail {
         return naming::invalid_gid;
     }
 #endif
+
+    ///////////////////////////////////////////////////////////////////////
+    // stack pool counter creation function
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+    naming::gid_type stack_pool_counter_creator(
+        counter_info const& info, error_code& ec)
+    {
+        // verify the validity of the counter instance name
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+        {
+            return naming::invalid_gid;
+        }
+
+        using threads::coroutines::detail::posix::stack_pool;
+        stack_pool& pool = stack_pool::get();
+
+        struct creator_data
+        {
+            char const* const countername;
+            hpx::function<std::int64_t(bool)> total_func;
+        };
+
+        creator_data data[] = {
+            // /threads{locality#%d/total}/count/stack-pool-hits
+            {"count/stack-pool-hits",
+                hpx::bind_front(&stack_pool::get_hit_count, &pool)},
+            // /threads{locality#%d/total}/count/stack-pool-misses
+            {"count/stack-pool-misses",
+                hpx::bind_front(&stack_pool::get_miss_count, &pool)},
+            // /threads{locality#%d/total}/count/stack-pool-releases
+            {"count/stack-pool-releases",
+                hpx::bind_front(&stack_pool::get_release_count, &pool)},
+            // /threads{locality#%d/total}/stack-pool/cached
+            {"stack-pool/cached",
+                hpx::bind_front(&stack_pool::get_cached_bytes, &pool)},
+            // /threads{locality#%d/total}/stack-pool/resident
+            {"stack-pool/resident",
+                hpx::bind_front(&stack_pool::get_resident_bytes, &pool)},
+        };
+        std::size_t const data_size = sizeof(data) / sizeof(data[0]);
+
+        for (creator_data const* d = data; d < &data[data_size]; ++d)
+        {
+            if (paths.countername_ == d->countername)
+            {
+                return counter_creator(info, paths, d->total_func,
+                    hpx::function<std::int64_t(bool)>(), "", 0, ec);
+            }
+        }
+
+        HPX_THROWS_IF(ec, bad_parameter, "stack_pool_counter_creator",
+            "invalid counter name: {}", paths.countername_);
+        return naming::invalid_gid;
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////
+    // stack usage counter creation function
+    naming::gid_type stack_usage_counter_creator(
+        counter_info const& info, error_code& ec)
+    {
+        // verify the validity of the counter instance name
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+        {
+            return naming::invalid_gid;
+        }
+
+        struct creator_data
+        {
+            char const* const countername;
+            hpx::function<std::int64_t(bool)> total_func;
+        };
+
+        // /threads{locality#%d/total}/stack-usage/high-water-mark@description
+        if (paths.countername_ == "stack-usage/high-water-mark" &&
+            !paths.parameters_.empty())
+        {
+            return counter_creator(info, paths,
+                hpx::bind_front(&threads::detail::
+                                    get_description_stack_usage_high_water_mark,
+                    paths.parameters_),
+                hpx::function<std::int64_t(bool)>(), "", 0, ec);
+        }
+
+        creator_data data[] = {
+            // /threads{locality#%d/total}/stack-usage/high-water-mark
+            {"stack-usage/high-water-mark",
+                &threads::detail::get_stack_usage_high_water_mark},
+            // /threads{locality#%d/total}/count/stack-size-adjustments
+            {"count/stack-size-adjustments",
+                &threads::detail::get_stack_size_adjustment_count},
+            // /threads{locality#%d/total}/count/stackless-fast-path
+            {"count/stackless-fast-path",
+                &threads::detail::get_stackless_fast_path_count},
+        };
+        std::size_t const data_size = sizeof(data) / sizeof(data[0]);
+
+        for (creator_data const* d = data; d < &data[data_size]; ++d)
+        {
+            if (paths.countername_ == d->countername)
+            {
+                return counter_creator(info, paths, d->total_func,
+                    hpx::function<std::int64_t(bool)>(), "", 0, ec);
+            }
+        }
+
+        HPX_THROWS_IF(ec, bad_parameter, "stack_usage_counter_creator",
+            "invalid counter name: {}", paths.countername_);
+        return naming::invalid_gid;
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // lock contention counter creation function
+    naming::gid_type lock_contention_counter_creator(
+        counter_info const& info, error_code& ec)
+    {
+        // verify the validity of the counter instance name
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+        {
+            return naming::invalid_gid;
+        }
+
+        struct creator_data
+        {
+            char const* const countername;
+            hpx::function<std::int64_t(bool)> total_func;
+        };
+
+        creator_data data[] = {
+            // /locks{locality#%d/total}/count/acquisitions
+            {"count/acquisitions",
+                &lcos::local::detail::get_adaptive_mutex_acquisitions},
+            // /locks{locality#%d/total}/count/contended
+            {"count/contended",
+                &lcos::local::detail::get_adaptive_mutex_contended},
+            // /locks{locality#%d/total}/time/spinning
+            {"time/spinning",
+                &lcos::local::detail::get_adaptive_mutex_spin_time},
+            // /locks{locality#%d/total}/count/suspensions
+            {"count/suspensions",
+                &lcos::local::detail::get_adaptive_mutex_suspensions},
+        };
+        std::size_t const data_size = sizeof(data) / sizeof(data[0]);
+
+        for (creator_data const* d = data; d < &data[data_size]; ++d)
+        {
+            if (paths.countername_ == d->countername)
+            {
+                return counter_creator(info, paths, d->total_func,
+                    hpx::function<std::int64_t(bool)>(), "", 0, ec);
+            }
+        }
+
+        HPX_THROWS_IF(ec, bad_parameter, "lock_contention_counter_creator",
+            "invalid counter name: {}", paths.countername_);
+        return naming::invalid_gid;
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // adaptive chunk size counter creation function, the counter parameter
+    // selects the call site
+    naming::gid_type adaptive_chunking_counter_creator(
+        counter_info const& info, error_code& ec)
+    {
+        // verify the validity of the counter instance name
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+        {
+            return naming::invalid_gid;
+        }
+
+        using parallel::execution::detail::
+            get_adaptive_chunk_size_chunk_size;
+        using parallel::execution::detail::
+            get_adaptive_chunk_size_iteration_time;
+        using parallel::execution::detail::
+            get_adaptive_chunk_size_measurements;
+        using parallel::execution::detail::
+            get_adaptive_chunk_size_task_overhead;
+
+        struct creator_data
+        {
+            char const* const countername;
+            std::int64_t (*func)(std::string const&, bool);
+        };
+
+        creator_data data[] = {
+            // /chunking{locality#%d/total}/time/iteration@site
+            {"time/iteration", &get_adaptive_chunk_size_iteration_time},
+            // /chunking{locality#%d/total}/time/task-overhead@site
+            {"time/task-overhead", &get_adaptive_chunk_size_task_overhead},
+            // /chunking{locality#%d/total}/count/chunk-size@site
+            {"count/chunk-size", &get_adaptive_chunk_size_chunk_size},
+            // /chunking{locality#%d/total}/count/measurements@site
+            {"count/measurements", &get_adaptive_chunk_size_measurements},
+        };
+        std::size_t const data_size = sizeof(data) / sizeof(data[0]);
+
+        if (paths.countername_ == "count/sites")
+        {
+            return counter_creator(info, paths,
+                &parallel::execution::detail::get_adaptive_chunk_size_sites,
+                hpx::function<std::int64_t(bool)>(), "", 0, ec);
+        }
+
+        for (creator_data const* d = data; d < &data[data_size]; ++d)
+        {
+            if (paths.countername_ == d->countername)
+            {
+                return counter_creator(info, paths,
+                    hpx::bind_front(d->func, paths.parameters_),
+                    hpx::function<std::int64_t(bool)>(), "", 0, ec);
+            }
+        }
+
+        HPX_THROWS_IF(ec, bad_parameter, "adaptive_chunking_counter_creator",
+            "invalid counter name: {}", paths.countername_);
+        return naming::invalid_gid;
+    }
+
+    ///////////////////////////////////////////////////////////////////////
+    // Turn the sampled wait times into a histogram. The first three values
+    // are the lower and upper boundaries and the number of buckets, the
+    // remaining values are the fractions (multiplied by 1000) of the samples
+    // in each bucket (the first and the last of these cover the samples below
+    // and above the given range).
+    std::vector<std::int64_t> get_wait_time_histogram(
+        threads::detail::wait_time_kind kind, std::size_t num_thread,
+        std::int64_t min_boundary, std::int64_t max_boundary,
+        std::int64_t num_buckets, bool reset)
+    {
+        std::vector<std::int64_t> const samples =
+            threads::detail::get_wait_time_samples(kind, num_thread, reset);
+
+        using histogram_collector_type = boost::accumulators::accumulator_set<
+            double, boost::accumulators::features<hpx::util::tag::histogram>>;
+
+        histogram_collector_type hist(
+            hpx::util::tag::histogram::num_bins =
+                static_cast<std::size_t>(num_buckets),
+            hpx::util::tag::histogram::min_range = double(min_boundary),
+            hpx::util::tag::histogram::max_range = double(max_boundary));
+
+        for (std::int64_t sample : samples)
+        {
+            hist(double(sample));
+        }
+
+        std::vector<std::int64_t> result;
+        result.reserve(num_buckets + 5);
+        result.push_back(min_boundary);
+        result.push_back(max_boundary);
+        result.push_back(num_buckets);
+
+        if (samples.empty())
+        {
+            result.resize(num_buckets + 5, 0);
+            return result;
+        }
+
+        for (auto const& item : hpx::util::histogram(hist))
+        {
+            result.push_back(std::int64_t(item.second * 1000));
+        }
+        return result;
+    }
+
+    // wait time histogram counter creation function
+    // /threads{locality#%d/total}/wait-time/histogram@min,max,buckets
+    // /threads{locality#%d/worker-thread#%d}/wait-time/histogram@min,max,...
+    naming::gid_type wait_time_histogram_counter_creator(
+        threads::detail::wait_time_kind kind, counter_info const& info,
+        error_code& ec)
+    {
+        // verify the validity of the counter instance name
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+        {
+            return naming::invalid_gid;
+        }
+
+        if (paths.parentinstance_is_basename_)
+        {
+            HPX_THROWS_IF(ec, bad_parameter,
+                "wait_time_histogram_counter_creator",
+                "invalid counter instance parent name: {}",
+                paths.parentinstancename_);
+            return naming::invalid_gid;
+        }
+
+        // the default histogram covers [0, 1ms) using 20 buckets
+        std::int64_t min_boundary = 0;
+        std::int64_t max_boundary = 1000000;
+        std::int64_t num_buckets = 20;
+
+        if (!paths.parameters_.empty())
+        {
+            std::vector<std::string> params;
+            hpx::string_util::split(
+                params, paths.parameters_, hpx::string_util::is_any_of(","));
+
+            if (params.size() != 3)
+            {
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "wait_time_histogram_counter_creator",
+                    "the parameters of a wait time histogram counter have to "
+                    "be given as 'min,max,buckets': {}",
+                    paths.parameters_);
+                return naming::invalid_gid;
+            }
+
+            min_boundary = hpx::util::from_string<std::int64_t>(params[0], -1);
+            max_boundary = hpx::util::from_string<std::int64_t>(params[1], -1);
+            num_buckets = hpx::util::from_string<std::int64_t>(params[2], -1);
+        }
+
+        if (min_boundary < 0 || max_boundary <= min_boundary ||
+            num_buckets <= 0)
+        {
+            HPX_THROWS_IF(ec, bad_parameter,
+                "wait_time_histogram_counter_creator",
+                "invalid parameters for a wait time histogram counter: {}",
+                paths.parameters_);
+            return naming::invalid_gid;
+        }
+
+        std::size_t num_thread = std::size_t(-1);
+        if (paths.instancename_ == "worker-thread" &&
+            paths.instanceindex_ >= 0 &&
+            std::size_t(paths.instanceindex_) < hpx::get_os_thread_count())
+        {
+            num_thread = static_cast<std::size_t>(paths.instanceindex_);
+        }
+        else if (paths.instancename_ != "total" || paths.instanceindex_ != -1)
+        {
+            HPX_THROWS_IF(ec, bad_parameter,
+                "wait_time_histogram_counter_creator",
+                "invalid counter instance name: {}", paths.instancename_);
+            return naming::invalid_gid;
+        }
+
+        using detail::create_raw_counter;
+        hpx::function<std::vector<std::int64_t>(bool)> f =
+            hpx::bind_front(&get_wait_time_histogram, kind, num_thread,
+                min_boundary, max_boundary, num_buckets);
+        return create_raw_counter(info, HPX_MOVE(f), ec);
+    }
 }}}    // namespace hpx::performance_counters::detail
 
 namespace hpx { namespace performance_counters {
@@ -441,6 +813,16 @@ namespace hpx { namespace performance_counters {
         create_counter_func counts_creator(
             hpx::bind_front(&detail::thread_counts_counter_creator));
 #endif
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+        create_counter_func stack_pool_creator(
+            hpx::bind_front(&detail::stack_pool_counter_creator));
+#endif
+        create_counter_func stack_usage_creator(
+            hpx::bind_front(&detail::stack_usage_counter_creator));
+        create_counter_func lock_contention_creator(
+            hpx::bind_front(&detail::lock_contention_counter_creator));
+        create_counter_func adaptive_chunking_creator(
+            hpx::bind_front(&detail::adaptive_chunking_counter_creator));
 
         generic_counter_type_data counter_types[] = {
             // length of thread queue(s)
@@ -697,6 +1079,114 @@ namespace hpx { namespace performance_counters {
                 HPX_PERFORMANCE_COUNTER_V1, counts_creator,
                 &detail::locality_allocator_counter_discoverer, ""},
 #endif
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+            {"/threads/count/stack-pool-hits",
+                counter_monotonically_increasing,
+                "returns the total number of HPX-thread stacks which were "
+                "reused from the stack pool for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, stack_pool_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-pool-misses",
+                counter_monotonically_increasing,
+                "returns the total number of HPX-thread stacks which had to "
+                "be newly mapped for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, stack_pool_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-pool-releases",
+                counter_monotonically_increasing,
+                "returns the total number of cached HPX-thread stacks whose "
+                "memory was released (madvise) for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, stack_pool_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/stack-pool/cached", counter_raw,
+                "returns the current size of the HPX-thread stacks held by "
+                "the stack pool for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, stack_pool_creator,
+                &locality_counter_discoverer, "bytes"},
+            {"/threads/stack-pool/resident", counter_raw,
+                "returns the current size of the HPX-thread stacks held by "
+                "the stack pool whose memory was not released for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, stack_pool_creator,
+                &locality_counter_discoverer, "bytes"},
+#endif
+            {"/threads/stack-usage/high-water-mark", counter_raw,
+                "returns the largest stack usage of any terminated HPX-thread "
+                "(or of the HPX-threads with the annotation or action name "
+                "given as the counter parameter) for the referenced locality "
+                "(requires hpx.stacks.track_usage=1)",
+                HPX_PERFORMANCE_COUNTER_V1, stack_usage_creator,
+                &locality_counter_discoverer, "bytes"},
+            {"/threads/count/stack-size-adjustments",
+                counter_monotonically_increasing,
+                "returns the total number of HPX-threads whose stack size was "
+                "changed by the adaptive stack size policy for the referenced "
+                "locality (requires hpx.stacks.adaptive_size=1)",
+                HPX_PERFORMANCE_COUNTER_V1, stack_usage_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stackless-fast-path",
+                counter_monotonically_increasing,
+                "returns the total number of HPX-threads which were run "
+                "without a stack as they are known not to suspend for the "
+                "referenced locality (see hpx::traits::is_stackless_callable)",
+                HPX_PERFORMANCE_COUNTER_V1, stack_usage_creator,
+                &locality_counter_discoverer, ""},
+            {"/locks/count/acquisitions", counter_monotonically_increasing,
+                "returns the total number of times any adaptive mutex was "
+                "acquired on the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, lock_contention_creator,
+                &locality_counter_discoverer, ""},
+            {"/locks/count/contended", counter_monotonically_increasing,
+                "returns the total number of times a thread tried to acquire "
+                "an adaptive mutex which was held by another thread on the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, lock_contention_creator,
+                &locality_counter_discoverer, ""},
+            {"/locks/time/spinning", counter_monotonically_increasing,
+                "returns the accumulated time threads spent spinning while "
+                "waiting for an adaptive mutex on the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, lock_contention_creator,
+                &locality_counter_discoverer, "ns"},
+            {"/locks/count/suspensions", counter_monotonically_increasing,
+                "returns the total number of times a thread was suspended "
+                "while waiting for an adaptive mutex on the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1, lock_contention_creator,
+                &locality_counter_discoverer, ""},
+            {"/chunking/count/sites", counter_raw,
+                "returns the number of call sites of parallel algorithms for "
+                "which the adaptive_chunk_size executor parameters have "
+                "learned values on the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, adaptive_chunking_creator,
+                &locality_counter_discoverer, ""},
+            {"/chunking/time/iteration", counter_raw,
+                "returns the execution time of one loop iteration measured by "
+                "the adaptive_chunk_size executor parameters for the call site "
+                "given as the counter parameter (averaged over all call sites "
+                "if none is given) on the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, adaptive_chunking_creator,
+                &locality_counter_discoverer, "ns"},
+            {"/chunking/time/task-overhead", counter_raw,
+                "returns the task overhead measured by the "
+                "adaptive_chunk_size executor parameters for the call site "
+                "given as the counter parameter (averaged over all call sites "
+                "if none is given) on the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, adaptive_chunking_creator,
+                &locality_counter_discoverer, "ns"},
+            {"/chunking/count/chunk-size", counter_raw,
+                "returns the chunk size last chosen by the adaptive_chunk_size "
+                "executor parameters for the call site given as the counter "
+                "parameter (averaged over all call sites if none is given) on "
+                "the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, adaptive_chunking_creator,
+                &locality_counter_discoverer, ""},
+            {"/chunking/count/measurements", counter_monotonically_increasing,
+                "returns the number of measurements taken by the "
+                "adaptive_chunk_size executor parameters for the call site "
+                "given as the counter parameter (for all call sites if none is "
+                "given) on the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, adaptive_chunking_creator,
+                &locality_counter_discoverer, ""},
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
             {"/threads/count/pending-misses", counter_monotonically_increasing,
                 "returns the number of times that the referenced worker-thread "
@@ -780,7 +1270,32 @@ namespace hpx { namespace performance_counters {
                 hpx::bind_front(
                     &detail::locality_pool_thread_no_total_counter_creator, &tm,
                     &threads::thread_pool_base::get_busy_loop_count),
-                &locality_pool_thread_no_total_counter_discoverer, ""}
+                &locality_pool_thread_no_total_counter_discoverer, ""},
+            // wait time histograms
+            {"/threads/wait-time/histogram", counter_histogram,
+                "returns the histogram of the (sampled) times HPX-threads "
+                "spent in the pending queue of the referenced worker-thread "
+                "before being run by it (parameters: 'min,max,buckets')",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::wait_time_histogram_counter_creator,
+                    threads::detail::wait_time_kind::queue),
+                &locality_thread_counter_discoverer, "ns"},
+            {"/threads/wait-time/steal-histogram", counter_histogram,
+                "returns the histogram of the (sampled) times HPX-threads "
+                "spent in a pending queue before being stolen by the "
+                "referenced worker-thread (parameters: 'min,max,buckets')",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::wait_time_histogram_counter_creator,
+                    threads::detail::wait_time_kind::steal),
+                &locality_thread_counter_discoverer, "ns"},
+            {"/threads/wait-time/first-run-histogram", counter_histogram,
+                "returns the histogram of the (sampled) times from creating "
+                "HPX-threads until they were run for the first time by the "
+                "referenced worker-thread (parameters: 'min,max,buckets')",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::wait_time_histogram_counter_creator,
+                    threads::detail::wait_time_kind::first_run),
+                &locality_thread_counter_discoverer, "ns"}
         };
 
         install_counter_types(
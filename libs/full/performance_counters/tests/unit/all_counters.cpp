@@ -83,8 +83,31 @@ char const* const locality_counter_names[] = {
     "/threads/count/stack-unbinds",
 #endif
 #endif
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+    "/threads/count/stack-pool-hits",
+    "/threads/count/stack-pool-misses",
+    "/threads/count/stack-pool-releases",
+    "/threads/stack-pool/cached",
+    "/threads/stack-pool/resident",
+#endif
+    "/threads/stack-usage/high-water-mark",
+    "/threads/count/stack-size-adjustments",
+    "/threads/count/stackless-fast-path",
+    "/locks/count/acquisitions",
+    "/locks/count/contended",
+    "/locks/time/spinning",
+    "/locks/count/suspensions",
+    "/chunking/count/sites",
+    "/chunking/time/iteration",
+    "/chunking/time/task-overhead",
+    "/chunking/count/chunk-size",
+    "/chunking/count/measurements",
     "/scheduler/utilization/instantaneous", nullptr};
 
+char const* const locality_thread_histogram_counter_names[] = {
+    "/threads/wait-time/histogram", "/threads/wait-time/steal-histogram",
+    "/threads/wait-time/first-run-histogram", nullptr};
+
 ///////////////////////////////////////////////////////////////////////////////
 void test_all_locality_thread_counters(char const* const* counter_names,
     std::size_t locality_id, std::size_t pool, std::size_t core)
@@ -146,6 +169,55 @@ void test_all_locality_thread_counters(char const* const* counter_names,
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void test_all_locality_histogram_counters(
+    std::size_t locality_id, std::size_t core)
+{
+    for (char const* const* p = locality_thread_histogram_counter_names;
+         *p != nullptr; ++p)
+    {
+        hpx::performance_counters::counter_path_elements path;
+        HPX_TEST_EQ(
+            hpx::performance_counters::get_counter_path_elements(*p, path),
+            hpx::performance_counters::status_valid_data);
+
+        path.parentinstancename_ = "locality";
+        path.parentinstanceindex_ = locality_id;
+        if (core != std::size_t(-1))
+        {
+            path.instancename_ = "worker-thread";
+            path.instanceindex_ = core;
+        }
+        else
+        {
+            path.instancename_ = "total";
+            path.instanceindex_ = -1;
+        }
+        path.parameters_ = "0,1000000,10";
+
+        std::string name;
+        HPX_TEST_EQ(hpx::performance_counters::get_counter_name(path, name),
+            hpx::performance_counters::status_valid_data);
+
+        std::cout << name << '\n';
+
+        try
+        {
+            hpx::performance_counters::performance_counter counter(name);
+            HPX_TEST_EQ(counter.get_name(hpx::launch::sync), name);
+
+            // lower and upper boundary, bucket size, and 10 + 2 buckets
+            auto values =
+                counter.get_counter_values_array(hpx::launch::sync, false);
+            HPX_TEST_EQ(values.values_.size(), std::size_t(15));
+        }
+        catch (...)
+        {
+            HPX_TEST(false);    // should never happen
+        }
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void test_all_locality_pool_thread_counters(
     std::size_t locality_id, std::size_t pool, std::size_t core)
@@ -201,7 +273,9 @@ void test_all_counters_locality(std::size_t locality_id)
     {
         test_all_locality_pool_thread_counters(
             locality_id, std::size_t(-1), core);
+        test_all_locality_histogram_counters(locality_id, core);
     }
+    test_all_locality_histogram_counters(locality_id, std::size_t(-1));
 
     //     // locality/thread (same as locality/pool#default/threads)
     //     test_all_locality_thread_counters(locality_id, std::size_t(-1));
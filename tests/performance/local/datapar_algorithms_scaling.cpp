@@ -0,0 +1,164 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the vectorized (simd, par_simd) versions of reduce,
+// transform_reduce, minmax_element, and inclusive_scan with their scalar
+// counterparts (seq, par).
+
+#include <hpx/local/algorithm.hpp>
+#include <hpx/local/chrono.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/numeric.hpp>
+#include <hpx/parallel/datapar.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// keeps the compiler from discarding the results of the measured algorithms
+float volatile sink = 0.0f;
+
+template <typename F>
+double measure(int count, F&& f)
+{
+    // warm up caches
+    sink = f();
+
+    std::int64_t start = hpx::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i != count; ++i)
+        sink = f();
+
+    return double(hpx::chrono::high_resolution_clock::now() - start) / count /
+        1e9;
+}
+
+template <typename ExPolicy>
+void measure_algorithms(int test_count, std::string const& name,
+    ExPolicy&& policy, std::vector<float> const& data,
+    std::vector<float>& dest, bool csvoutput)
+{
+    double reduce_time = measure(test_count, [&]() {
+        return hpx::reduce(policy, data.begin(), data.end(), 0.0f,
+            std::plus<>());
+    });
+
+    double transform_reduce_time = measure(test_count, [&]() {
+        return hpx::transform_reduce(policy, data.begin(), data.end(), 0.0f,
+            std::plus<>(), [](auto v) { return v * v; });
+    });
+
+    double minmax_element_time = measure(test_count, [&]() {
+        auto result = hpx::minmax_element(
+            policy, data.begin(), data.end(), std::less<>());
+        return *result.max - *result.min;
+    });
+
+    double inclusive_scan_time = measure(test_count, [&]() {
+        hpx::inclusive_scan(
+            policy, data.begin(), data.end(), dest.begin(), std::plus<>());
+        return dest.back();
+    });
+
+    if (csvoutput)
+    {
+        std::cout << name << "," << reduce_time << ","
+                  << transform_reduce_time << "," << minmax_element_time << ","
+                  << inclusive_scan_time << "\n"
+                  << std::flush;
+    }
+    else
+    {
+        std::cout << name << ":\n"
+                  << "  reduce:           " << std::right << std::setw(15)
+                  << reduce_time << "\n"
+                  << "  transform_reduce: " << std::right << std::setw(15)
+                  << transform_reduce_time << "\n"
+                  << "  minmax_element:   " << std::right << std::setw(15)
+                  << minmax_element_time << "\n"
+                  << "  inclusive_scan:   " << std::right << std::setw(15)
+                  << inclusive_scan_time << "\n"
+                  << std::flush;
+    }
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::random_device{}();
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::mt19937 gen(seed);
+
+    std::size_t size = vm["vector_size"].as<std::size_t>();
+    bool csvoutput = vm["csv_output"].as<int>() ? true : false;
+    int test_count = vm["test_count"].as<int>();
+
+    if (test_count <= 0)
+    {
+        std::cout << "test_count cannot be less than zero...\n" << std::flush;
+        return hpx::local::finalize();
+    }
+
+    // small integral values, the sums are exact
+    std::uniform_int_distribution<int> dis(-100, 100);
+    std::vector<float> data(size);
+    std::generate(data.begin(), data.end(), [&]() { return float(dis(gen)); });
+
+    std::vector<float> dest(size);
+
+    using namespace hpx::execution;
+
+    measure_algorithms(test_count, "seq", seq, data, dest, csvoutput);
+    measure_algorithms(test_count, "simd", simd, data, dest, csvoutput);
+    measure_algorithms(test_count, "par", par, data, dest, csvoutput);
+    measure_algorithms(test_count, "par_simd", par_simd, data, dest, csvoutput);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("vector_size"
+        , hpx::program_options::value<std::size_t>()->default_value(1048576)
+        , "size of vector")
+
+        ("csv_output"
+        , hpx::program_options::value<int>()->default_value(0)
+        , "print results in csv format")
+
+        ("test_count"
+        , hpx::program_options::value<int>()->default_value(10)
+        , "number of tests to take average from")
+
+        ("seed,s"
+        , hpx::program_options::value<unsigned int>()
+        , "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
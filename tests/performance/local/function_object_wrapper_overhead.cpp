@@ -13,9 +13,11 @@
 
 #include <hpx/modules/program_options.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <iostream>
+#include <memory>
 
 #include "worker_timed.hpp"
 
@@ -55,6 +57,29 @@ void run(F const& f, std::uint64_t local_iterations)
     std::cout << " walltime/iteration: " << ((elapsed / i) * 1e9) << " ns\n";
 }
 
+// Constructing the function object wrapper from a callable capturing a couple
+// of shared pointers and an id is what happens on every task spawn
+template <typename Function>
+void run_construct(std::uint64_t local_iterations)
+{
+    auto a = std::make_shared<std::uint64_t>(1);
+    auto b = std::make_shared<std::uint64_t>(2);
+
+    std::uint64_t i = 0;
+    std::uint64_t sum = 0;
+    hpx::chrono::high_resolution_timer t;
+
+    for (; i < local_iterations; ++i)
+    {
+        Function f = [a, b, i]() { return *a + *b + i; };
+        sum += f();
+    }
+
+    double elapsed = t.elapsed();
+    std::cout << " walltime/iteration: " << ((elapsed / i) * 1e9) << " ns"
+              << " (" << sum << ")\n";
+}
+
 int app_main(variables_map& vm)
 {
     {
@@ -78,6 +103,27 @@ int app_main(variables_map& vm)
         run(f, iterations);
     }
 
+    // heap spills are counted only if HPX_WITH_FUNCTION_HEAP_SPILL_COUNTING=ON
+    hpx::util::get_function_heap_spill_count(true);
+    {
+        std::cout << "construct hpx::move_only_function (default storage)";
+        run_construct<hpx::move_only_function<std::uint64_t()>>(iterations);
+        std::cout << "  heap spills: "
+                  << hpx::util::get_function_heap_spill_count(true) << "\n";
+    }
+    {
+        using function_type = hpx::move_only_function<std::uint64_t(), false,
+            5 * sizeof(void*)>;
+        std::cout << "construct hpx::move_only_function (5 pointers storage)";
+        run_construct<function_type>(iterations);
+        std::cout << "  heap spills: "
+                  << hpx::util::get_function_heap_spill_count(true) << "\n";
+    }
+    {
+        std::cout << "construct std::function";
+        run_construct<std::function<std::uint64_t()>>(iterations);
+    }
+
     return 0;
 }
 
@@ -24,6 +24,7 @@
 #include <hpx/modules/testing.hpp>
 #include <hpx/modules/timing.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
+#include <hpx/threading_base/traits/is_stackless_callable.hpp>
 
 #include <array>
 #include <atomic>
@@ -120,6 +121,23 @@ double null_function() noexcept
     return 0.0;
 }
 
+// the same function, marked as not suspending such that it is run stackless
+struct stackless_null_function
+{
+    double operator()() const noexcept
+    {
+        return null_function();
+    }
+};
+
+namespace hpx::traits {
+
+    template <>
+    struct is_stackless_callable<stackless_null_function> : std::true_type
+    {
+    };
+}    // namespace hpx::traits
+
 struct scratcher
 {
     void operator()(future<double> r) const
@@ -204,6 +222,24 @@ void measure_function_futures_wait_all(
     print_stats("async", "WaitAll", exec_name(exec), count, duration, csv);
 }
 
+template <typename Executor>
+void measure_function_futures_wait_all_stackless(
+    std::uint64_t count, bool csv, Executor& exec)
+{
+    std::vector<future<double>> futures;
+    futures.reserve(count);
+
+    // start the clock
+    high_resolution_timer walltime;
+    for (std::uint64_t i = 0; i < count; ++i)
+        futures.push_back(async(exec, stackless_null_function{}));
+    hpx::wait_all(futures);
+
+    const double duration = walltime.elapsed();
+    print_stats(
+        "async_stackless", "WaitAll", exec_name(exec), count, duration, csv);
+}
+
 template <typename Executor>
 void measure_function_futures_limiting_executor(
     std::uint64_t count, bool csv, Executor exec)
@@ -532,6 +568,7 @@ int hpx_main(variables_map& vm)
 #endif
                 measure_function_futures_wait_each(count, csv, par);
                 measure_function_futures_wait_all(count, csv, par);
+                measure_function_futures_wait_all_stackless(count, csv, par);
                 measure_function_futures_sliding_semaphore(count, csv, par);
                 measure_function_futures_for_loop(count, csv, par);
                 measure_function_futures_for_loop(count, csv, par_agg);
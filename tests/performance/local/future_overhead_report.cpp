@@ -7,17 +7,23 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/config.hpp>
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
 #include <hpx/local/chrono.hpp>
 #include <hpx/local/future.hpp>
 #include <hpx/local/init.hpp>
 #include <hpx/local/thread.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include "count_allocations.hpp"
+
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <iostream>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 using hpx::program_options::options_description;
 using hpx::program_options::value;
@@ -142,6 +148,48 @@ void measure_function_futures_create_thread_hierarchical_placement(
     hpx::util::perftests_print_times();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// create futures using async, attach a continuation to each of them and
+// report the number of heap allocations per future with and without the
+// thread local caching allocator
+void measure_function_futures_allocations(std::uint64_t count)
+{
+    auto const run = [count]() -> double {
+        std::vector<future<double>> futures;
+        futures.reserve(count);
+
+        std::uint64_t const start =
+            num_allocations.load(std::memory_order_relaxed);
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            futures.push_back(async(&null_function).then(
+                [](future<double>&& f) { return f.get(); }));
+        }
+        hpx::wait_all(futures);
+
+        std::uint64_t const allocations =
+            num_allocations.load(std::memory_order_relaxed) - start;
+        return static_cast<double>(allocations) / static_cast<double>(count);
+    };
+
+    bool const enabled = hpx::util::thread_local_caching_enabled();
+
+    // warm up the caches
+    run();
+
+    hpx::util::enable_thread_local_caching(false);
+    double const allocations_uncached = run();
+
+    hpx::util::enable_thread_local_caching(true);
+    double const allocations_cached = run();
+
+    hpx::util::enable_thread_local_caching(enabled);
+
+    std::cout << "future overhead - async/then - allocations per future: "
+              << allocations_uncached << " (without thread local caching), "
+              << allocations_cached << " (with thread local caching)\n";
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(variables_map& vm)
 {
@@ -173,6 +221,11 @@ int hpx_main(variables_map& vm)
             measure_function_futures_create_thread_hierarchical_placement(
                 count, repetitions);
         }
+
+        if (test_all || vm.count("allocations"))
+        {
+            measure_function_futures_allocations(count);
+        }
     }
 
     return hpx::local::finalize();
@@ -193,6 +246,7 @@ int main(int argc, char* argv[])
          "number of iterations in the delay loop")
 
         ("test-all", "run all benchmarks")
+        ("allocations", "report the number of heap allocations per future")
         ("repetitions", value<int>()->default_value(1),
          "number of repetitions of the full benchmark")
 
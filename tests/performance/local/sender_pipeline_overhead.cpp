@@ -0,0 +1,174 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the overheads of short future based pipelines with the equivalent
+// sender based pipelines. Both the execution time and the number of heap
+// allocations per pipeline are reported.
+
+#include <hpx/config.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include "count_allocations.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+using hpx::program_options::options_description;
+using hpx::program_options::value;
+using hpx::program_options::variables_map;
+
+namespace ex = hpx::execution::experimental;
+namespace tt = hpx::this_thread::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+// we use globals here to prevent the pipelines from being optimized away
+std::atomic<std::uint64_t> global_scratch(0);
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t increment(std::uint64_t i) noexcept
+{
+    return i + 1;
+}
+
+// value -> then -> then
+std::uint64_t future_then(std::uint64_t i)
+{
+    return hpx::make_ready_future(i)
+        .then(hpx::launch::sync,
+            [](hpx::future<std::uint64_t>&& f) { return increment(f.get()); })
+        .then(hpx::launch::sync,
+            [](hpx::future<std::uint64_t>&& f) { return increment(f.get()); })
+        .get();
+}
+
+std::uint64_t sender_then(std::uint64_t i)
+{
+    return tt::sync_wait(
+        ex::just(i) | ex::then(&increment) | ex::then(&increment));
+}
+
+// value -> two continuations -> combine
+std::uint64_t future_shared(std::uint64_t i)
+{
+    hpx::shared_future<std::uint64_t> f = hpx::make_ready_future(i);
+    auto f1 = f.then(hpx::launch::sync,
+        [](hpx::shared_future<std::uint64_t>&& f) {
+            return increment(f.get());
+        });
+    auto f2 = f.then(hpx::launch::sync,
+        [](hpx::shared_future<std::uint64_t>&& f) {
+            return increment(f.get());
+        });
+    return f1.get() + f2.get();
+}
+
+std::uint64_t sender_split(std::uint64_t i)
+{
+    auto s = ex::just(i) | ex::split();
+    return tt::sync_wait(
+        ex::when_all(s | ex::then(&increment), s | ex::then(&increment)) |
+        ex::then([](std::uint64_t a, std::uint64_t b) { return a + b; }));
+}
+
+// value -> continuation returning another asynchronous operation
+std::uint64_t future_unwrap(std::uint64_t i)
+{
+    hpx::future<std::uint64_t> f = hpx::make_ready_future(i).then(
+        hpx::launch::sync, [](hpx::future<std::uint64_t>&& f) {
+            return hpx::make_ready_future(increment(f.get()));
+        });
+    return f.get();
+}
+
+std::uint64_t sender_let_value(std::uint64_t i)
+{
+    return tt::sync_wait(ex::just(i) | ex::let_value([](std::uint64_t i) {
+        return ex::just(increment(i));
+    }));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Pipeline>
+void measure(std::string const& name, std::string const& kind,
+    std::uint64_t count, int repetitions, Pipeline pipeline)
+{
+    // warm up the caches, then report the allocations of a single run
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        global_scratch += pipeline(i);
+    }
+
+    std::uint64_t const start = num_allocations.load(std::memory_order_relaxed);
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        global_scratch += pipeline(i);
+    }
+    std::uint64_t const allocations =
+        num_allocations.load(std::memory_order_relaxed) - start;
+
+    std::cout << "pipeline overhead - " << name << " - " << kind
+              << " - allocations per pipeline: "
+              << static_cast<double>(allocations) / static_cast<double>(count)
+              << "\n";
+
+    hpx::util::perftests_report("pipeline overhead - " + name, kind,
+        repetitions, [&]() {
+            for (std::uint64_t i = 0; i != count; ++i)
+            {
+                global_scratch += pipeline(i);
+            }
+        });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    std::uint64_t const count = vm["pipelines"].as<std::uint64_t>();
+    if (HPX_UNLIKELY(0 == count))
+        throw std::logic_error("error: count of 0 pipelines specified\n");
+
+    int const repetitions = vm["repetitions"].as<int>();
+
+    measure("then", "futures", count, repetitions, &future_then);
+    measure("then", "senders", count, repetitions, &sender_then);
+    measure("split", "futures", count, repetitions, &future_shared);
+    measure("split", "senders", count, repetitions, &sender_split);
+    measure("let_value", "futures", count, repetitions, &future_unwrap);
+    measure("let_value", "senders", count, repetitions, &sender_let_value);
+
+    hpx::util::perftests_print_times();
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()("pipelines",
+        value<std::uint64_t>()->default_value(100000),
+        "number of pipelines to run for each benchmark")
+
+        ("repetitions", value<int>()->default_value(1),
+         "number of repetitions of each benchmark");
+    // clang-format on
+
+    // Initialize and run HPX.
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
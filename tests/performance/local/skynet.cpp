@@ -16,13 +16,21 @@
 
 // This code implements two versions of the skynet micro benchmark: a 'normal'
 // and a futurized one.
+//
+// Run with --no-recycling to compare against allocating a fresh thread object
+// (and stack) for each of the spawned tasks instead of reusing the ones held
+// by the thread queues (see hpx.thread_queue.max_recycled_thread_count). Run
+// with --locked-recycling to compare against protecting the recycled thread
+// objects with a mutex (see hpx.thread_queue.lock_free_recycling).
 
 #include <hpx/local/chrono.hpp>
 #include <hpx/local/future.hpp>
 #include <hpx/local/init.hpp>
+#include <hpx/modules/program_options.hpp>
 
 #include <cstdint>
 #include <iostream>
+#include <string>
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -81,8 +89,20 @@ hpx::future<std::int64_t> skynet_f(
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-int hpx_main()
+int hpx_main(hpx::program_options::variables_map& vm)
 {
+    int const repetitions = vm["repetitions"].as<int>();
+    char const* recycling = "";
+    if (vm.count("no-recycling"))
+    {
+        recycling = " (no recycling)";
+    }
+    else if (vm.count("locked-recycling"))
+    {
+        recycling = " (locked recycling)";
+    }
+
+    for (int i = 0; i != repetitions; ++i)
     {
         std::uint64_t t = hpx::chrono::high_resolution_clock::now();
 
@@ -92,9 +112,10 @@ int hpx_main()
         t = hpx::chrono::high_resolution_clock::now() - t;
 
         std::cout << "Result 1: " << result.get() << " in " << (t / 1e6)
-                  << " ms.\n";
+                  << " ms" << recycling << ".\n";
     }
 
+    for (int i = 0; i != repetitions; ++i)
     {
         std::uint64_t t = hpx::chrono::high_resolution_clock::now();
 
@@ -104,12 +125,46 @@ int hpx_main()
         t = hpx::chrono::high_resolution_clock::now() - t;
 
         std::cout << "Result 2: " << result.get() << " in " << (t / 1e6)
-                  << " ms.\n";
+                  << " ms" << recycling << ".\n";
     }
-    return 0;
+    return hpx::local::finalize();
 }
 
 int main(int argc, char* argv[])
 {
-    return hpx::local::init(hpx_main, argc, argv);
+    namespace po = hpx::program_options;
+
+    // Configure application-specific options.
+    po::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("repetitions", po::value<int>()->default_value(1),
+         "number of repetitions of each of the benchmarks")
+        ("no-recycling",
+         "do not reuse terminated thread objects for new tasks")
+        ("locked-recycling",
+         "protect the reused thread objects with a mutex");
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    // the command line is not parsed yet, look for the option directly
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::string(argv[i]) == "--no-recycling")
+        {
+            init_args.cfg.emplace_back(
+                "hpx.thread_queue.max_recycled_thread_count=0");
+        }
+        else if (std::string(argv[i]) == "--locked-recycling")
+        {
+            init_args.cfg.emplace_back(
+                "hpx.thread_queue.lock_free_recycling=0");
+        }
+    }
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
 }
@@ -0,0 +1,116 @@
+//  Copyright (c) 2022 Hartmut Kaiser
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares spawning a number of empty tasks one by one
+// (register_work) with spawning all of them through a single call
+// (register_work_batch). The tasks are either distributed by the scheduler
+// (no hint) or assigned to the worker threads round robin (--hints).
+
+#include <hpx/local/chrono.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/latch.hpp>
+#include <hpx/local/runtime.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<hpx::threads::thread_init_data> make_tasks(
+    std::size_t num_tasks, bool hints, hpx::latch& l)
+{
+    std::size_t const num_workers = hpx::get_num_worker_threads();
+
+    std::vector<hpx::threads::thread_init_data> data;
+    data.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        hpx::threads::thread_schedule_hint hint;
+        if (hints)
+        {
+            hint = hpx::threads::thread_schedule_hint(
+                static_cast<std::int16_t>(i % num_workers));
+        }
+
+        data.emplace_back(hpx::threads::make_thread_function_nullary(
+                              [&l]() { l.count_down(1); }),
+            "spawn_batch", hpx::threads::thread_priority::normal, hint);
+    }
+    return data;
+}
+
+double spawn(std::size_t num_tasks, bool hints, bool batch)
+{
+    hpx::threads::thread_pool_base* pool =
+        hpx::threads::detail::get_self_or_default_pool();
+
+    hpx::latch l(static_cast<std::ptrdiff_t>(num_tasks + 1));
+    std::vector<hpx::threads::thread_init_data> data =
+        make_tasks(num_tasks, hints, l);
+
+    std::uint64_t t = hpx::chrono::high_resolution_clock::now();
+
+    if (batch)
+    {
+        hpx::threads::register_work_batch(data.data(), data.size(), pool);
+    }
+    else
+    {
+        for (auto& d : data)
+        {
+            hpx::threads::register_work(d, pool);
+        }
+    }
+    l.arrive_and_wait();
+
+    t = hpx::chrono::high_resolution_clock::now() - t;
+    return t / 1e6;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const num_tasks = vm["tasks"].as<std::size_t>();
+    int const repetitions = vm["repetitions"].as<int>();
+    bool const hints = vm.count("hints") != 0;
+
+    for (int i = 0; i != repetitions; ++i)
+    {
+        std::cout << "register_work: " << num_tasks << " tasks in "
+                  << spawn(num_tasks, hints, false) << " ms.\n";
+        std::cout << "register_work_batch: " << num_tasks << " tasks in "
+                  << spawn(num_tasks, hints, true) << " ms.\n";
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    namespace po = hpx::program_options;
+
+    // Configure application-specific options.
+    po::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("tasks", po::value<std::size_t>()->default_value(500000),
+         "number of tasks to spawn")
+        ("repetitions", po::value<int>()->default_value(1),
+         "number of repetitions of each of the benchmarks")
+        ("hints",
+         "assign the tasks to the worker threads round robin");
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
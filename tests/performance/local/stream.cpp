@@ -522,7 +522,8 @@ int hpx_main(hpx::program_options::variables_map& vm)
         }
         else if (executor == 1)
         {
-            // Block executor with block allocator.
+            // Block executor with block allocator, using the same chunks
+            // as the allocator's first touch.
             using executor_type = hpx::compute::host::block_executor<>;
             using allocator_type =
                 hpx::compute::host::block_allocator<STREAM_TYPE>;
@@ -530,7 +531,8 @@ int hpx_main(hpx::program_options::variables_map& vm)
             auto numa_nodes = hpx::compute::host::numa_domains();
             allocator_type alloc(numa_nodes);
             executor_type exec(numa_nodes);
-            auto policy = hpx::execution::par.on(exec);
+            auto policy = hpx::execution::par.on(exec).with(
+                hpx::execution::experimental::numa_affine_chunks());
 
             timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
                 std::move(alloc), std::move(policy));
@@ -577,10 +579,23 @@ int hpx_main(hpx::program_options::variables_map& vm)
             timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
                 std::move(alloc), std::move(policy));
         }
+        else if (executor == 5)
+        {
+            // Default parallel policy with NUMA affine chunks, the allocator
+            // touches the same chunks on the same cores as the benchmark.
+            auto policy = hpx::execution::par.with(
+                hpx::execution::experimental::numa_affine_chunks());
+            hpx::compute::host::detail::policy_allocator<STREAM_TYPE,
+                decltype(policy)>
+                alloc(policy);
+
+            timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
+                std::move(alloc), std::move(policy));
+        }
         else
         {
             HPX_THROW_EXCEPTION(hpx::commandline_option_error, "hpx_main",
-                "Invalid executor id given (0-4 allowed");
+                "Invalid executor id given (0-5 allowed");
         }
     }
     time_total = mysecond() - time_total;
@@ -634,9 +649,10 @@ int hpx_main(hpx::program_options::variables_map& vm)
                 "max,add_bytes,add_bw,add_avg,add_min,add_max,triad_bytes,"
                 "triad_bw,triad_avg,triad_min,triad_max\n");
         }
-        std::size_t const num_executors = 5;
+        std::size_t const num_executors = 6;
         const char* executors[num_executors] = {"parallel-serial", "block",
-            "parallel-parallel", "fork_join_executor", "scheduler_executor"};
+            "parallel-parallel", "fork_join_executor", "scheduler_executor",
+            "numa_affine_chunks"};
         hpx::util::format_to(std::cout, "{},{},{},", executors[executor],
             hpx::get_os_thread_count(), vector_size);
     }
@@ -712,7 +728,7 @@ int main(int argc, char* argv[])
             "size of vector (default: 1024)")
         (   "executor",
             hpx::program_options::value<std::size_t>()->default_value(2),
-            "executor to use (0-4) (default: 2, parallel_executor)")
+            "executor to use (0-5) (default: 2, parallel_executor)")
         ;
     // clang-format on
 
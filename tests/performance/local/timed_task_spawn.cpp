@@ -9,6 +9,12 @@
 
 // FIXME: Calling the tasks "workers" overloads the term worker-thread (which
 // refers to OS-threads).
+//
+// Run with --no-recycling to compare against allocating a fresh thread object
+// (and stack) for each of the spawned tasks instead of reusing the ones held
+// by the thread queues (see hpx.thread_queue.max_recycled_thread_count). Run
+// with --locked-recycling to compare against protecting the recycled thread
+// objects with a mutex (see hpx.thread_queue.lock_free_recycling).
 
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
@@ -64,6 +70,9 @@ using std::flush;
 std::uint64_t tasks = 500000;
 std::uint64_t suspended_tasks = 0;
 std::uint64_t delay = 0;
+std::uint64_t repetitions = 1;
+bool no_recycling = false;
+bool locked_recycling = false;
 bool header = true;
 bool csv_header = false;
 std::string scaling("weak");
@@ -110,7 +119,9 @@ void print_results(std::uint64_t cores, double walltime, double warmup_estimate,
     if (header)
     {
         cout << "# BENCHMARK: " << benchmark_name << " (" << scaling
-             << " scaling, " << distribution << " distribution)\n";
+             << " scaling, " << distribution << " distribution"
+             << (no_recycling ? ", no recycling" : "")
+             << (locked_recycling ? ", locked recycling" : "") << ")\n";
 
         cout << "# VERSION: " << HPX_HAVE_GIT_COMMIT << " "
              << format_build_date() << "\n"
@@ -335,6 +346,15 @@ int hpx_main(variables_map& vm)
         if (vm.count("csv-header"))
             csv_header = true;
 
+        if (vm.count("no-recycling"))
+            no_recycling = true;
+
+        if (vm.count("locked-recycling"))
+            locked_recycling = true;
+
+        if (0 == repetitions)
+            throw std::invalid_argument("count of 0 repetitions specified\n");
+
         if (0 == tasks)
             throw std::invalid_argument("count of 0 tasks specified\n");
 
@@ -449,56 +469,66 @@ int hpx_main(variables_map& vm)
             ac = std::make_shared<hpx::util::activate_counters>(counters);
         }
 
-        ///////////////////////////////////////////////////////////////////////
-        // Start the clock.
-        high_resolution_timer t;
-        if (ac)
+        // Tasks suspended during earlier repetitions stay suspended until
+        // the end of the benchmark.
+        for (std::uint64_t r = 0; r != repetitions; ++r)
         {
-            ac->reset_counters();
-        }
+            ///////////////////////////////////////////////////////////////////
+            // Start the clock.
+            high_resolution_timer t;
+            if (ac)
+            {
+                ac->reset_counters();
+            }
 
-        // This needs to stay here; we may have suspended as recently as the
-        // performance counter reset (which is called just before the staging
-        // function).
-        std::uint64_t const num_thread = hpx::get_worker_thread_num();
+            // This needs to stay here; we may have suspended as recently as
+            // the performance counter reset (which is called just before the
+            // staging function).
+            std::uint64_t const num_thread = hpx::get_worker_thread_num();
 
-        for (std::uint64_t i = 0; i < os_thread_count; ++i)
-        {
-            if (num_thread == i)
-                continue;
+            for (std::uint64_t i = 0; i < os_thread_count; ++i)
+            {
+                if (num_thread == i)
+                    continue;
+
+                thread_init_data data(
+                    make_thread_function_nullary(hpx::bind(
+                        &stage_workers, i, tasks_per_feeder, stage_worker)),
+                    "stage_workers", hpx::threads::thread_priority::normal,
+                    hpx::threads::thread_schedule_hint(
+                        static_cast<std::int16_t>(i)));
+                register_work(data);
+            }
 
-            thread_init_data data(
-                make_thread_function_nullary(hpx::bind(
-                    &stage_workers, i, tasks_per_feeder, stage_worker)),
-                "stage_workers", hpx::threads::thread_priority::normal,
-                hpx::threads::thread_schedule_hint(
-                    static_cast<std::int16_t>(i)));
-            register_work(data);
-        }
+            stage_workers(num_thread, tasks_per_feeder, stage_worker);
 
-        stage_workers(num_thread, tasks_per_feeder, stage_worker);
+            double warmup_estimate = t.elapsed();
 
-        double warmup_estimate = t.elapsed();
+            // Schedule a low-priority thread; when it is executed, it checks
+            // to make sure all the tasks (which are normal priority) have been
+            // executed, and then it
+            std::shared_ptr<hpx::barrier<>> finished =
+                std::make_shared<hpx::barrier<>>(2);
 
-        // Schedule a low-priority thread; when it is executed, it checks to
-        // make sure all the tasks (which are normal priority) have been
-        // executed, and then it
-        std::shared_ptr<hpx::barrier<>> finished =
-            std::make_shared<hpx::barrier<>>(2);
+            thread_init_data data(
+                make_thread_function_nullary(
+                    hpx::bind(&wait_for_tasks, finished,
+                        total_suspended_tasks * (r + 1))),
+                "wait_for_tasks", hpx::threads::thread_priority::low);
+            register_work(data);
 
-        thread_init_data data(
-            make_thread_function_nullary(
-                hpx::bind(&wait_for_tasks, finished, total_suspended_tasks)),
-            "wait_for_tasks", hpx::threads::thread_priority::low);
-        register_work(data);
+            finished->arrive_and_wait();
 
-        finished->arrive_and_wait();
+            // Stop the clock
+            double time_elapsed = t.elapsed();
 
-        // Stop the clock
-        double time_elapsed = t.elapsed();
+            print_results(os_thread_count, time_elapsed, warmup_estimate,
+                counter_shortnames, ac);
 
-        print_results(os_thread_count, time_elapsed, warmup_estimate,
-            counter_shortnames, ac);
+            // print the header only once
+            header = false;
+            csv_header = false;
+        }
     }
 
     if (suspended_tasks != 0)
@@ -545,6 +575,16 @@ int main(int argc, char* argv[])
         , value<std::uint64_t>(&delay)->default_value(5)
         , "duration of delay in microseconds")
 
+        ( "repetitions"
+        , value<std::uint64_t>(&repetitions)->default_value(1)
+        , "number of repetitions of the benchmark")
+
+        ( "no-recycling"
+        , "do not reuse terminated thread objects for new tasks")
+
+        ( "locked-recycling"
+        , "protect the reused thread objects with a mutex")
+
         ( "counter"
         , value<std::vector<std::string> >()->composing()
         , "activate and report the specified performance counter")
@@ -561,5 +601,20 @@ int main(int argc, char* argv[])
     hpx::init_params init_args;
     init_args.desc_cmdline = cmdline;
 
+    // the command line is not parsed yet, look for the option directly
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::string(argv[i]) == "--no-recycling")
+        {
+            init_args.cfg.emplace_back(
+                "hpx.thread_queue.max_recycled_thread_count=0");
+        }
+        else if (std::string(argv[i]) == "--locked-recycling")
+        {
+            init_args.cfg.emplace_back(
+                "hpx.thread_queue.lock_free_recycling=0");
+        }
+    }
+
     return hpx::init(argc, argv, init_args);
 }